@@ -0,0 +1,81 @@
+/**
+ * @file    analytic.h
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   analytic M/G/1 estimators of libcpusched (no simulation)
+ *          - FCFS: Pollaczek-Khinchine
+ *          - NPP: Cobham (non-preemptive priority classes), SJF: Cobham with a class for each burst
+ *          - PP: preemptive-resume priority classes
+ *          - SRT: Schrage-Miller (shortest remaining processing time)
+ *          - the burst distribution is the one of `ArrivalGen` after rounding to time units,
+ *            so the estimate matches `run_stream()` on `generator_source()` of the same spec
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+#ifndef ANALYTIC_H
+#define ANALYTIC_H
+
+// standard library
+#include <stdbool.h>
+
+// user define library
+#include "stream.h"
+
+/**
+ * @brief analytic.h variable info
+ *
+ *  type            name                pointer     info
+ *  #define         ANALYTIC_TAIL       n           burst distribution is cut where the tail is under this
+ *  #define         ANALYTIC_MAX_BURST  n           largest burst of the distribution (the tail is put there)
+ *  ArrivalGen      spec                y           distribution spec (rate, meanBurst, cv, priorities)
+ *  AnalyticResult  r                   y           estimated metrics
+ *  int             algo                n           algorithm index (same as `algoName` array)
+ *
+ *  the engine runs in whole time units and every arrival of a time unit enters at its start:
+ *  the FCFS estimate is exact for that slotted queue, the others are the continuous-time formulas
+ *  on the rounded burst distribution (within 1% for bursts of tens of time units, up to 5% for
+ *  bursts of a few time units where preemption at whole time units matters)
+ *  priority is uniform in 1 ~ `priorities` and independent of the burst, as `generator_source()`
+ *
+ */
+
+#define ANALYTIC_TAIL       1e-12       // burst distribution is cut where the tail is under this
+#define ANALYTIC_MAX_BURST  (1 << 22)   // largest burst of the distribution (the tail is put there)
+
+/**
+ * @brief structure for estimated metrics
+ *
+ */
+typedef struct AnalyticResult {
+
+    bool stable;            // load under 1 (the means are infinite otherwise)
+    double rho;             // load (arrival rate * mean burst)
+    double mean_burst;      // mean burst time (rounded distribution)
+    double second_moment;   // second moment of the burst time
+    double avg_waiting;     // average waiting (turnaround - burst)
+    double avg_turnaround;  // average turnaround
+
+} AnalyticResult;
+
+/**
+ * @brief   check analytic estimator of algorithm
+ *
+ * @param algo  algorithm index (same as `algoName` array)
+ * @return  bool (false if the algorithm has no closed form, e.g. RR, HRN)
+ */
+bool analytic_supported(int algo);
+
+/**
+ * @brief   estimate steady-state mean metrics of algorithm on the distribution spec
+ *
+ * @param algo  algorithm index (same as `algoName` array)
+ * @param spec  distribution spec (`rate`, `meanBurst`, `cv`, `priorities` of `init_generator()`)
+ * @param r     pointer for estimated metrics
+ * @return  bool (false if the algorithm is not supported, `r->stable` false if the load is 1 or more)
+ */
+bool analytic_estimate(int algo, const ArrivalGen *spec, AnalyticResult *r);
+
+#endif
@@ -0,0 +1,105 @@
+/**
+ * @file    batch.h
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   batched engine of libcpusched: many small workloads of the same size at once
+ *          - one SIMD lane for each workload, every lane runs the same scheduling events in lockstep
+ *            (16 lanes with AVX-512, 8 with AVX2, 4 with the generic build for any processor)
+ *          - event driven: one event is one dispatch (non-preemptive) or one time slice (RR),
+ *            no gantt chart and no ready queue, the result is the sums of a `Schedule`
+ *          - FCFS, SJF, HRN, NPP and RR, same sums as `run_algorithm()` for each workload
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+#ifndef BATCH_H
+#define BATCH_H
+
+// standard library
+#include <stdbool.h>
+
+// user define library
+#include "process.h"
+
+/**
+ * @brief batch.h variable info
+ *
+ *  type            name                pointer     info
+ *  #define         BATCH_MAX_PROCESS   n           largest workload of the batched engine
+ *  #define         BATCH_MAX_TIME      n           latest termination time of a workload in a lane
+ *  #define         BATCH_LANES         n           widest lane count (AVX-512)
+ *  enum            BatchIsa            n           instruction set of the lanes
+ *  BatchResult     out                 y           sums of the schedule of a workload
+ *
+ *  lanes are 32-bit: a workload with an arrival before 0, a burst under 1, a termination after
+ *  `BATCH_MAX_TIME` or a key out of range runs on the ordinary engine instead, with the same result
+ *  the workloads do not need to be sorted by arrival (sorted in each lane, stable as the engine)
+ *
+ */
+
+#define BATCH_MAX_PROCESS   32          // largest workload of the batched engine
+#define BATCH_MAX_TIME      (1 << 24)   // latest termination time of a workload in a lane
+#define BATCH_LANES         16          // widest lane count (AVX-512)
+
+/**
+ * @brief enumeration for instruction set of the lanes
+ *
+ */
+typedef enum BatchIsa {
+
+    BATCH_AUTO,     // widest instruction set of the processor
+    BATCH_GENERIC,  // 4 lanes, base instruction set of the build (scalar if it has no vectors)
+    BATCH_AVX2,     // 8 lanes, AVX2
+    BATCH_AVX512,   // 16 lanes, AVX-512
+    BATCH_ISAS      // instruction set count
+
+} BatchIsa;
+
+/**
+ * @brief structure for sums of the schedule of a workload
+ *
+ */
+typedef struct BatchResult {
+
+    Time total_turnaround;  // the sum of turnaround
+    Time total_waiting;     // the sum of waiting
+    Time total_response;    // the sum of response
+
+} BatchResult;
+
+// instruction set name (`BatchIsa` order)
+extern const char *batchIsaName[BATCH_ISAS];
+
+/**
+ * @brief   check the instruction set can run on this processor and build
+ *
+ * @param isa   instruction set of the lanes
+ * @return  bool
+ */
+bool batch_supported(BatchIsa isa);
+
+/**
+ * @brief   lane count of the instruction set (`BATCH_AUTO`: of the widest one supported)
+ *
+ * @param isa   instruction set of the lanes
+ * @return  int (0 if not supported)
+ */
+int batch_lanes(BatchIsa isa);
+
+/**
+ * @brief   run the algorithm on every workload and save the sums of each schedule
+ *
+ * @param algo  algorithm index (same as `algoName` array): FCFS, SJF, HRN, NPP or RR
+ * @param p     pointer for process structure (`count` workloads of `n` processes, one after another)
+ * @param n     process count of each workload (1 ~ `BATCH_MAX_PROCESS`)
+ * @param count workload count
+ * @param q     time quantum of RR (0: `QAUNTUM`)
+ * @param isa   instruction set of the lanes
+ * @param out   pointer for sums of each schedule (`count` results)
+ * @return  bool (false if the algorithm is preemptive, `n` is out of range, `isa` is not supported or out of memory)
+ */
+bool run_batch(int algo, const Process *p, int n, int count, int q, BatchIsa isa, BatchResult *out);
+
+#endif
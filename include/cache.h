@@ -0,0 +1,129 @@
+/**
+ * @file    cache.h
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   content-addressed result cache of libcpusched
+ *          - key: 128-bit hash of the workload (process no., priority, arrival, burst of each
+ *            process in order) and the policy configuration (name, quantum)
+ *          - value: results file (`include/results.h`) named by the key in the cache directory
+ *          - atomic write: temporary file in the same directory, then rename
+ *          - LRU eviction: a hit touches the file, the oldest files are removed when the
+ *            directory grows past the size limit
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+#ifndef CACHE_H
+#define CACHE_H
+
+// standard library
+#include <stdbool.h>
+
+// user define library
+#include "policy.h"
+#include "process.h"
+
+/**
+ * @brief cache.h variable info
+ *
+ *  type            name            pointer     info
+ *  #define         CACHE_VERSION   n           version of the cached results (part of the key)
+ *  #define         CACHE_LIMIT     n           default size limit of the cache directory (bytes)
+ *  #define         CACHE_PATH_W    n           maximum length of cache directory path
+ *  ResultCache     c               y           result cache
+ *  CacheKey        key             n           key of workload and policy configuration
+ *  Policy          pol             y           policy of the result (name and quantum are used)
+ *
+ *  the key does not cover the code of a policy: change `CACHE_VERSION` when the engine or a
+ *  built-in policy changes its schedule, and do not cache a plugin that changes under the same name
+ *
+ */
+
+#define CACHE_VERSION   1               // version of the cached results (part of the key)
+#define CACHE_LIMIT     (256LL << 20)   // default size limit of the cache directory (bytes)
+#define CACHE_PATH_W    512             // maximum length of cache directory path
+
+/**
+ * @brief structure for key of workload and policy configuration
+ *
+ */
+typedef struct CacheKey {
+
+    unsigned long long h[2];    // 128-bit hash
+
+} CacheKey;
+
+/**
+ * @brief structure for result cache
+ *
+ */
+typedef struct ResultCache {
+
+    char dir[CACHE_PATH_W];     // cache directory
+    long long limit;            // size limit of the cache directory (bytes)
+    long long size;             // size of the cache directory (bytes, estimated between evictions)
+    int evicting;               // an eviction is running (one at a time)
+
+} ResultCache;
+
+/**
+ * @brief   open result cache, the directory is created if it does not exist
+ *
+ * @param c     pointer for result cache
+ * @param dir   cache directory
+ * @param limit size limit of the cache directory (bytes, 0: `CACHE_LIMIT`)
+ * @return  bool (false if the directory can't be created)
+ */
+bool cache_init(ResultCache *c, const char *dir, long long limit);
+
+/**
+ * @brief   key of workload and policy configuration
+ *
+ * @param p     pointer for process structure (in the order given to the algorithm)
+ * @param n     total process count
+ * @param pol   pointer for scheduling policy (name and quantum)
+ * @return  CacheKey
+ */
+CacheKey cache_key(const Process *p, int n, const Policy *pol);
+
+/**
+ * @brief   load cached result of the key (free with `free_schedule()`), the file is touched for LRU
+ *
+ * @param c     pointer for result cache
+ * @param key   key of workload and policy configuration
+ * @param s     pointer for schedule structure
+ * @return  bool (false if not cached)
+ */
+bool cache_get(ResultCache *c, CacheKey key, Schedule *s);
+
+/**
+ * @brief   copy cached results file of the key without decoding it, the file is touched for LRU
+ *
+ * @param c         pointer for result cache
+ * @param key       key of workload and policy configuration
+ * @param fileName  output results file path
+ * @return  bool (false if not cached or the file can't be written)
+ */
+bool cache_copy(ResultCache *c, CacheKey key, const char *fileName);
+
+/**
+ * @brief   store result of the key (atomic), the oldest files are removed past the size limit
+ *
+ * @param c     pointer for result cache
+ * @param key   key of workload and policy configuration
+ * @param s     pointer for schedule structure
+ * @return  bool
+ */
+bool cache_put(ResultCache *c, CacheKey key, const Schedule *s);
+
+/**
+ * @brief   remove the least recently used results until the directory is under the size limit
+ *
+ * @param c pointer for result cache
+ * @return  int (removed file count)
+ */
+int cache_evict(ResultCache *c);
+
+#endif
@@ -0,0 +1,92 @@
+/**
+ * @file    capacity.h
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   capacity planning of libcpusched: maximum arrival rate under a latency SLO
+ *          - a probe simulates the open system (`run_stream()`) at one arrival rate and
+ *            estimates the quantile of waiting after the MSER-5 warm-up, with batch confidence bounds
+ *          - parallel bisection: each round probes `jobs` rates inside the present bracket for every
+ *            policy at once, the bracket shrinks to the two probes around the SLO crossing
+ *          - common random numbers: every probe uses the same seed, so the arrival and burst
+ *            sequence is the same stream scaled in time and the crossing is not blurred by noise
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+#ifndef CAPACITY_H
+#define CAPACITY_H
+
+// standard library
+#include <stdbool.h>
+
+// user define library
+#include "policy.h"
+
+/**
+ * @brief capacity.h variable info
+ *
+ *  type                name                pointer     info
+ *  #define             CAPACITY_SAMPLES    n           default terminations of each probe
+ *  #define             CAPACITY_ROUNDS     n           maximum bisection rounds
+ *  CapacityOptions     opt                 y           burst distribution, SLO and search options
+ *  CapacityResult      res                 y           result of each policy
+ *  Policy              pol                 y           policy array to be planned
+ *
+ *  the quantile of waiting is assumed to grow with the arrival rate (true for every built-in policy)
+ *  confidence bounds: `low` is the highest probed rate whose upper bound meets the SLO,
+ *  `high` the lowest probed rate whose lower bound misses it
+ *
+ */
+
+#define CAPACITY_SAMPLES    200000  // default terminations of each probe
+#define CAPACITY_ROUNDS     20      // maximum bisection rounds
+
+/**
+ * @brief structure for burst distribution, SLO and search options
+ *
+ */
+typedef struct CapacityOptions {
+
+    double meanBurst;           // mean burst time (`init_generator()`)
+    double cv;                  // coefficient of variation of the burst time
+    int priorities;             // priority is uniform in 1 ~ `priorities`
+    double slo;                 // the quantile of waiting must be at most this
+    double quantile;            // quantile of the SLO (0: 0.99)
+    double confidence;          // confidence level of the bounds (0: 0.95)
+    double tolerance;           // bracket width to stop, in load (0: 0.005)
+    long long samples;          // terminations of each probe, warm-up included (0: `CAPACITY_SAMPLES`)
+    unsigned long long seed;    // random seed of every probe
+    int jobs;                   // thread count (0: online processor count)
+
+} CapacityOptions;
+
+/**
+ * @brief structure for result of each policy
+ *
+ */
+typedef struct CapacityResult {
+
+    double rate;        // maximum sustainable arrival rate (middle of the final bracket)
+    double load;        // the rate * mean burst
+    double low;         // highest rate meeting the SLO with the confidence (0 if none probed)
+    double high;        // lowest rate missing the SLO with the confidence (load 1 if none probed)
+    double value;       // quantile of waiting at the highest rate meeting the SLO
+    double halfWidth;   // half-width of its confidence interval
+    int probes;         // probes run for the policy
+
+} CapacityResult;
+
+/**
+ * @brief   search maximum sustainable arrival rate of every policy
+ *
+ * @param pol   policy array
+ * @param count policy count
+ * @param opt   burst distribution, SLO and search options
+ * @param res   result array (`count`)
+ * @return  bool (false if the options are invalid or a probe failed)
+ */
+bool plan_capacity(const Policy *const *pol, int count, const CapacityOptions *opt, CapacityResult *res);
+
+#endif
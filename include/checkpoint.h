@@ -0,0 +1,92 @@
+/**
+ * @file    checkpoint.h
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   checkpoint and resume of long scheduling runs (libcpusched)
+ *          - the engine stops every `interval` time units and writes a snapshot of its whole state:
+ *            process table, ready queue, clock, metric accumulators and result table
+ *          - gantt chart segments go to an append-only segment log: a snapshot writes only the
+ *            segments since the last one, not the whole gantt chart again
+ *          - asynchronous: a forked child writes the copy-on-write image of the state while the
+ *            run goes on (written in the calling thread on systems without fork)
+ *          - resume continues from the snapshot and gives the same result as an uninterrupted run
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+// standard library
+#include <stdbool.h>
+
+// user define library
+#include "policy.h"
+#include "process.h"
+
+/**
+ * @brief checkpoint.h variable info
+ *
+ *  type                name                pointer     info
+ *  #define             CHECKPOINT_MAGIC    n           magic bytes at the start of a snapshot file
+ *  #define             CHECKPOINT_VERSION  n           snapshot file version
+ *  #define             CHECKPOINT_INTERVAL n           default time units between snapshots
+ *  CheckpointOptions   opt                 y           checkpoint options
+ *  CheckpointStats     stats               y           checkpoint statistics (can be NULL)
+ *
+ *  snapshot file: magic, version, workload and policy key (`cache_key()`), engine state as varints
+ *  (process records are zigzag deltas of the previous record), segment count and last segment, checksum;
+ *  written to `<file>.tmp` then renamed, so the file is always the last complete snapshot
+ *  segment log `<file>.seg`: fixed 12-byte records (start, process no.), written before the
+ *  snapshot file, only the first records up to the segment count of the snapshot are read
+ *  the engine is deterministic (no random number generator), state inside `Policy.data` of a
+ *  plugin is not saved: resume only policies whose hooks keep no state between calls
+ *
+ */
+
+#define CHECKPOINT_MAGIC    "CPSK"      // magic bytes at the start of a snapshot file
+#define CHECKPOINT_VERSION  3           // snapshot file version
+#define CHECKPOINT_INTERVAL 10000000    // default time units between snapshots
+
+/**
+ * @brief structure for checkpoint options
+ *
+ */
+typedef struct CheckpointOptions {
+
+    const char *fileName;   // snapshot file path
+    Time interval;          // time units between snapshots (0: `CHECKPOINT_INTERVAL`)
+    bool resume;            // continue from the snapshot file if it has the same workload and policy
+    bool sync;              // write snapshots in the calling thread (no fork)
+
+} CheckpointOptions;
+
+/**
+ * @brief structure for checkpoint statistics
+ *
+ */
+typedef struct CheckpointStats {
+
+    long long snapshots;    // snapshots started
+    long long skipped;      // snapshots skipped because the previous one was still being written
+    long long failed;       // snapshots failed to write
+    Time resumed;           // time the run resumed from (-1 if started from the beginning)
+
+} CheckpointStats;
+
+/**
+ * @brief   run scheduling policy with snapshots, or resume it from the snapshot file
+ *
+ * @param pol   pointer for scheduling policy (`quantum` is the time quantum)
+ * @param p     pointer for process structure
+ * @param n     total process count
+ * @param s     pointer for schedule result save
+ * @param opt   checkpoint options
+ * @param stats checkpoint statistics (can be NULL)
+ * @return  bool (false if the options are invalid)
+ */
+bool run_checkpointed(const Policy *pol, Process *p, int n, Schedule *s, const CheckpointOptions *opt, CheckpointStats *stats);
+
+#endif
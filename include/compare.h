@@ -3,7 +3,7 @@
  * @author  Mindou (minsu5875@naver.com)
  * @brief   compare function package for qsort()
  * @version 0.1
- * @date    (first date: 2023-05-15, last date: 2023-05-28)
+ * @date    (first date: 2023-05-15, last date: 2026-10-17)
  * 
  * @copyright Copyright (c) 2023 Minsu Bak
  * 
@@ -12,9 +12,8 @@
 #ifndef COMPARE_H
 #define COMPARE_H
 
-// external library && user define library
+// user define library
 #include "process.h"
-#include "queue.h"
 
 /**
  * @brief compare.h variable info
@@ -34,15 +33,7 @@
  * @param b compare target b
  * @return  int 
  */
-int compare_for_arrival(const void* a, const void* b) {
-        
-    // compare target match progress
-
-    Process* A = (Process*) a;
-    Process* B = (Process*) b;
-
-    return (A->arrival>B->arrival)-(A->arrival<B->arrival);
-}
+int compare_for_arrival(const void* a, const void* b);
 
 /**
  * @brief   compare burst function with qsort
@@ -51,15 +42,7 @@ int compare_for_arrival(const void* a, const void* b) {
  * @param b compare target b
  * @return  int 
  */
-int compare_for_burst(const void* a, const void* b) {
-    
-    // compare target match progress
-
-    Process* A = (Process*) a;
-    Process* B = (Process*) b;
-
-    return (A->burst>B->burst)-(A->burst<B->burst);
-}
+int compare_for_burst(const void* a, const void* b);
 
 /**
  * @brief   compare priority function with qsort
@@ -68,18 +51,7 @@ int compare_for_burst(const void* a, const void* b) {
  * @param b compare target b
  * @return  int 
  */
-int compare_for_priority(const void* a, const void* b) {
-    
-    // compare target match progress
-
-    Process* A = (Process*) a;
-    Process* B = (Process*) b;
-
-    // if compare target A and B was same
-    if(A->priority == B->priority)
-        return (A->arrival>B->arrival)-(A->arrival<B->arrival);
-    return (A->priority>B->priority)-(A->priority<B->priority);
-}
+int compare_for_priority(const void* a, const void* b);
 
 /**
  * @brief   compare remain function with qsort
@@ -88,15 +60,7 @@ int compare_for_priority(const void* a, const void* b) {
  * @param b compare target b
  * @return int 
  */
-int compare_for_remain(const void* a, const void* b) {
-    
-    // compare target match progress
-
-    Process* A = (Process*) a;
-    Process* B = (Process*) b;
-
-    return (A->remain>B->remain)-(A->remain<B->remain);
-}
+int compare_for_remain(const void* a, const void* b);
 
 /**
  * @brief   compare priority, but using special formula function with qsort
@@ -106,14 +70,6 @@ int compare_for_remain(const void* a, const void* b) {
  * @param b compare target b
  * @return int 
  */
-int compare_for_HRN(const void* a, const void* b) {
-
-    // compare target match progress
-
-    Process* A = (Process*) a;
-    Process* B = (Process*) b;
-
-    return (((A->waiting + A->burst) / A->burst) > ((B->waiting + B->burst) / B->burst)) - (((A->waiting + A->burst) / A->burst) < ((B->waiting + B->burst) / B->burst));
-}
+int compare_for_HRN(const void* a, const void* b);
 
 #endif
\ No newline at end of file
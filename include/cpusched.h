@@ -0,0 +1,54 @@
+/**
+ * @file    cpusched.h
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   libcpusched public API header
+ *          - workload in: `load_workload()`, `default_workload()`, `init_process()`
+ *          - scheduler trace in: `load_trace()`, `parse_trace()` (perf sched script, ftrace)
+ *          - live capture: `sample_proc()` from /proc of the local machine (Linux)
+ *          - scheduling: `run_algorithm()` (or each algorithm function)
+ *          - user defined policy: `Policy` hooks and `run_policy()`
+ *          - policy plugin: `load_plugin()` from a shared object at runtime
+ *          - results and metrics out: `Schedule`, `get_metrics()`, `free_schedule()`
+ *          - results file: `save_results()`, `open_results()`, `read_column()`, `load_results()`
+ *          - result cache: `cache_key()`, `cache_get()`, `cache_put()` (content-addressed, LRU)
+ *          - long runs: `run_checkpointed()` snapshots and resumes the engine state
+ *          - open system: `run_stream()` on an unbounded arrival stream, sliding window metrics
+ *          - steady state: `run_steady()` MSER-5 warm-up, batch means and stopping rule
+ *          - queueing models: `analytic_estimate()` M/G/1 means without simulation
+ *          - capacity planning: `plan_capacity()` maximum arrival rate under a latency SLO
+ *          - load sweep: `run_sweep()` latency versus utilization curves of every policy
+ *          - optimal schedule: `solve_optimal()` non-preemptive optimum and the gap of each algorithm
+ *          - parameter tuning: `tune_policy()` RR, MLFQ and aging parameters by successive halving
+ *          - batched engine: `run_batch()` small workloads of the same size in SIMD lanes
+ *          - no raylib dependency, link with `-lcpusched`
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+#ifndef CPUSCHED_H
+#define CPUSCHED_H
+
+// user define library
+#include "analytic.h"
+#include "batch.h"
+#include "cache.h"
+#include "capacity.h"
+#include "checkpoint.h"
+#include "optimal.h"
+#include "plugin.h"
+#include "policy.h"
+#include "process.h"
+#include "results.h"
+#include "sampler.h"
+#include "scheduler.h"
+#include "steady.h"
+#include "stream.h"
+#include "sweep.h"
+#include "trace.h"
+#include "tune.h"
+#include "workload.h"
+
+#endif
@@ -0,0 +1,108 @@
+/**
+ * @file    draw.h
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   GUI drawing function package header
+ *          - draw scheduling result of libcpusched with raylib
+ * @version 0.1
+ * @date    (first date: 2023-05-03, last date: 2026-10-17)
+ * 
+ * @copyright Copyright (c) 2023 Minsu Bak
+ * 
+ */
+
+#ifndef DRAW_H
+#define DRAW_H
+
+// external library & user define library
+#include "main.h"
+#include "optimal.h"
+#include "process.h"
+#include "raylib.h"
+
+/**
+ * @brief draw.h variable info
+ *  
+ *  type        name        pointer info
+ *  Process     p           y       pointer for process structure (result array)
+ *  Segment     g           y       pointer for gantt chart segment array
+ *  long long   segments    n       gantt chart segment count
+ *  Texture2D   texture     n       card image
+ *  Time        t           n       total busrt time
+ *  int         n           n       total process count
+ *  char        algo        y       algorithm name string array
+ *  Metrics     m           y       average metrics of the schedule
+ *  OptimalResult best      y       optimal (or best found) non-preemptive schedule of the processes (NULL if not solved)
+ *  double      gap         n       optimality gap of the schedule (`optimal_gap()`)
+ * 
+ */
+
+/**
+ * @brief draw gantt chart and result
+ * 
+ * @param p         pointer for process structure (result array)
+ * @param g         pointer for gantt chart segment array
+ * @param segments  gantt chart segment count
+ * @param texture   card image
+ * @param t         total busrt time
+ * @param n         total process count
+ * @param algo      algorithm name string array
+ * @param m         average metrics of the schedule
+ * @param best      optimal (or best found) non-preemptive schedule of the processes (NULL if not solved)
+ * @param gap       optimality gap of the schedule (`optimal_gap()`)
+ */
+void draw_everything(Process *p, const Segment *g, long long segments, Texture2D texture, Time t, int n, const char* algo, const Metrics *m, const OptimalResult *best, double gap) {
+
+    DrawText(algo, SCREEN_W * 0.2 + 3, 80, 40, GREEN);
+
+    // average metrics next to the algorithm name, gap from the non-preemptive optimum
+    // (or from the best order found if the search stopped at the node limit)
+    if(best != NULL && best->optimal)
+        DrawText(TextFormat("avg wait %.2f  turn %.2f  optimal %.2f  gap %+.1f%%", m->avg_waiting, m->avg_turnaround, best->avg_waiting, gap * 100),
+            SCREEN_W * 0.2 + 160, 95, 20, GREEN);
+    else if(best != NULL)
+        DrawText(TextFormat("avg wait %.2f  turn %.2f  best found %.2f  gap to best %+.1f%%", m->avg_waiting, m->avg_turnaround, best->avg_waiting, gap * 100),
+            SCREEN_W * 0.2 + 160, 95, 20, GREEN);
+    else
+        DrawText(TextFormat("avg wait %.2f  turn %.2f", m->avg_waiting, m->avg_turnaround), SCREEN_W * 0.2 + 160, 95, 20, GREEN);
+
+    for(long long k = 0; k < segments; k++) {
+
+        // idle time: empty cells
+        if(g[k].processID == IDLE_PID)
+            continue;
+
+        // one cell for each time unit of the segment
+        Time end = k + 1 < segments ? g[k + 1].start : t;
+        for(Time i = g[k].start; i < end; i++) {
+
+            // draw textrue, texture size, draw position, reference point, rotation, color
+            DrawTexturePro(
+            texture,\
+            (Rectangle) {.x = 0, .y = 0, .width = 10, .height = 16},\
+            (Rectangle) {SCREEN_W * 0.1 + 103 + (i * 12), 140, 10, 16},\
+            (Vector2) { 0, 0 },\
+            0,\
+            pid_color(g[k].processID));
+
+            // draw text, x position, y position, font size, text color
+            DrawText(TextFormat("%d", g[k].processID), SCREEN_W * 0.1 + 105 + (i * 12), 160, 10, WHITE);
+        }
+    }
+
+    // draw text, x position, y position, font size, text color
+    DrawText("index\t\t\t\tPID\t\t\t\tarrival\t\t\t\tburst\t\t\t\tprioity\t\t\t\twaitng\t\t\tturnaround\n", SCREEN_W * 0.2, SCREEN_H * 0.3, 20, GREEN);
+    
+    for(int i = 0; i < n; i++) {
+
+        // draw text, x position, y position, font size, text color
+        DrawText(TextFormat("%d", i),                       SCREEN_W * 0.2 + 1  , SCREEN_H * 0.3 + (i * 20) + 30, 20, GREEN);
+        DrawText(TextFormat("%d", p[i].processID),          SCREEN_W * 0.2 + 100, SCREEN_H * 0.3 + (i * 20) + 30, 20, GREEN);
+        DrawText(TextFormat("%lld", p[i].arrival),          SCREEN_W * 0.2 + 185, SCREEN_H * 0.3 + (i * 20) + 30, 20, GREEN);
+        DrawText(TextFormat("%lld", p[i].burst),            SCREEN_W * 0.2 + 302, SCREEN_H * 0.3 + (i * 20) + 30, 20, GREEN);
+        DrawText(TextFormat("%d", p[i].priority),           SCREEN_W * 0.2 + 408, SCREEN_H * 0.3 + (i * 20) + 30, 20, GREEN);
+        DrawText(TextFormat("%lld", p[i].waiting),          SCREEN_W * 0.2 + 522, SCREEN_H * 0.3 + (i * 20) + 30, 20, GREEN);
+        DrawText(TextFormat("%lld",(p[i].execute + p[i].waiting)), SCREEN_W * 0.2 + 620, SCREEN_H * 0.3 + (i * 20) + 30, 20, GREEN);
+    }
+}
+
+#endif
\ No newline at end of file
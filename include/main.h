@@ -16,6 +16,7 @@
 #include <stdbool.h>
 
 // external library & user define library
+#include "pidmap.h"
 #include "raylib.h"
 #include "image.h"
 
@@ -37,21 +38,9 @@
 #define SCREEN_H            600     // screen size: height
 #define BTN_W               100     // button size: width
 #define BTN_H               62      // button size: height
-#define QAUNTUM             2       // default time quantum
-#define P_COUNT             5       // default process count
-#define P_PARAM             4       // default process parameters count
 
 int btnClickFlag[7];                // define click flag for each buttons
 
-// process default data to be used by the simulator
-int pInfo[P_COUNT][P_PARAM] = {
-    {0, 0, 10, 3}, // process 0, arrival 0, burst 10, priority 3
-    {1, 1, 28, 2}, // process 1, arrival 1, burst 28, priority 2
-    {2, 2,  6, 4}, // process 2, arrival 2, burst  6, priority 4
-    {3, 3,  4, 1}, // process 3, arrival 3, burst  4, priority 1
-    {4, 4, 14, 2}  // process 4, arrival 4, burst 14, priority 2
-};
-
 // button color flag
 const Color colorTag[] = {
     {  26,  26,  26, 255}, // dark gray
@@ -63,6 +52,22 @@ const Color colorTag[] = {
     {   0, 121, 241, 255}  // blue
 };
 
+/**
+ * @brief   color of the process for gantt chart
+ *          process no. 0 ~ 4 keep the `colorTag` colors, other process no. get
+ *          a hue from `pid_hash()`, so any number of sparse process no. has a color
+ *
+ * @param pid   process no.
+ * @return  Color
+ */
+Color pid_color(int pid) {
+
+    if(pid >= 0 && pid < 5)
+        return colorTag[2 + pid];
+
+    return ColorFromHSV((pid_hash(pid) >> 8) * (360.0f / 16777216.0f), 0.7f, 0.95f);
+}
+
 // logo position
 const Rectangle logo_position[] = { 
     {.x = SCREEN_W * 0.70f, .y = SCREEN_H * 0.8f, .width = 128, .height = 128},
@@ -0,0 +1,118 @@
+/**
+ * @file    optimal.h
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   optimal non-preemptive schedule of libcpusched (branch and bound)
+ *          - exact minimum of average waiting (total completion time) or of weighted completion time
+ *            for processes with arrival times on one CPU, inserted idle time allowed
+ *          - lower bound of a node: preemptive relaxation of the processes left, SRPT (shortest
+ *            remaining processing time) for waiting, job splitting (Belouadah, Posner, Potts) for weights
+ *          - depth-first search over worker threads, each with a deque: the owner takes its newest node,
+ *            an idle thread steals the oldest node (largest subtree) of another one (work stealing)
+ *          - the gap of a heuristic is the distance of its cost from the optimum (`optimal_gap()`)
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+#ifndef OPTIMAL_H
+#define OPTIMAL_H
+
+// standard library
+#include <stdbool.h>
+
+// user define library
+#include "process.h"
+
+/**
+ * @brief optimal.h variable info
+ *
+ *  type                name                    pointer     info
+ *  #define             OPTIMAL_MAX_PROCESS     n           largest instance (process count)
+ *  enum                OptimalObjective        n           objective of the search
+ *  OptimalOptions      opt                     y           objective, node limit and thread count
+ *  OptimalResult       r                       y           optimal order and its metrics
+ *
+ *  weight of a process: 1 / priority (smaller value is higher priority, as NPP and PP), 1 if priority <= 0
+ *  dominance: a process is not put next if another one left could run to the end before it starts
+ *  the first incumbent is the best non-delay order of shortest and weighted shortest burst first
+ *  practical size: tens of processes, hard instances of more stop at the node limit
+ *
+ */
+
+#define OPTIMAL_MAX_PROCESS 64  // largest instance (process count)
+
+/**
+ * @brief enumeration for objective of the search
+ *
+ */
+typedef enum OptimalObjective {
+
+    OPTIMAL_WAITING,    // minimum average waiting (same order as minimum total completion time)
+    OPTIMAL_WEIGHTED    // minimum weighted completion time (weight 1 / priority)
+
+} OptimalObjective;
+
+/**
+ * @brief structure for objective, node limit and thread count
+ *
+ */
+typedef struct OptimalOptions {
+
+    OptimalObjective objective; // objective of the search
+    long long nodeLimit;        // nodes to expand before giving up (0: no limit)
+    int jobs;                   // thread count (0: online processor count)
+
+} OptimalOptions;
+
+/**
+ * @brief structure for optimal order and its metrics
+ *
+ */
+typedef struct OptimalResult {
+
+    bool optimal;                       // search completed (false: best order found within the node limit)
+    OptimalObjective objective;         // objective of the search
+    int n;                              // process count
+    int order[OPTIMAL_MAX_PROCESS];     // process index (input array) in order of run
+    Time start[OPTIMAL_MAX_PROCESS];    // start time of each process (input array index)
+    double cost;                        // objective: total waiting or weighted completion time
+    double rootBound;                   // lower bound of the whole instance
+    double avg_waiting;                 // average waiting of the order
+    double avg_turnaround;              // average turnaround of the order
+    long long nodes;                    // nodes expanded
+
+} OptimalResult;
+
+/**
+ * @brief   search optimal non-preemptive schedule
+ *
+ * @param p     pointer for process structure (arrival, burst, priority)
+ * @param n     total process count (1 ~ `OPTIMAL_MAX_PROCESS`)
+ * @param opt   objective, node limit and thread count (NULL: average waiting, no limit)
+ * @param r     pointer for optimal order and its metrics
+ * @return  bool (false if the instance is too large or empty)
+ */
+bool solve_optimal(const Process *p, int n, const OptimalOptions *opt, OptimalResult *r);
+
+/**
+ * @brief   cost of a schedule in the objective of the search
+ *
+ * @param r pointer for optimal order and its metrics
+ * @param s pointer for schedule result of the same processes
+ * @return  double (total waiting or weighted completion time)
+ */
+double schedule_cost(const OptimalResult *r, const Schedule *s);
+
+/**
+ * @brief   optimality gap of a schedule: (cost - optimal cost) / optimal cost
+ *          a preemptive schedule can be under the non-preemptive optimum (negative gap)
+ *
+ * @param r pointer for optimal order and its metrics
+ * @param s pointer for schedule result of the same processes
+ * @return  double (0 if both costs are 0, INFINITY if only the optimal cost is 0)
+ */
+double optimal_gap(const OptimalResult *r, const Schedule *s);
+
+#endif
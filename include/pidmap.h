@@ -0,0 +1,94 @@
+/**
+ * @file    pidmap.h
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   process no. to dense slot index (open addressing hash, linear probing)
+ *          - real trace process no. are sparse (e.g. 183742), arrays are indexed by dense slot
+ *          - slot is given in insertion order: 0, 1, 2, ...
+ *          - `pid_hash()` is also used for the hashed color palette of the UI
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+#ifndef PIDMAP_H
+#define PIDMAP_H
+
+// standard library
+#include <stdbool.h>
+
+/**
+ * @brief pidmap.h variable info
+ *
+ *  type        name        pointer     info
+ *  #define     PIDMAP_LOAD n           maximum load factor (percent) before the table grows
+ *  PidMap      m           y           pointer for process no. index
+ *  int         pid         n           process no.
+ *  int         expected    n           expected process count
+ *
+ */
+
+#define PIDMAP_LOAD 50  // maximum load factor (percent) before the table grows
+
+/**
+ * @brief structure for process no. index
+ *
+ */
+typedef struct PidMap {
+
+    int *pid;       // process no. of each bucket
+    int *slot;      // dense slot of each bucket (-1 for empty bucket)
+    int capacity;   // bucket count (power of 2)
+    int count;      // number of process no. in the index
+
+} PidMap;
+
+/**
+ * @brief   hash of process no. (Fibonacci hashing, upper bits folded into the lower bits
+ *          so that the bucket index `hash & mask` spreads sequential process no.)
+ *
+ * @param pid   process no.
+ * @return  unsigned int
+ */
+static inline unsigned int pid_hash(int pid) {
+
+    unsigned int h = (unsigned int) pid * 2654435769u;
+    return h ^ (h >> 16);
+}
+
+/**
+ * @brief   initialize empty process no. index
+ *
+ * @param m         pointer for process no. index
+ * @param expected  expected process count
+ */
+void pidmap_init(PidMap *m, int expected);
+
+/**
+ * @brief   find dense slot of the process no.
+ *
+ * @param m     pointer for process no. index
+ * @param pid   process no.
+ * @return  int (slot, -1 if not found)
+ */
+int pidmap_find(const PidMap *m, int pid);
+
+/**
+ * @brief   insert process no. if not found
+ *
+ * @param m     pointer for process no. index
+ * @param pid   process no.
+ * @param added pointer for insertion result (true if new), can be NULL
+ * @return  int (slot of the process no.)
+ */
+int pidmap_insert(PidMap *m, int pid, bool *added);
+
+/**
+ * @brief   release memory of the process no. index
+ *
+ * @param m pointer for process no. index
+ */
+void pidmap_free(PidMap *m);
+
+#endif
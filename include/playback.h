@@ -0,0 +1,239 @@
+/**
+ * @file    playback.h
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   headless schedule playback exporter for CPU scheduler simulator
+ *          - draw the schedule step by step into one CPU image
+ *          - encode every step as a frame of animated GIF (msf_gif.h in raylib)
+ *          - or write every step as numbered PNG/QOI image
+ *          - frames are streamed to file, memory is bounded by a single frame
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+#ifndef PLAYBACK_H
+#define PLAYBACK_H
+
+// standard library
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// external library & user define library
+#include "main.h"
+#include "pidmap.h"
+#include "process.h"
+#include "report.h"
+#include "raylib.h"
+#include "external/msf_gif.h"
+
+/**
+ * @brief playback.h variable info
+ *
+ *  type        name            pointer     info
+ *  #define     FRAME_W         n           frame size: width
+ *  #define     FRAME_H         n           frame size: height
+ *  #define     GIF_BIT_DEPTH   n           maximum bit depth of GIF frame
+ *  int         playbackDelay   n           frame delay (1/100 second)
+ *  int         playbackEvery   n           time units per frame
+ *  Playback    pb              y           pointer for playback state
+ *  Schedule    s               y           pointer for schedule result
+ *  Time        k               n           present time of the playback
+ *
+ */
+
+#define FRAME_W         REPORT_IMG_W    // frame size: width
+#define FRAME_H         150             // frame size: height
+#define GIF_BIT_DEPTH   16              // maximum bit depth of GIF frame
+
+int playbackDelay = 10;                 // frame delay (1/100 second)
+int playbackEvery = 1;                  // time units per frame
+
+/**
+ * @brief structure for playback state
+ *
+ */
+typedef struct Playback {
+
+    Image frame;        // frame image (R8G8B8A8), updated step by step
+    Time *remain;       // remain time of each process (index: dense slot of `index`)
+    PidMap index;       // process no. to dense slot
+    int terminated;     // number of process terminated
+    long long segment;  // gantt chart segment of the present time
+
+} Playback;
+
+/**
+ * @brief   create playback state and draw static part: title and time axis
+ *          empty schedule (`t` or `segments` is 0) has the title and "empty schedule" only
+ *
+ * @param s     pointer for schedule result
+ * @param font  font with glyph images in CPU memory
+ * @return  Playback
+ */
+Playback begin_playback(const Schedule *s, Font font) {
+
+    Playback pb = { 0 };
+    char buf[32];
+
+    pb.frame  = GenImageColor(FRAME_W, FRAME_H, colorTag[0]);
+    pb.remain = malloc(sizeof(Time) * s->n);
+    pidmap_init(&pb.index, s->n);
+    for(int i = 0; i < s->n; i++)
+        pb.remain[pidmap_insert(&pb.index, s->result[i].processID, NULL)] = s->result[i].burst;
+
+    report_text(&pb.frame, font, s->algo, REPORT_MARGIN, 12, 32, GREEN);
+
+    // empty schedule: no time axis to scale the gantt chart to, the title frame only
+    if(s->t == 0 || s->segments == 0) {
+        report_text(&pb.frame, font, "empty schedule", REPORT_MARGIN + 120, 24, 16, RAYWHITE);
+        return pb;
+    }
+    float cell = (float) (FRAME_W - REPORT_MARGIN * 2) / s->t;
+
+    // time axis: same tick interval as the report
+    Time tick = 1;
+    while(tick * cell < 40) {
+        if(tick * 2 * cell >= 40)      tick *= 2;
+        else if(tick * 5 * cell >= 40) tick *= 5;
+        else                           tick *= 10;
+    }
+    for(Time i = 0; i <= s->t; i += tick) {
+        int tx = REPORT_MARGIN + (int) (i * cell);
+        ImageDrawLine(&pb.frame, tx, 96, tx, 100, LIGHTGRAY);
+        snprintf(buf, sizeof(buf), "%lld", i);
+        report_text(&pb.frame, font, buf, tx, 102, 16, LIGHTGRAY);
+    }
+
+    return pb;
+}
+
+/**
+ * @brief   draw one time unit of the playback, only changed area is drawn
+ *
+ * @param pb    pointer for playback state
+ * @param s     pointer for schedule result
+ * @param font  font with glyph images in CPU memory
+ * @param k     present time of the playback
+ * @return  bool (true if the frame is ready to be written)
+ */
+bool draw_playback_step(Playback *pb, const Schedule *s, Font font, Time k) {
+
+    // segment of the present time: steps go forward from time 0
+    while(pb->segment + 1 < s->segments && s->gantt[pb->segment + 1].start <= k)
+        pb->segment++;
+
+    float cell = (float) (FRAME_W - REPORT_MARGIN * 2) / s->t;
+    int pid    = s->segments > 0 ? s->gantt[pb->segment].processID : IDLE_PID;
+    int bx     = REPORT_MARGIN + (int) (k * cell);
+    int bw     = REPORT_MARGIN + (int) ((k + 1) * cell) - bx;
+    char buf[128];
+
+    // gantt chart cell of the present time
+    if(pid != IDLE_PID) {
+        ImageDrawRectangle(&pb->frame, bx, 68, bw > 0 ? bw : 1, 28, pid_color(pid));
+        if(--pb->remain[pidmap_find(&pb->index, pid)] == 0)
+            pb->terminated++;
+    }
+
+    // skip status line if this time unit is not written as a frame
+    if((k + 1) % playbackEvery != 0 && k + 1 != s->t)
+        return false;
+
+    // status line: present time, running process and terminated count
+    if(pid == IDLE_PID)
+        snprintf(buf, sizeof(buf), "t: %lld / %lld    running: idle    terminated: %d / %d", k + 1, s->t, pb->terminated, s->n);
+    else
+        snprintf(buf, sizeof(buf), "t: %lld / %lld    running: P%d    terminated: %d / %d", k + 1, s->t, pid, pb->terminated, s->n);
+    ImageDrawRectangle(&pb->frame, REPORT_MARGIN + 120, 12, FRAME_W - REPORT_MARGIN * 2 - 120, 32, colorTag[0]);
+    report_text(&pb->frame, font, buf, REPORT_MARGIN + 120, 24, 16, RAYWHITE);
+
+    return true;
+}
+
+/**
+ * @brief   release memory of the playback state
+ *
+ * @param pb    pointer for playback state
+ */
+void end_playback(Playback *pb) {
+
+    UnloadImage(pb->frame);
+    free(pb->remain);
+    pidmap_free(&pb->index);
+}
+
+/**
+ * @brief   export playback of the schedule as animated GIF
+ *          every frame is written to file right after it is drawn, empty schedule is one title frame
+ *
+ * @param s         pointer for schedule result
+ * @param font      font with glyph images in CPU memory
+ * @param fileName  output file path (.gif)
+ * @return  bool
+ */
+bool export_playback_gif(const Schedule *s, Font font, const char *fileName) {
+
+    FILE *fp = fopen(fileName, "wb");
+    if(fp == NULL)
+        return false;
+
+    MsfGifState gif = { 0 };
+    Playback pb = begin_playback(s, font);
+    bool ok     = msf_gif_begin_to_file(&gif, pb.frame.width, pb.frame.height, (MsfGifFileWriteFunc) fwrite, fp);
+
+    for(Time k = 0; k < s->t && ok; k++) {
+        if(draw_playback_step(&pb, s, font, k))
+            ok = msf_gif_frame_to_file(&gif, pb.frame.data, playbackDelay, GIF_BIT_DEPTH, pb.frame.width * 4);
+    }
+    if(s->t == 0 && ok)
+        ok = msf_gif_frame_to_file(&gif, pb.frame.data, playbackDelay, GIF_BIT_DEPTH, pb.frame.width * 4);
+    ok = msf_gif_end_to_file(&gif) && ok;
+
+    // memory allocate disable
+    end_playback(&pb);
+    fclose(fp);
+
+    return ok;
+}
+
+/**
+ * @brief   export playback of the schedule as image sequence
+ *          `fileName` is `<prefix>.<ext>`, frames are `<prefix>_<time>.<ext>`
+ *          empty schedule is one title frame `<prefix>_000000.<ext>`
+ *
+ * @param s         pointer for schedule result
+ * @param font      font with glyph images in CPU memory
+ * @param fileName  output file path (.png or .qoi)
+ * @return  bool
+ */
+bool export_playback_frames(const Schedule *s, Font font, const char *fileName) {
+
+    const char *ext = strrchr(fileName, '.');
+    int prefix      = (int) (ext - fileName);
+    char path[PATH_MAX_W * 2];
+
+    Playback pb = begin_playback(s, font);
+    bool ok     = true;
+
+    for(Time k = 0; k < s->t && ok; k++) {
+        if(draw_playback_step(&pb, s, font, k)) {
+            snprintf(path, sizeof(path), "%.*s_%06lld%s", prefix, fileName, k + 1, ext);
+            ok = ExportImage(pb.frame, path);
+        }
+    }
+    if(s->t == 0) {
+        snprintf(path, sizeof(path), "%.*s_%06d%s", prefix, fileName, 0, ext);
+        ok = ExportImage(pb.frame, path);
+    }
+
+    // memory allocate disable
+    end_playback(&pb);
+
+    return ok;
+}
+
+#endif
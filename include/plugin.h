@@ -0,0 +1,84 @@
+/**
+ * @file    plugin.h
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   runtime-loadable scheduling policy plugin of libcpusched
+ *          - plugin is a shared object (.so / .dll) exporting `cpusched_plugin()`
+ *          - `cpusched_plugin()` returns the `Policy` of the plugin for the given ABI version
+ *          - loaded policy runs on the same engine as the built-in algorithms (`run_policy()`)
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+#ifndef PLUGIN_H
+#define PLUGIN_H
+
+// standard library
+#include <stdbool.h>
+
+// user define library
+#include "policy.h"
+
+/**
+ * @brief plugin.h variable info
+ *
+ *  type        name                    pointer     info
+ *  #define     CPUSCHED_PLUGIN_ABI     n           plugin ABI version (`Process` and `Policy` layout)
+ *  #define     CPUSCHED_PLUGIN_ENTRY   n           symbol name of the plugin entry function
+ *  #define     CPUSCHED_EXPORT         n           export attribute for the plugin entry function
+ *  PluginEntry entry                   y           plugin entry function
+ *  Plugin      plugin                  y           pointer for loaded plugin
+ *  char        path                    y           plugin file path
+ *
+ *  plugin example (build: cc -shared -fPIC -Iinclude my_policy.c -o my_policy.so):
+ *      static int my_pick(void *data, const Process *const *ready, int count, const Process *cur, Time time);
+ *      static const Policy policy = { .name = "MINE", .pick_next = my_pick };
+ *      CPUSCHED_EXPORT const Policy* cpusched_plugin(int abi) {
+ *          return abi == CPUSCHED_PLUGIN_ABI ? &policy : NULL;
+ *      }
+ *
+ */
+
+#define CPUSCHED_PLUGIN_ABI     2                   // plugin ABI version
+#define CPUSCHED_PLUGIN_ENTRY   "cpusched_plugin"   // symbol name of the plugin entry function
+
+#ifdef _WIN32
+    #define CPUSCHED_EXPORT __declspec(dllexport)
+#else
+    #define CPUSCHED_EXPORT __attribute__((visibility("default")))
+#endif
+
+// plugin entry function: policy for the ABI version, NULL if the ABI is not supported
+typedef const Policy* (*PluginEntry)(int abi);
+
+/**
+ * @brief structure for loaded plugin
+ *
+ */
+typedef struct Plugin {
+
+    void *handle;           // shared object handle
+    const Policy *policy;   // policy of the plugin (valid until `unload_plugin()`)
+
+} Plugin;
+
+/**
+ * @brief   load scheduling policy plugin from shared object
+ *          path without directory is searched by the system loader, use `./name.so`
+ *
+ * @param path      plugin file path
+ * @param plugin    pointer for loaded plugin
+ * @return  bool (false if the file, the entry function or the ABI version is invalid)
+ */
+bool load_plugin(const char *path, Plugin *plugin);
+
+/**
+ * @brief   unload scheduling policy plugin
+ *
+ * @param plugin    pointer for loaded plugin
+ */
+void unload_plugin(Plugin *plugin);
+
+#endif
@@ -0,0 +1,86 @@
+/**
+ * @file    policy.h
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   scheduling policy interface of libcpusched
+ *          - a policy is a table of hooks, one engine runs every policy
+ *          - built-in algorithms (FCFS ~ SRT) are policies too: `builtinPolicy`
+ *          - every hook is optional, NULL hook means the default behavior
+ *          - `pick_next` is a batch hook: one call per scheduling event with the whole
+ *            ready queue, not one call per time unit (cheap for runtime-loaded plugins)
+ * @version 0.2
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+#ifndef POLICY_H
+#define POLICY_H
+
+// standard library
+#include <stdbool.h>
+
+// user define library
+#include "process.h"
+
+/**
+ * @brief policy.h variable info
+ *
+ *  type        name            pointer     info
+ *  char        name            y           algorithm name (saved to `Schedule`)
+ *  void        data            y           user data passed to every hook
+ *  int         quantum         n           time quantum passed to `on_tick_expire`
+ *  Process     p               y           process entering the ready queue
+ *  Process     ready           y           processes in the ready queue (in enqueue order)
+ *  int         count           n           number of process in the ready queue
+ *  Time        time            n           present time of the engine
+ *  Process     next            y           process to be dispatched next
+ *  Process     cur             y           running process (NULL at dispatch)
+ *  int         q               n           time quantum
+ *
+ *  hook            called                                      NULL means
+ *  on_arrival      process enters the ready queue (arrival or  0: enqueue order only (FIFO)
+ *                  preempted), returns ready queue sort key
+ *                  (smaller runs first, enqueue order for the same key)
+ *  pick_next       dispatch (`cur` is NULL) and each time the  smallest key of `on_arrival`
+ *                  ready queue changes while `cur` runs,
+ *                  returns index of `ready` to run,
+ *                  -1 keeps `cur` running (no preemption)
+ *  should_preempt  each time unit while processes are ready,   never preempt
+ *                  only if `pick_next` is NULL
+ *  on_tick_expire  each time unit, true if `cur` used up       expire after `quantum` time
+ *                  its time quantum                            units (never if `quantum` is 0)
+ *
+ */
+
+/**
+ * @brief structure for scheduling policy
+ *
+ */
+typedef struct Policy {
+
+    const char *name;   // algorithm name (saved to `Schedule`)
+    void *data;         // user data passed to every hook
+    int quantum;        // time quantum passed to `on_tick_expire`
+
+    long long (*on_arrival)(void *data, const Process *p);
+    int (*pick_next)(void *data, const Process *const *ready, int count, const Process *cur, Time time);
+    bool (*should_preempt)(void *data, const Process *next, const Process *cur);
+    bool (*on_tick_expire)(void *data, const Process *cur, int q);
+
+} Policy;
+
+/**
+ * @brief   run scheduling policy and save result
+ *          same engine as the built-in algorithms, `pick_next` policy keeps
+ *          the ready queue as an array in enqueue order instead of a heap
+ *
+ * @param pol   pointer for scheduling policy
+ * @param p     pointer for process structure
+ * @param n     total process count
+ * @param t     total burst time
+ * @param s     pointer for schedule result save
+ */
+void run_policy(const Policy *pol, Process *p, int n, Time t, Schedule *s);
+
+#endif
@@ -3,7 +3,7 @@
  * @author  Mindou (minsu5875@naver.com)
  * @brief   CPU scheduler simulator process header
  * @version 0.1
- * @date    (frist date: 2023-05-03, last date: 2023-05-28)
+ * @date    (frist date: 2023-05-03, last date: 2026-10-17)
  * 
  * @copyright Copyright (c) 2023 Minsu Bak
  * 
@@ -14,34 +14,51 @@
 // standard libaray
 #include <stdbool.h>
 
-// external library & user define library
-#include "raylib.h"
-#include "queue.h"
-#include "main.h"
-
 /**
  * @brief process.h variable info
  *  
  *  type        name        pointer info
  *  #define     CHECK       n       debug flag for process status
+ *  #define     IDLE_PID    n       process no. of idle time units in the gantt chart
+ *  Time        -           n       64-bit time value (time units, counters and sums of time)
+ *  #define     TIME_MAX    n       largest time value
+ *  #define     ARRIVAL_BITS    n   arrival bits of the priority key of PP
+ *  #define     ARRIVAL_LIMIT   n   arrival of a workload is 0 ~ ARRIVAL_LIMIT - 1
+ *  #define     PRIORITY_LIMIT  n   priority of a workload is -PRIORITY_LIMIT ~ PRIORITY_LIMIT - 1
  *  int         processID   n       process no.
- *  int         arrival     n       process arrival time
- *  int         burst       n       process burst time(equal remain, but not using calulate)
- *  int         remain      n       process task remain time(equal burst, but using calculate)
  *  int         priority    n       process priority
- *  int         waiting     n       record process waiting time
- *  int         timeout     n       record process time-out time
- *  int         execute     n       record process execute time
+ *  Time        arrival     n       process arrival time
+ *  Time        burst       n       process burst time(equal remain, but not using calulate)
+ *  Time        remain      n       process task remain time(equal burst, but using calculate)
+ *  Time        waiting     n       record process waiting time
+ *  Time        timeout     n       record process time-out time
+ *  Time        execute     n       record process execute time
  *  Process     p           y       pointer for process structure (result array)
- *  Process     g           y       pointer for process structure (gannt chart array)
- *  Texture2D   texture     n       card image
- *  int         t           n       total busrt time
+ *  Segment     g           y       pointer for gantt chart segment array
+ *  long long   segments    n       gantt chart segment count
+ *  Schedule    s           y       pointer for schedule structure (scheduling result)
+ *  Metrics     m           n       structure for scheduling metrics
+ *  Time        t           n       total gantt chart length
  *  int         n           n       total process count
+ *  Time        tt          n       the sum of turnaround
+ *  Time        tw          n       the sum of waiting
+ *  Time        tr          n       the sum of response
  *  char        algo        y       algorithm name string array
  * 
  */
 
 #define CHECK   false
+#define IDLE_PID    -1  // process no. of idle time units in the gantt chart
+
+// 64-bit time value: microsecond traces pass 2^31 time units in about 36 minutes
+typedef long long Time;
+
+#define TIME_MAX    0x7fffffffffffffffLL    // largest time value
+
+// PP orders the ready queue by one 64-bit key: priority in the upper 24 bits, arrival in the lower 40 bits
+#define ARRIVAL_BITS    40                              // arrival bits of the priority key of PP
+#define ARRIVAL_LIMIT   (1LL << ARRIVAL_BITS)           // 2^40 time units (12.7 days in microseconds)
+#define PRIORITY_LIMIT  (1 << (63 - ARRIVAL_BITS))      // -2^23 ~ 2^23 - 1
 
 /**
  * @brief structure for process
@@ -50,59 +67,98 @@
 typedef struct Process{
 
     int processID;  // process no.
-    int arrival;    // process arrival time
-    int burst;      // process burst time(equal remain, but not using calculate)
-    int remain;     // process task remain time(equal burst, but using calculate)
     int priority;   // process priority
-    int waiting;    // record process waiting time
-    int timeout;    // record process time-out time
-    int execute;    // record process execute time
+    Time arrival;   // process arrival time
+    Time burst;     // process burst time(equal remain, but not using calculate)
+    Time remain;    // process task remain time(equal burst, but using calculate)
+    Time waiting;   // record process waiting time
+    Time timeout;   // record process time-out time
+    Time execute;   // record process execute time
 
 } Process;
 
 /**
- * @brief draw gantt chart and result
+ * @brief structure for gantt chart segment (run-length): one process runs, or the CPU is idle,
+ *        from `start` until the start of the next segment (the last one until the end of the chart)
+ * 
+ */
+typedef struct Segment {
+
+    Time start;     // start time
+    int processID;  // process no. (`IDLE_PID` if the CPU is idle)
+
+} Segment;
+
+/**
+ * @brief structure for scheduling result
+ * 
+ */
+typedef struct Schedule {
+
+    const char *algo;       // algorithm name
+    Process *result;        // processes in order of termination
+    Segment *gantt;         // gantt chart segments in time order (process differs from the previous one)
+    long long segments;     // gantt chart segment count
+    int n;                  // total process count
+    Time t;                 // total gantt chart length (burst time and idle time)
+    Time total_turnaround;  // the sum of turnaround
+    Time total_waiting;     // the sum of waiting
+    Time total_response;    // the sum of response
+
+} Schedule;
+
+/**
+ * @brief structure for scheduling metrics
+ * 
+ */
+typedef struct Metrics {
+
+    double avg_turnaround;  // average turnaround
+    double avg_waiting;     // average waiting
+    double avg_response;    // average response
+    double throughput;      // terminated process per time unit
+
+} Metrics;
+
+/**
+ * @brief save scheduling result to the schedule structure
+ *        the schedule takes ownership of `p` and `g`
  * 
+ * @param s         pointer for schedule structure
+ * @param algo      algorithm name string array
  * @param p         pointer for process structure (result array)
- * @param g         pointer for process structure (gannt chart array)
- * @param texture   card image
- * @param t         total busrt time
+ * @param g         pointer for gantt chart segment array
+ * @param segments  gantt chart segment count
  * @param n         total process count
- * @param algo      algorithm name string array
+ * @param t         total gantt chart length
+ * @param tt        the sum of turnaround
+ * @param tw        the sum of waiting
+ * @param tr        the sum of response
+ */
+void save_schedule(Schedule *s, const char *algo, Process *p, Segment *g, long long segments, int n, Time t, Time tt, Time tw, Time tr);
+
+/**
+ * @brief release memory of the schedule structure
+ * 
+ * @param s pointer for schedule structure
+ */
+void free_schedule(Schedule *s);
+
+/**
+ * @brief   end time of the gantt chart segment (start of the next segment, or the chart length)
+ * 
+ * @param s pointer for schedule structure
+ * @param i segment no.
+ * @return  Time
+ */
+Time segment_end(const Schedule *s, long long i);
+
+/**
+ * @brief   calculate average metrics of the schedule
+ * 
+ * @param s pointer for schedule structure
+ * @return  Metrics 
  */
-void draw_everything(Process *p, Process *g, Texture2D texture, int t, int n, char* algo) {
-
-    DrawText(algo, SCREEN_W * 0.2 + 3, 80, 40, GREEN);
-
-    for(int i = 0; i < t; i++) {
-        
-        // draw textrue, texture size, draw position, reference point, rotation, color
-        DrawTexturePro(
-        texture,\
-        (Rectangle) {.x = 0, .y = 0, .width = 10, .height = 16},\
-        (Rectangle) {SCREEN_W * 0.1 + 103 + (i * 12), 140, 10, 16},\
-        (Vector2) { 0, 0 },\
-        0,\
-        colorTag[g[i].processID + 2]);
-
-        // draw text, x position, y position, font size, text color
-        DrawText(TextFormat("%d", g[i].processID), SCREEN_W * 0.1 + 105 + (i * 12), 160, 10, WHITE);
-    }
-
-    // draw text, x position, y position, font size, text color
-    DrawText("index\t\t\t\tPID\t\t\t\tarrival\t\t\t\tburst\t\t\t\tprioity\t\t\t\twaitng\t\t\tturnaround\n", SCREEN_W * 0.2, SCREEN_H * 0.3, 20, GREEN);
-    
-    for(int i = 0; i < n; i++) {
-
-        // draw text, x position, y position, font size, text color
-        DrawText(TextFormat("%d", i),                            SCREEN_W * 0.2 + 1  , SCREEN_H * 0.3 + (i * 20) + 30, 20, GREEN);
-        DrawText(TextFormat("%d", p[i].processID),               SCREEN_W * 0.2 + 100, SCREEN_H * 0.3 + (i * 20) + 30, 20, GREEN);
-        DrawText(TextFormat("%d", p[i].arrival),                 SCREEN_W * 0.2 + 185, SCREEN_H * 0.3 + (i * 20) + 30, 20, GREEN);
-        DrawText(TextFormat("%d", p[i].burst),                   SCREEN_W * 0.2 + 302, SCREEN_H * 0.3 + (i * 20) + 30, 20, GREEN);
-        DrawText(TextFormat("%d", p[i].priority),                SCREEN_W * 0.2 + 408, SCREEN_H * 0.3 + (i * 20) + 30, 20, GREEN);
-        DrawText(TextFormat("%d", p[i].waiting),                 SCREEN_W * 0.2 + 522, SCREEN_H * 0.3 + (i * 20) + 30, 20, GREEN);
-        DrawText(TextFormat("%d",(p[i].execute + p[i].waiting)), SCREEN_W * 0.2 + 620, SCREEN_H * 0.3 + (i * 20) + 30, 20, GREEN);
-    }
-}
+Metrics get_metrics(const Schedule *s);
 
 #endif
\ No newline at end of file
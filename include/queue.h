@@ -3,7 +3,7 @@
  * @author  Mindou (minsu5875@naver.com)
  * @brief   basic queue structure / edit for CPU scheduler simulator
  * @version 0.1
- * @date    (last update: 2023-05-31)
+ * @date    (last update: 2026-10-17)
  * 
  * @copyright Copyright (c) 2022 Minsu Bak
  * 
@@ -11,11 +11,7 @@
 #ifndef QUEUE_H
 #define QUEUE_H
 
-// standard libraray
-#include <stdio.h>
-#include <stdlib.h>
-
-// external libraray & user define library
+// user define library
 #include "process.h"
 
 /**
@@ -45,10 +41,7 @@ typedef struct QueueType {
  * 
  * @param q pointer for queue structure
  */
-void init_queue(QueueType *q) {
-    
-    q->front = q->rear = 0;
-}
+void init_queue(QueueType *q);
 
 /**
  * @brief   check the queue status is empty
@@ -56,10 +49,7 @@ void init_queue(QueueType *q) {
  * @param q pointer for queue structure
  * @return  int 
  */
-int is_empty_q(QueueType *q) {
-
-    return (q->front == q->rear);
-}
+int is_empty_q(QueueType *q);
 
 /**
  * @brief   check the queue status is full
@@ -67,10 +57,7 @@ int is_empty_q(QueueType *q) {
  * @param q pointer for queue structure
  * @return  int 
  */
-int is_full_q(QueueType *q) {
-
-    return (q->front == (q->rear+1) % MAX);
-}
+int is_full_q(QueueType *q);
 
 /**
  * @brief   insert new process data into queue
@@ -78,53 +65,31 @@ int is_full_q(QueueType *q) {
  * @param q     pointer for queue structure
  * @param item  insert target
  */
-void enqueue(QueueType *q, Process item) {
-
-    if(is_full_q(q)) {
-        fprintf(stderr, "queue is full!\n");
-        exit(1);
-    }
-    q->rear = (q->rear + 1) % MAX;
-    q->queue[q->rear] = item;
-}
+void enqueue(QueueType *q, Process item);
 
 /**
  * @brief   extract process data from the queue
  * 
  * @param q pointer for queue structure
- * @return  Process
+ * @return  Process* (NULL if the queue is empty)
  */
-Process* dequeue(QueueType *q) {
-
-    if(is_empty_q(q)) {
-        fprintf(stderr, "queue is empty!\n");
-        return;
-    }
-    q->front = (q->front + 1) % MAX;
-    return &q->queue[q->front];
-}
+Process* dequeue(QueueType *q);
 
 /**
  * @brief   check process data from the queue
  * 
  * @param q pointer for queue structure
- * @return Process 
+ * @return Process (`IDLE_PID` process if the queue is empty)
  */
-Process peek(QueueType *q) {
-
-    if(is_empty_q(q)) return;
-    return q->queue[(q->front + 1) % MAX];
-}
+Process peek(QueueType *q);
 
 /**
  * @brief   sort processes in the queue using with qsort()
+ *          wrapped around queue is sorted in ring order
  * 
  * @param q pointer for queue structure
  * @param compare compare target
  */
-void sort(QueueType *q, int(*compare)(const void* a, const void* b)) {
-
-    qsort(q->queue + q->front + 1, q->rear-q->front, sizeof(Process), compare);
-}
+void sort(QueueType *q, int(*compare)(const void* a, const void* b));
 
 #endif
\ No newline at end of file
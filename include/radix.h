@@ -0,0 +1,61 @@
+/**
+ * @file    radix.h
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   parallel LSD radix sort of process data by arrival time
+ *          - stable: processes with the same arrival keep their order (PID order of the workload file)
+ *          - workload loaders sort once, the engine only checks the order before each run
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+#ifndef RADIX_H
+#define RADIX_H
+
+// standard library
+#include <stdbool.h>
+
+// user define library
+#include "process.h"
+
+/**
+ * @brief radix.h variable info
+ *
+ *  type        name            pointer     info
+ *  #define     RADIX_BITS      n           bits of one digit (one pass for each digit)
+ *  #define     RADIX_GRAIN     n           minimum process count for one worker thread
+ *  #define     RADIX_THREADS   n           maximum worker thread count
+ *  Process     p               y           pointer for process structure
+ *  int         n               n           total process count
+ *  int         threads         n           worker thread count (0: by process count and CPU count)
+ *
+ */
+
+#define RADIX_BITS      8           // bits of one digit
+#define RADIX_GRAIN     (1 << 16)   // minimum process count for one worker thread
+#define RADIX_THREADS   64          // maximum worker thread count
+
+/**
+ * @brief   check process data is sorted by arrival
+ *
+ * @param p pointer for process structure
+ * @param n total process count
+ * @return  bool
+ */
+bool sorted_by_arrival(const Process *p, int n);
+
+/**
+ * @brief   stable sort process data by arrival (LSD radix sort, in place)
+ *          digits equal in every process are skipped,
+ *          each pass counts and scatters in parallel on `threads` chunks
+ *
+ * @param p         pointer for process structure
+ * @param n         total process count
+ * @param threads   worker thread count (0: by process count and CPU count)
+ * @return  bool (false if not enough memory, `p` is not changed)
+ */
+bool sort_by_arrival(Process *p, int n, int threads);
+
+#endif
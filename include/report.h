@@ -0,0 +1,411 @@
+/**
+ * @file    report.h
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   headless report renderer for CPU scheduler simulator
+ *          - draw gantt chart, result table and summary into CPU image
+ *          - export report image as PNG or QOI without `InitWindow()`
+ *          - render many reports in parallel with worker threads
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+#ifndef REPORT_H
+#define REPORT_H
+
+// standard library
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// external library & user define library
+#include "cache.h"
+#include "main.h"
+#include "policy.h"
+#include "process.h"
+#include "results.h"
+#include "scheduler.h"
+#include "workload.h"
+#include "raylib.h"
+
+/**
+ * @brief report.h variable info
+ *
+ *  type        name            pointer     info
+ *  #define     REPORT_IMG_W    n           report image size: width
+ *  #define     REPORT_IMG_H    n           report image size: height
+ *  #define     REPORT_FONT     n           default bitmap font (AngelCode BMFont)
+ *  #define     REPORT_MARGIN   n           report image margin
+ *  #define     ROW_H           n           result table row height
+ *  #define     PATH_MAX_W      n           maximum length of output file path
+ *  Font        font            n           font with glyph images in CPU memory (no texture)
+ *  Image       image           n           report image (R8G8B8A8)
+ *  Schedule    s               y           pointer for schedule result
+ *  Workload    w               y           pointer for workload array
+ *  ExportFunc  render          y           function to render and export one schedule
+ *  ReportBatch batch           y           shared state for report worker threads
+ *  int         jobs            n           worker thread count
+ *
+ */
+
+#define REPORT_IMG_W    SCREEN_W                        // report image size: width
+#define REPORT_IMG_H    SCREEN_H                        // report image size: height
+#define REPORT_FONT     "res/fonts/neodgm-16pt.fnt"     // default bitmap font
+#define REPORT_MARGIN   40                              // report image margin
+#define ROW_H           20                              // result table row height
+#define PATH_MAX_W      512                             // maximum length of output file path
+
+// PNG row filter of stb_image_write (built into raylib), -1 tries every filter for each row
+extern int stbi_write_force_png_filter;
+
+// function to render and export one schedule to file
+typedef bool (*ExportFunc)(const Schedule *s, Font font, const char *fileName);
+
+/**
+ * @brief structure for shared state of report worker threads
+ *
+ */
+typedef struct ReportBatch {
+
+    Workload *w;            // workload array
+    int count;              // workload count
+    int algo;               // algorithm index, -1 for every algorithm
+    const Policy *policy;   // policy plugin, run instead of the built-in algorithms if not NULL
+    ResultCache *cache;     // result cache of the built-in algorithms (NULL for no cache)
+    const char *dir;        // output directory
+    const char *ext;        // output file extension (".png", ".qoi", ".gif" or ".cpsr")
+    ExportFunc render;      // function to render and export one schedule
+    Font font;              // shared read-only font
+    int next;               // next job index
+    int failed;             // failed job count
+    pthread_mutex_t lock;   // lock for `next` and `failed`
+
+} ReportBatch;
+
+/**
+ * @brief   load AngelCode BMFont into CPU memory
+ *          `LoadFont()` uploads texture, so it can't be used without `InitWindow()`
+ *
+ * @param fileName  font descriptor (.fnt) path
+ * @return  Font (glyphCount is 0 if the font can't be loaded)
+ */
+Font load_report_font(const char *fileName) {
+
+    Font font = { 0 };
+
+    char *text = LoadFileText(fileName);
+    if(text == NULL)
+        return font;
+
+    int lineHeight = 0, base = 0, count = 0;
+    char page[PATH_MAX_W] = { 0 };
+    char *c;
+
+    // read font header
+    if((c = strstr(text, "lineHeight=")) != NULL)
+        sscanf(c, "lineHeight=%d base=%d", &lineHeight, &base);
+    if((c = strstr(text, "file=\"")) != NULL)
+        sscanf(c, "file=\"%511[^\"]\"", page);
+    if((c = strstr(text, "chars count=")) != NULL)
+        sscanf(c, "chars count=%d", &count);
+
+    Image atlas = LoadImage(TextFormat("%s/%s", GetDirectoryPath(fileName), page));
+    if(atlas.data == NULL || count <= 0) {
+        UnloadImage(atlas);
+        UnloadFileText(text);
+        return font;
+    }
+
+    font.baseSize = lineHeight;
+    font.glyphs   = calloc(count, sizeof(GlyphInfo));
+    font.recs     = calloc(count, sizeof(Rectangle));
+
+    // read glyphs, only Latin-1 range is used by the report
+    for(c = strstr(text, "char id="); c != NULL; c = strstr(c + 1, "char id=")) {
+
+        int id, x, y, w, h, ox, oy, adv;
+        if(sscanf(c, "char id=%d x=%d y=%d width=%d height=%d xoffset=%d yoffset=%d xadvance=%d",
+                  &id, &x, &y, &w, &h, &ox, &oy, &adv) != 8 || id > 0xff || font.glyphCount == count)
+            continue;
+
+        int i = font.glyphCount++;
+        font.recs[i]             = (Rectangle) { x, y, w, h };
+        font.glyphs[i].value     = id;
+        font.glyphs[i].offsetX   = ox;
+        font.glyphs[i].offsetY   = oy;
+        font.glyphs[i].advanceX  = adv;
+        font.glyphs[i].image     = ImageFromImage(atlas, font.recs[i]);
+    }
+
+    UnloadImage(atlas);
+    UnloadFileText(text);
+
+    return font;
+}
+
+/**
+ * @brief   unload font loaded with `load_report_font()`
+ *
+ * @param font  font with glyph images in CPU memory
+ */
+void unload_report_font(Font font) {
+
+    for(int i = 0; i < font.glyphCount; i++)
+        UnloadImage(font.glyphs[i].image);
+    free(font.glyphs);
+    free(font.recs);
+}
+
+/**
+ * @brief   draw text into image, skip if the font is not loaded
+ *
+ * @param image pointer for destination image
+ * @param font  font with glyph images in CPU memory
+ * @param text  text to draw
+ * @param x     x position
+ * @param y     y position
+ * @param size  font size
+ * @param color text color
+ */
+void report_text(Image *image, Font font, const char *text, int x, int y, int size, Color color) {
+
+    if(font.glyphCount > 0)
+        ImageDrawTextEx(image, font, text, (Vector2) { x, y }, size, 0, color);
+}
+
+/**
+ * @brief   render gantt chart, result table and summary into CPU image
+ *          uses only `Image*` functions, safe to call from worker threads
+ *          empty schedule (`t` or `segments` is 0) is rendered as title and "empty schedule" only
+ *
+ * @param s     pointer for schedule result
+ * @param font  font with glyph images in CPU memory
+ * @return  Image
+ */
+Image render_report(const Schedule *s, Font font) {
+
+    Image image = GenImageColor(REPORT_IMG_W, REPORT_IMG_H, colorTag[0]);
+    char buf[128];
+
+    int   x0     = REPORT_MARGIN;
+    int   width  = REPORT_IMG_W - REPORT_MARGIN * 2;
+    int   gy     = 110;     // gantt chart y position
+    int   gh     = 28;      // gantt chart height
+
+    // empty schedule (no process, or the run failed): no time axis to scale the gantt chart to
+    if(s->t == 0 || s->segments == 0) {
+        report_text(&image, font, s->algo, x0, 30, 32, GREEN);
+        snprintf(buf, sizeof(buf), "process: %d    empty schedule", s->n);
+        report_text(&image, font, buf, x0, 76, 16, LIGHTGRAY);
+        return image;
+    }
+    float cell = (float) width / s->t;
+
+    // title & overview
+    report_text(&image, font, s->algo, x0, 30, 32, GREEN);
+    snprintf(buf, sizeof(buf), "process: %d    total time: %lld", s->n, s->t);
+    report_text(&image, font, buf, x0, 76, 16, LIGHTGRAY);
+
+    // gantt chart: one block for each segment (run of same process)
+    for(long long k = 0; k < s->segments; k++) {
+        Time i = s->gantt[k].start, j = segment_end(s, k);
+
+        int pid = s->gantt[k].processID;
+        int bx  = x0 + (int) (i * cell);
+        int bw  = x0 + (int) (j * cell) - bx;
+        if(pid == IDLE_PID)
+            continue;   // idle time: empty block
+        ImageDrawRectangle(&image, bx, gy, bw > 1 ? bw - 1 : 1, gh, pid_color(pid));
+
+        snprintf(buf, sizeof(buf), "%d", pid);
+        if(bw >= (int) strlen(buf) * 8 + 2)
+            report_text(&image, font, buf, bx + 2, gy + 6, 16, BLACK);
+    }
+
+    // time axis: tick interval is 1, 2, 5 x 10^k and at least 40 pixel
+    Time tick = 1;
+    while(tick * cell < 40) {
+        if(tick * 2 * cell >= 40)      tick *= 2;
+        else if(tick * 5 * cell >= 40) tick *= 5;
+        else                           tick *= 10;
+    }
+    for(Time i = 0; i <= s->t; i += tick) {
+        int tx = x0 + (int) (i * cell);
+        ImageDrawLine(&image, tx, gy + gh, tx, gy + gh + 4, LIGHTGRAY);
+        snprintf(buf, sizeof(buf), "%lld", i);
+        report_text(&image, font, buf, tx, gy + gh + 6, 16, LIGHTGRAY);
+    }
+
+    // result table
+    const char *header[] = { "index", "PID", "arrival", "burst", "priority", "waiting", "turnaround" };
+    const int   column[] = { 0, 100, 200, 310, 420, 530, 640 };
+    int ty   = 190;
+    int rows = (REPORT_IMG_H - ty - 90) / ROW_H;
+
+    for(int k = 0; k < 7; k++)
+        report_text(&image, font, header[k], x0 + column[k], ty, 16, GREEN);
+    ImageDrawLine(&image, x0, ty + ROW_H - 2, REPORT_IMG_W - REPORT_MARGIN, ty + ROW_H - 2, DARKGREEN);
+
+    for(int i = 0; i < s->n && i < rows; i++) {
+        const Process *p = &s->result[i];
+        Time value[] = { i, p->processID, p->arrival, p->burst, p->priority, p->waiting, p->execute + p->waiting };
+
+        for(int k = 0; k < 7; k++) {
+            snprintf(buf, sizeof(buf), "%lld", value[k]);
+            report_text(&image, font, buf, x0 + column[k], ty + (i + 1) * ROW_H, 16, GREEN);
+        }
+    }
+    if(s->n > rows) {
+        snprintf(buf, sizeof(buf), "... %d more", s->n - rows);
+        report_text(&image, font, buf, x0, ty + (rows + 1) * ROW_H, 16, GRAY);
+    }
+
+    // summary overlay
+    int oy = REPORT_IMG_H - 70;
+    ImageDrawRectangle(&image, x0, oy, width, 40, colorTag[1]);
+    Metrics m = get_metrics(s);
+    snprintf(buf, sizeof(buf), "avg waiting: %.2f    avg turnaround: %.2f    avg response: %.2f    throughput: %.3f",
+             m.avg_waiting, m.avg_turnaround, m.avg_response, m.throughput);
+    report_text(&image, font, buf, x0 + 12, oy + 12, 16, RAYWHITE);
+
+    return image;
+}
+
+/**
+ * @brief   render report and export to file (.png or .qoi)
+ *
+ * @param s         pointer for schedule result
+ * @param font      font with glyph images in CPU memory
+ * @param fileName  output file path
+ * @return  bool
+ */
+bool export_report(const Schedule *s, Font font, const char *fileName) {
+
+    Image image = render_report(s, font);
+    bool  ok    = ExportImage(image, fileName);
+
+    UnloadImage(image);
+    return ok;
+}
+
+/**
+ * @brief   export schedule as columnar results file (.cpsr), nothing is rendered
+ *
+ * @param s         pointer for schedule result
+ * @param font      not used
+ * @param fileName  output file path
+ * @return  bool
+ */
+bool export_results(const Schedule *s, Font font, const char *fileName) {
+
+    (void) font;
+    return save_results(fileName, s);
+}
+
+/**
+ * @brief   report worker thread: take next job until every job is done
+ *          job index = workload index * algorithm count + algorithm index
+ *
+ * @param arg   pointer for shared batch state
+ * @return  void*
+ */
+void* report_worker(void *arg) {
+
+    ReportBatch *batch = arg;
+    int algos = batch->algo < 0 && batch->policy == NULL ? ALGO_COUNT : 1;
+    char path[PATH_MAX_W * 2];
+
+    while(true) {
+
+        pthread_mutex_lock(&batch->lock);
+        int job = batch->next++;
+        pthread_mutex_unlock(&batch->lock);
+
+        if(job >= batch->count * algos)
+            break;
+
+        Workload *w  = &batch->w[job / algos];
+        int algo     = batch->algo < 0 ? job % algos : batch->algo;
+        Schedule s   = { 0 };
+        CacheKey key = { { 0 } };
+
+        // results file output of a cached result is a copy, nothing is decoded
+        if(batch->cache && !batch->policy) {
+            key = cache_key(w->p, w->n, builtinPolicy[algo]);
+            snprintf(path, sizeof(path), "%s/%s_%s%s", batch->dir, w->label, algoName[algo], batch->ext);
+            if(batch->render == export_results && cache_copy(batch->cache, key, path))
+                continue;
+        }
+
+        if(batch->policy)
+            run_policy(batch->policy, w->p, w->n, w->t, &s);
+        else if(batch->cache == NULL)
+            run_algorithm(algo, w->p, w->n, w->t, &s);
+        else {
+            // same workload and algorithm is simulated only once
+            if(!cache_get(batch->cache, key, &s)) {
+                run_algorithm(algo, w->p, w->n, w->t, &s);
+                cache_put(batch->cache, key, &s);
+            }
+        }
+        snprintf(path, sizeof(path), "%s/%s_%s%s", batch->dir, w->label, s.algo, batch->ext);
+
+        if(!batch->render(&s, batch->font, path)) {
+            pthread_mutex_lock(&batch->lock);
+            batch->failed++;
+            pthread_mutex_unlock(&batch->lock);
+        }
+        free_schedule(&s);
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief   render reports for every workload with worker threads
+ *
+ * @param w         workload array
+ * @param count     workload count
+ * @param algo      algorithm index, -1 for every algorithm
+ * @param policy    policy plugin, run instead of the built-in algorithms if not NULL
+ * @param cache     result cache of the built-in algorithms (NULL for no cache)
+ * @param dir       output directory (must exist)
+ * @param ext       output file extension (".png", ".qoi", ".gif" or ".cpsr")
+ * @param render    function to render and export one schedule
+ * @param font      font with glyph images in CPU memory
+ * @param jobs      worker thread count (the calling thread does every job if no thread starts)
+ * @return  int (failed report count)
+ */
+int export_reports(Workload *w, int count, int algo, const Policy *policy, ResultCache *cache, const char *dir, const char *ext, ExportFunc render, Font font, int jobs) {
+
+    ReportBatch batch = {
+        .w = w, .count = count, .algo = algo, .policy = policy, .cache = cache, .dir = dir, .ext = ext, .render = render, .font = font
+    };
+    pthread_t *thread = malloc(sizeof(pthread_t) * (jobs > 1 ? jobs : 1));
+    int started = 0;
+
+    // report is mostly flat color, filter search costs twice the time for a few percent of size
+    stbi_write_force_png_filter = 0;
+
+    pthread_mutex_init(&batch.lock, NULL);
+
+    for(; thread != NULL && started < jobs; started++)
+        if(pthread_create(&thread[started], NULL, report_worker, &batch) != 0)
+            break;
+
+    // no worker thread (out of memory or thread limit): every job runs in the calling thread
+    if(started == 0)
+        report_worker(&batch);
+    for(int i = 0; i < started; i++)
+        pthread_join(thread[i], NULL);
+
+    pthread_mutex_destroy(&batch.lock);
+    free(thread);
+
+    return batch.failed;
+}
+
+#endif
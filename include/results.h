@@ -0,0 +1,184 @@
+/**
+ * @file    results.h
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   compact columnar results file of libcpusched
+ *          - per-process columns (termination order) and the segment timeline of the gantt chart
+ *          - each column is delta encoded and varint compressed in blocks of `RESULTS_BLOCK` rows,
+ *            every block restarts the delta so it can be decoded alone
+ *          - fixed size little-endian header and index: a reader maps the file and jumps to any
+ *            row of any column, or to the segment at any time through the time index
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+#ifndef RESULTS_H
+#define RESULTS_H
+
+// standard library
+#include <stdbool.h>
+#include <stddef.h>
+
+// user define library
+#include "process.h"
+
+/**
+ * @brief results.h variable info
+ *
+ *  type            name                pointer     info
+ *  #define         RESULTS_MAGIC       n           magic bytes at the start of a results file
+ *  #define         RESULTS_VERSION     n           results file version
+ *  #define         RESULTS_BLOCK       n           rows in each block of a column
+ *  #define         RESULTS_ALGO_W      n           maximum length of algorithm name
+ *  ResultsFile     r                   y           results file opened for reading (mapped)
+ *  ResultsSegment  seg                 y           segment of the gantt chart (one process running)
+ *  int             column              n           column no. (`RESULTS_PID` ... `RESULTS_SEG_PID`)
+ *
+ *  file layout (integers are little-endian):
+ *      header      128 bytes   magic, version, column count, block rows, n, t, segment count,
+ *                              sum of turnaround, waiting and response, time index offset, algorithm name
+ *      index       56 bytes for each column: no., row count, data offset and size,
+ *                              block table offset, min, max
+ *      tables      8 bytes for each block of each column: data offset of the block
+ *                  8 bytes for each segment block: start time of the block (time index)
+ *      data        varint of zigzag delta for each row (segment start: varint of the segment length)
+ *
+ */
+
+#define RESULTS_MAGIC   "CPSR"  // magic bytes at the start of a results file
+#define RESULTS_VERSION 1       // results file version
+#define RESULTS_BLOCK   4096    // rows in each block of a column
+#define RESULTS_ALGO_W  32      // maximum length of algorithm name (with NUL)
+
+// column no. (per-process columns have `n` rows, segment columns have `segments` rows)
+enum {
+    RESULTS_PID,            // process no.
+    RESULTS_PRIORITY,       // priority
+    RESULTS_ARRIVAL,        // arrival time
+    RESULTS_BURST,          // burst time
+    RESULTS_WAITING,        // `waiting` of the result (last wait)
+    RESULTS_TIMEOUT,        // `timeout` of the result (last time-out)
+    RESULTS_EXECUTE,        // `execute` of the result (last run)
+    RESULTS_COMPLETION,     // completion time
+    RESULTS_RESPONSE,       // response time (first run - arrival)
+    RESULTS_SEG_START,      // start time of each segment
+    RESULTS_SEG_PID,        // process no. of each segment (`IDLE_PID` for idle time)
+    RESULTS_COLUMNS
+};
+
+// column name (same order as the column no.)
+extern const char *resultsColumn[RESULTS_COLUMNS];
+
+/**
+ * @brief structure for results file opened for reading
+ *
+ */
+typedef struct ResultsFile {
+
+    const unsigned char *data;      // file contents (mapped, or read on systems without mmap)
+    size_t size;                    // file size
+    bool mapped;                    // `data` is mapped
+    char algo[RESULTS_ALGO_W];      // algorithm name
+    int n;                          // total process count
+    Time t;                         // total gantt chart length
+    long long segments;             // segment count of the gantt chart
+    Time total_turnaround;          // the sum of turnaround
+    Time total_waiting;             // the sum of waiting
+    Time total_response;            // the sum of response
+
+} ResultsFile;
+
+/**
+ * @brief structure for segment of the gantt chart
+ *
+ */
+typedef struct ResultsSegment {
+
+    Time start;     // start time
+    Time length;    // time units
+    int pid;        // process no. (`IDLE_PID` for idle time)
+
+} ResultsSegment;
+
+/**
+ * @brief   write scheduling result as results file
+ *
+ * @param fileName  results file path
+ * @param s         pointer for schedule structure
+ * @return  bool
+ */
+bool save_results(const char *fileName, const Schedule *s);
+
+/**
+ * @brief   open results file for reading (mapped if the system has mmap)
+ *
+ * @param fileName  results file path
+ * @param r         pointer for results file
+ * @return  bool (false if the file can't be read or is invalid)
+ */
+bool open_results(const char *fileName, ResultsFile *r);
+
+/**
+ * @brief   close results file
+ *
+ * @param r pointer for results file
+ */
+void close_results(ResultsFile *r);
+
+/**
+ * @brief   minimum and maximum value of the column
+ *
+ * @param r         pointer for results file
+ * @param column    column no.
+ * @param min       pointer for minimum value
+ * @param max       pointer for maximum value
+ * @return  long long (row count of the column, -1 if invalid column)
+ */
+long long column_range(const ResultsFile *r, int column, long long *min, long long *max);
+
+/**
+ * @brief   decode rows [first, first + count) of the column, only the blocks of the rows are read
+ *
+ * @param r         pointer for results file
+ * @param column    column no.
+ * @param first     first row
+ * @param count     row count
+ * @param out       array for values (at least `count`)
+ * @return  long long (rows decoded, -1 if the file is invalid)
+ */
+long long read_column(const ResultsFile *r, int column, long long first, long long count, long long *out);
+
+/**
+ * @brief   find the segment running at the time (binary search of the time index)
+ *
+ * @param r     pointer for results file
+ * @param time  time of the gantt chart
+ * @return  long long (segment no., -1 if out of the gantt chart)
+ */
+long long find_segment(const ResultsFile *r, Time time);
+
+/**
+ * @brief   decode segments [first, first + count) of the gantt chart
+ *
+ * @param r     pointer for results file
+ * @param first first segment no.
+ * @param count segment count
+ * @param seg   array for segments (at least `count`)
+ * @return  long long (segments decoded, -1 if the file is invalid)
+ */
+long long read_segments(const ResultsFile *r, long long first, long long count, ResultsSegment *seg);
+
+/**
+ * @brief   load results file as schedule structure (free with `free_schedule()`)
+ *          gantt chart segments are the segments of the file,
+ *          algorithm name is stored after the result array and freed with it
+ *
+ * @param fileName  results file path
+ * @param s         pointer for schedule structure
+ * @return  bool
+ */
+bool load_results(const char *fileName, Schedule *s);
+
+#endif
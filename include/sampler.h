@@ -0,0 +1,94 @@
+/**
+ * @file    sampler.h
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   live workload capture from /proc of the local machine (Linux)
+ *          - every interval the run time of each task (`/proc/<pid>/task/<tid>/schedstat`,
+ *            nanosecond) and its state and priority (`stat`) are sampled
+ *          - run time growth opens a CPU burst, the burst ends when the task is found sleeping,
+ *            one process for each CPU burst like `parse_trace()`
+ *          - low overhead: files stay open and are read with `pread()` into one reused buffer,
+ *            directories are listed with `getdents64()`, no allocation for each sample
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+#ifndef SAMPLER_H
+#define SAMPLER_H
+
+// standard library
+#include <signal.h>
+#include <stdbool.h>
+
+// user define library
+#include "process.h"
+#include "trace.h"
+
+/**
+ * @brief sampler.h variable info
+ *
+ *  type            name                pointer     info
+ *  #define         SAMPLER_INTERVAL    n           default sampling interval (microsecond)
+ *  #define         SAMPLER_FILES       n           default maximum files kept open
+ *  SamplerOptions  opt                 y           sampler options
+ *  SamplerStats    stats               y           sampler statistics (can be NULL)
+ *  TraceSink       sink                y           function called for each process (CPU burst or task)
+ *  void            data                y           user data passed to `sink`
+ *  sig_atomic_t    stop                y           sampling stops when set (can be NULL)
+ *
+ *  arrival of a CPU burst is estimated from the samples: the run and wait time growth of the
+ *  interval is counted back from the sample, not earlier than the previous sample
+ *  CPU time of tasks that exist at the first sample is not counted until the next sample
+ *
+ */
+
+#define SAMPLER_INTERVAL    10000   // default sampling interval (microsecond)
+#define SAMPLER_FILES       1024    // default maximum files kept open
+
+/**
+ * @brief structure for sampler options
+ *
+ */
+typedef struct SamplerOptions {
+
+    long long interval;     // sampling interval (microsecond, 0: `SAMPLER_INTERVAL`)
+    long long duration;     // sampling time (microsecond, 0: until `stop` is set)
+    long long unit;         // nanoseconds for one time unit (0: `TRACE_UNIT`)
+    int pid;                // only the threads of this process (0: every process)
+    int files;              // maximum files kept open (0: `SAMPLER_FILES`), the rest is opened each sample
+    bool perTask;           // one process for each task (total run time) instead of each CPU burst
+
+} SamplerOptions;
+
+/**
+ * @brief structure for sampler statistics
+ *
+ */
+typedef struct SamplerStats {
+
+    long long samples;      // samples taken
+    long long overruns;     // samples later than the next interval (skipped intervals)
+    long long reads;        // files read
+    long long tasks;        // tasks seen
+    long long processes;    // processes given to `sink`
+
+} SamplerStats;
+
+/**
+ * @brief   sample /proc until `duration` or `stop` and convert the samples into processes
+ *          CPU burst mode: process no. is the burst no. (0, 1, 2, ... in order of burst end)
+ *          task mode: process no. is the task TID, arrival is the first CPU burst
+ *          priority is the kernel priority of the task (120 = nice 0), like `parse_trace()`
+ *
+ * @param opt   sampler options (NULL for default)
+ * @param sink  function called for each process
+ * @param data  user data passed to `sink`
+ * @param stats sampler statistics (can be NULL)
+ * @param stop  sampling stops when set, e.g. from a signal handler (can be NULL)
+ * @return  bool (false if /proc can't be read or not Linux)
+ */
+bool sample_proc(const SamplerOptions *opt, TraceSink sink, void *data, SamplerStats *stats, volatile sig_atomic_t *stop);
+
+#endif
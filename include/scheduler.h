@@ -0,0 +1,76 @@
+/**
+ * @file    scheduler.h
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   CPU scheduling algorithm package header (libcpusched)
+ *          - run algorithm by index of `algoName` array
+ *          - no raylib dependency, link with `libcpusched.a` or `libcpusched.so`
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+// standard library
+#include <stdbool.h>
+
+// user define library
+#include "FCFS.h"
+#include "SJF.h"
+#include "HRN.h"
+#include "NPP.h"
+#include "PP.h"
+#include "RR.h"
+#include "SRT.h"
+#include "policy.h"
+#include "process.h"
+
+/**
+ * @brief scheduler.h variable info
+ *
+ *  type        name        pointer     info
+ *  #define     ALGO_COUNT  n           number of scheduling algorithms
+ *  #define     QAUNTUM     n           default time quantum
+ *  char        algoName    y           algorithm name string array
+ *  Policy      builtinPolicy y         built-in scheduling policy array (same order as `algoName`)
+ *  int         algo        n           algorithm index (same as `algoName` array)
+ *  Process     p           y           pointer for process structure
+ *  int         n           n           total process count
+ *  Time        t           n           total burst time
+ *  Schedule    s           y           pointer for schedule result save
+ *
+ */
+
+#define ALGO_COUNT  7   // number of scheduling algorithms
+#define QAUNTUM     2   // default time quantum
+
+// algorithm name string array
+extern const char *algoName[ALGO_COUNT];
+
+// built-in scheduling policy array (same order as `algoName`)
+extern const Policy *builtinPolicy[ALGO_COUNT];
+
+/**
+ * @brief   find algorithm index by name
+ *
+ * @param algo  algorithm name string array
+ * @return  int (-1 if unknown algorithm)
+ */
+int find_algorithm(const char *algo);
+
+/**
+ * @brief   run scheduling algorithm and save result
+ *
+ * @param algo  algorithm index (same as `algoName` array)
+ * @param p     pointer for process structure
+ * @param n     total process count
+ * @param t     total burst time
+ * @param s     pointer for schedule result save (empty with a warning if out of memory or time out of range)
+ * @return  bool
+ */
+bool run_algorithm(int algo, Process *p, int n, Time t, Schedule *s);
+
+#endif
@@ -0,0 +1,156 @@
+/**
+ * @file    steady.h
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   steady-state estimation of libcpusched open-system runs
+ *          - warm-up truncation: MSER-5 on the observations in completion order
+ *          - batch means: `STEADY_BATCHES` batches after the warm-up, Student t confidence interval
+ *          - stopping rule: `run_steady()` ends the stream once the half-width reaches the target
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+#ifndef STEADY_H
+#define STEADY_H
+
+// standard library
+#include <stdbool.h>
+
+// user define library
+#include "policy.h"
+#include "process.h"
+#include "stream.h"
+
+/**
+ * @brief steady.h variable info
+ *
+ *  type            name            pointer     info
+ *  #define         STEADY_BATCH    n           observations in each MSER batch (MSER-5)
+ *  #define         STEADY_BATCHES  n           batches of the batch means estimator
+ *  #define         STEADY_KEPT     n           stored batch means, pairs are merged past this count
+ *  #define         STEADY_MINIMUM  n           default observations before the first check
+ *  SteadyState     ss              y           observations of a run (batch means of `size`)
+ *  SteadyEstimate  est             y           truncated mean and its confidence interval
+ *  SteadyOptions   opt             y           stopping rule of `run_steady()`
+ *
+ *  memory is fixed: past `STEADY_KEPT` stored means every two neighbours are merged and the
+ *  batch size doubles (MSER-5 becomes MSER-10, 20, ...), the truncation point keeps its resolution
+ *  of 1/`STEADY_KEPT` of the run
+ *
+ */
+
+#define STEADY_BATCH    5       // observations in each MSER batch (MSER-5)
+#define STEADY_BATCHES  30      // batches of the batch means estimator
+#define STEADY_KEPT     65536   // stored batch means, pairs are merged past this count
+#define STEADY_MINIMUM  10000   // default observations before the first check
+
+// observed metric of each termination
+enum {
+    STEADY_TURNAROUND,  // completion - arrival
+    STEADY_WAITING      // turnaround - burst
+};
+
+/**
+ * @brief structure for observations of a run
+ *
+ */
+typedef struct SteadyState {
+
+    double *mean;           // stored batch means (`size` observations each)
+    int count;              // stored batch mean count
+    long long size;         // observations in each stored batch
+    double sum;             // sum of the present batch
+    long long pending;      // observations in the present batch
+    long long total;        // observation count
+
+} SteadyState;
+
+/**
+ * @brief structure for truncated mean and its confidence interval
+ *
+ */
+typedef struct SteadyEstimate {
+
+    bool valid;             // enough observations after the warm-up for `STEADY_BATCHES` batches
+    long long observations; // observation count
+    long long truncated;    // warm-up observations dropped by MSER
+    long long batchSize;    // observations in each batch of the estimator
+    double mean;            // mean after the warm-up
+    double halfWidth;       // half-width of the confidence interval
+    double confidence;      // confidence level of the interval
+
+} SteadyEstimate;
+
+/**
+ * @brief structure for stopping rule of `run_steady()`
+ *
+ */
+typedef struct SteadyOptions {
+
+    int metric;             // observed metric (`STEADY_TURNAROUND`, `STEADY_WAITING`)
+    double confidence;      // confidence level (0: 0.95)
+    double precision;       // target half-width relative to the mean (0: 0.05)
+    long long minimum;      // observations before the first check (0: `STEADY_MINIMUM`)
+    StreamOptions stream;   // streaming options (`until` is the time limit, callbacks are kept)
+
+} SteadyOptions;
+
+/**
+ * @brief   initialize observations
+ *
+ * @param ss    pointer for observations
+ * @return  bool (false if not enough memory)
+ */
+bool steady_init(SteadyState *ss);
+
+/**
+ * @brief   add observation (completion order)
+ *
+ * @param ss    pointer for observations
+ * @param x     observed value
+ */
+void steady_add(SteadyState *ss, double x);
+
+/**
+ * @brief   MSER-5 warm-up truncation and batch means confidence interval
+ *
+ * @param ss            pointer for observations
+ * @param confidence    confidence level (e.g. 0.95)
+ * @param est           pointer for estimate
+ * @return  bool (`est->valid`)
+ */
+bool steady_estimate(const SteadyState *ss, double confidence, SteadyEstimate *est);
+
+/**
+ * @brief   release observations
+ *
+ * @param ss    pointer for observations
+ */
+void steady_free(SteadyState *ss);
+
+/**
+ * @brief   quantile of Student t distribution (two-sided interval of the confidence level)
+ *
+ * @param df            degrees of freedom
+ * @param confidence    confidence level (e.g. 0.95)
+ * @return  double
+ */
+double t_quantile(int df, double confidence);
+
+/**
+ * @brief   run stream until the confidence interval of the metric reaches the target precision
+ *          the estimate is checked each time the observations grow by 10%
+ *
+ * @param pol       pointer for scheduling policy
+ * @param src       next arrival of the stream
+ * @param srcData   user data of the source
+ * @param opt       stopping rule and streaming options
+ * @param st        metrics of the whole stream (warm-up included, `failed` if the run ended early)
+ * @param est       steady-state estimate at the end
+ * @return  bool (true if the target precision was reached)
+ */
+bool run_steady(const Policy *pol, ArrivalSource src, void *srcData, const SteadyOptions *opt, StreamStats *st, SteadyEstimate *est);
+
+#endif
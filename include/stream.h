@@ -0,0 +1,224 @@
+/**
+ * @file    stream.h
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   open-system streaming simulation of libcpusched
+ *          - processes come from an unbounded arrival stream (generator or workload pipe),
+ *            not from a closed set known up front
+ *          - a terminated process is folded into the metrics and its slot is reused:
+ *            memory follows the processes in the system, not the processes seen so far
+ *          - sliding window metrics: throughput, utilization and turnaround percentiles of the
+ *            last `window` time units, reported every `window / STREAM_SLICES` time units
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+#ifndef STREAM_H
+#define STREAM_H
+
+// standard library
+#include <stdbool.h>
+
+// user define library
+#include "policy.h"
+#include "process.h"
+
+/**
+ * @brief stream.h variable info
+ *
+ *  type            name            pointer     info
+ *  #define         STREAM_WINDOW   n           default sliding window length (time units)
+ *  #define         STREAM_SLICES   n           slices of the sliding window (report interval)
+ *  #define         HIST_SUB_BITS   n           histogram: 2^n buckets for each power of 2
+ *  #define         HIST_BUCKETS    n           histogram bucket count
+ *  Histogram       h               y           log-linear histogram of time values
+ *  ArrivalSource   src             y           next arrival of the stream (arrival order)
+ *  ArrivalGen      g               y           open-system arrival generator
+ *  StreamOptions   opt             y           streaming options
+ *  StreamWindow    w               y           metrics of the sliding window
+ *  StreamStats     st              y           metrics of the whole stream
+ *
+ *  histogram: values under 2^HIST_SUB_BITS are exact, larger values fall in buckets of
+ *  1/2^HIST_SUB_BITS of their power of 2 (percentile error under 1%), fixed size for any count
+ *  the engine is the same as `run_policy()` (same event order and hooks): a finite stream
+ *  in arrival order gives the same totals as `run_policy()` on the same processes
+ *
+ */
+
+#define STREAM_WINDOW   10000   // default sliding window length (time units)
+#define STREAM_SLICES   10      // slices of the sliding window (report interval)
+#define HIST_SUB_BITS   6       // histogram: 2^n buckets for each power of 2
+#define HIST_BUCKETS    ((64 - HIST_SUB_BITS + 1) << HIST_SUB_BITS)
+
+/**
+ * @brief structure for log-linear histogram of time values
+ *
+ */
+typedef struct Histogram {
+
+    long long count;                    // value count
+    Time min;                           // minimum value
+    Time max;                           // maximum value
+    long long bucket[HIST_BUCKETS];     // value count of each bucket
+
+} Histogram;
+
+/**
+ * @brief   next arrival of the stream
+ *          processes must come in arrival order, a late arrival is moved to the previous arrival
+ *          an arrival out of 0 ~ `ARRIVAL_LIMIT` - 1 or a priority out of `PRIORITY_LIMIT` ends the stream
+ *          the process is filled by `init_process()`, a process of burst 0 is skipped
+ *
+ * @param data  user data of the source
+ * @param p     pointer for process structure
+ * @return  bool (false at the end of the stream)
+ */
+typedef bool (*ArrivalSource)(void *data, Process *p);
+
+/**
+ * @brief structure for open-system arrival generator
+ *          Poisson arrivals, burst of mean `meanBurst` and coefficient of variation `cv`:
+ *          0 deterministic, under 1 Erlang, 1 exponential, over 1 balanced hyperexponential
+ *          (burst is rounded to time units, at least 1)
+ *
+ */
+typedef struct ArrivalGen {
+
+    double rate;                // arrivals for each time unit
+    double meanBurst;           // mean burst time
+    double cv;                  // coefficient of variation of the burst time
+    int priorities;             // priority is uniform in 1 ~ `priorities`
+    long long limit;            // arrival count (0: unbounded)
+    long long count;            // generated arrival count
+    double clock;               // arrival time of the last arrival (continuous)
+    unsigned long long state;   // random number generator state
+
+} ArrivalGen;
+
+/**
+ * @brief structure for metrics of the sliding window [start, end)
+ *
+ */
+typedef struct StreamWindow {
+
+    Time start;                 // window start time
+    Time end;                   // window end time (present time)
+    long long arrived;          // arrivals in the window
+    long long completed;        // terminations in the window
+    int live;                   // processes in the system at the end
+    double throughput;          // terminations for each time unit
+    double utilization;         // busy time / window length
+    double avg_turnaround;      // average turnaround of the terminations
+    Time p50;                   // turnaround percentiles of the terminations
+    Time p90;
+    Time p99;
+    Time max;
+
+} StreamWindow;
+
+/**
+ * @brief structure for streaming options
+ *
+ */
+typedef struct StreamOptions {
+
+    Time window;    // sliding window length (time units, 0: `STREAM_WINDOW`)
+    Time until;     // stop time (0: until the stream ends and every process terminates)
+    void *data;     // user data passed to the callbacks
+
+    void (*on_window)(void *data, const StreamWindow *w);        // each slice end (can be NULL)
+    void (*on_complete)(void *data, const Process *p, Time completion); // each termination (can be NULL)
+    bool (*should_stop)(void *data, Time time);                         // after each termination, true ends the run (can be NULL)
+
+} StreamOptions;
+
+/**
+ * @brief structure for metrics of the whole stream
+ *
+ */
+typedef struct StreamStats {
+
+    long long arrived;          // arrival count
+    long long completed;        // termination count
+    int live;                   // processes in the system at the end
+    int peak;                   // maximum processes in the system (memory use)
+    Time time;                  // end time
+    Time busy;                  // busy time units
+    Time total_turnaround;      // the sum of turnaround (terminated processes)
+    Time total_waiting;         // the sum of waiting (terminated and running processes)
+    Time total_response;        // the sum of response
+    Histogram turnaround;       // turnaround of every termination
+    bool failed;                // the stream ended early (out of memory or arrival out of range)
+
+} StreamStats;
+
+/**
+ * @brief   add value to histogram
+ *
+ * @param h pointer for histogram
+ * @param v value (not negative)
+ */
+void hist_add(Histogram *h, Time v);
+
+/**
+ * @brief   add every value of `from` to `h`
+ *
+ * @param h     pointer for histogram
+ * @param from  pointer for histogram to be added
+ */
+void hist_merge(Histogram *h, const Histogram *from);
+
+/**
+ * @brief   percentile of histogram (middle of the bucket, within the minimum and maximum)
+ *
+ * @param h pointer for histogram
+ * @param q quantile (0.0 ~ 1.0)
+ * @return  Time (0 if empty)
+ */
+Time hist_percentile(const Histogram *h, double q);
+
+/**
+ * @brief   initialize open-system arrival generator (same seed gives same stream)
+ *
+ * @param g             pointer for arrival generator
+ * @param rate          arrivals for each time unit
+ * @param meanBurst     mean burst time
+ * @param cv            coefficient of variation of the burst time
+ * @param priorities    priority is uniform in 1 ~ `priorities`
+ * @param limit         arrival count (0: unbounded)
+ * @param seed          random seed
+ */
+void init_generator(ArrivalGen *g, double rate, double meanBurst, double cv, int priorities, long long limit, unsigned long long seed);
+
+/**
+ * @brief   `ArrivalSource` of the arrival generator
+ *
+ * @param data  pointer for arrival generator (`ArrivalGen`)
+ * @param p     pointer for process structure
+ * @return  bool (false after `limit` arrivals)
+ */
+bool generator_source(void *data, Process *p);
+
+/**
+ * @brief   `ArrivalSource` of workload file being read (`WorkloadReader`, file in arrival order)
+ *
+ * @param data  pointer for workload reader (`WorkloadReader`)
+ * @param p     pointer for process structure
+ * @return  bool (false at the end of file)
+ */
+bool workload_source(void *data, Process *p);
+
+/**
+ * @brief   run scheduling policy on an arrival stream, memory follows the processes in the system
+ *
+ * @param pol       pointer for scheduling policy (`quantum` is the time quantum)
+ * @param src       next arrival of the stream
+ * @param srcData   user data of the source
+ * @param opt       streaming options (can be NULL)
+ * @param st        metrics of the whole stream (`failed` if the stream ended early)
+ */
+void run_stream(const Policy *pol, ArrivalSource src, void *srcData, const StreamOptions *opt, StreamStats *st);
+
+#endif
@@ -0,0 +1,117 @@
+/**
+ * @file    sweep.h
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   load sweep of libcpusched: latency versus utilization of every policy
+ *          - one open-system run (`run_stream()` on `generator_source()`) for each policy and load,
+ *            loads from `low` to `high` with the points closer together near saturation
+ *          - mean and p99 of waiting, turnaround and slowdown (turnaround / burst) after the MSER-5 warm-up
+ *          - runs are spread over the worker threads heaviest first (longest processing time first):
+ *            a run near saturation is longer, so the sweep takes about the time of the longest run
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+#ifndef SWEEP_H
+#define SWEEP_H
+
+// standard library
+#include <stdbool.h>
+
+// user define library
+#include "policy.h"
+
+/**
+ * @brief sweep.h variable info
+ *
+ *  type            name                pointer     info
+ *  #define         SWEEP_POINTS        n           default load count
+ *  #define         SWEEP_COUNT         n           default terminations of a run at load 0
+ *  #define         SWEEP_SCALE         n           terminations of a run are at most `count` * this
+ *  enum            SweepMetric         n           measured metric (index of `mean` and `p99`)
+ *  SweepOptions    opt                 y           burst distribution, loads and run length
+ *  SweepPoint      pt                  y           metrics of one policy at one load
+ *  Policy          pol                 y           policy array to be swept
+ *
+ *  load of a point: 1 - (1 - low) * ((1 - high) / (1 - low))^(i / (points - 1)), even steps of log(1 - load)
+ *  terminations of a run: `count` / (1 - load), at most `count` * `SWEEP_SCALE`, the queue near
+ *  saturation forgets its start slowly and needs the longer run, 24 bytes of memory for each termination
+ *  every run uses the same seed (common random numbers): the curves are smooth and the policies are
+ *  compared on the same arrivals and bursts
+ *
+ */
+
+#define SWEEP_POINTS    16      // default load count
+#define SWEEP_COUNT     20000   // default terminations of a run at load 0
+#define SWEEP_SCALE     100     // terminations of a run are at most `count` * this
+
+/**
+ * @brief enumeration for measured metric (index of `mean` and `p99`)
+ *
+ */
+typedef enum SweepMetric {
+
+    SWEEP_WAITING,      // turnaround - burst
+    SWEEP_TURNAROUND,   // completion - arrival
+    SWEEP_SLOWDOWN,     // turnaround / burst
+    SWEEP_METRICS       // metric count
+
+} SweepMetric;
+
+/**
+ * @brief structure for burst distribution, loads and run length
+ *
+ */
+typedef struct SweepOptions {
+
+    double meanBurst;           // mean burst time (`init_generator()`)
+    double cv;                  // coefficient of variation of the burst time
+    int priorities;             // priority is uniform in 1 ~ `priorities`
+    double low;                 // lowest load (0: 0.10)
+    double high;                // highest load, under 1 (0: 0.99)
+    int points;                 // load count (0: `SWEEP_POINTS`)
+    long long count;            // terminations of a run at load 0 (0: `SWEEP_COUNT`)
+    unsigned long long seed;    // random seed of every run
+    int jobs;                   // thread count (0: online processor count)
+
+} SweepOptions;
+
+/**
+ * @brief structure for metrics of one policy at one load
+ *
+ */
+typedef struct SweepPoint {
+
+    double load;                    // utilization of the arrivals (rate * mean burst)
+    double rate;                    // arrival rate
+    long long observations;         // terminations after the warm-up
+    long long truncated;            // terminations dropped as warm-up
+    double mean[SWEEP_METRICS];     // mean of each metric
+    double p99[SWEEP_METRICS];      // 99th percentile of each metric
+    double seconds;                 // run time of the simulation
+
+} SweepPoint;
+
+/**
+ * @brief   load of a sweep point
+ *
+ * @param opt   burst distribution, loads and run length
+ * @param i     point index (0 ~ `points` - 1)
+ * @return  double
+ */
+double sweep_load(const SweepOptions *opt, int i);
+
+/**
+ * @brief   run every policy at every load of the sweep
+ *
+ * @param pol   policy array
+ * @param count policy count
+ * @param opt   burst distribution, loads and run length
+ * @param pt    result array (`count` * `points`, point `i` of policy `k` is `pt[k * points + i]`)
+ * @return  bool (false if the options are invalid or a run failed)
+ */
+bool run_sweep(const Policy *const *pol, int count, const SweepOptions *opt, SweepPoint *pt);
+
+#endif
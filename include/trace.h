@@ -0,0 +1,113 @@
+/**
+ * @file    trace.h
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   Linux scheduler trace to workload (perf sched script, ftrace sched_switch/sched_wakeup)
+ *          - one process for each CPU burst: from wakeup (or first switch in) until the task
+ *            sleeps, preempted time slices (`prev_state=R`) belong to the same burst
+ *          - streaming: the trace is read in windows of `window` bytes, each window is split
+ *            at line boundaries and parsed by `threads` threads, events are applied in file order
+ *          - memory is bounded by the window and the task count, not by the trace size
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+// standard library
+#include <stdbool.h>
+#include <stddef.h>
+
+// user define library
+#include "process.h"
+
+/**
+ * @brief trace.h variable info
+ *
+ *  type            name            pointer     info
+ *  #define         TRACE_UNIT      n           default nanoseconds for one time unit (microsecond)
+ *  #define         TRACE_WINDOW    n           default bytes of the trace read at once
+ *  #define         TRACE_THREADS   n           maximum parser thread count
+ *  TraceOptions    opt             y           trace conversion options
+ *  TraceStats      stats           y           trace conversion statistics (can be NULL)
+ *  TraceSink       sink            y           function called for each process (CPU burst or task)
+ *  void            data            y           user data passed to `sink`
+ *  char            fileName        y           trace file path
+ *
+ *  supported lines (other lines are skipped):
+ *      ftrace:        `<comm>-<pid> [cpu] flags <sec>.<usec>: sched_switch: prev_comm=.. prev_pid=..
+ *                      prev_prio=.. prev_state=.. ==> next_comm=.. next_pid=.. next_prio=..`
+ *                     `... <sec>.<usec>: sched_wakeup: comm=.. pid=.. prio=.. target_cpu=..`
+ *      perf sched:    `<comm> <pid> [cpu] <sec>.<usec>: sched:sched_switch: <comm>:<pid> [prio] <state>
+ *                      ==> <comm>:<pid> [prio]`
+ *                     `... <sec>.<usec>: sched:sched_wakeup: <comm>:<pid> [prio] CPU:<cpu>`
+ *      (`sched_wakeup_new` is the same as `sched_wakeup`, perf key=value format is also accepted)
+ *  a line longer than the read window is skipped with a warning
+ *
+ */
+
+#define TRACE_UNIT      1000                // default nanoseconds for one time unit
+#define TRACE_WINDOW    (64 << 20)          // default bytes of the trace read at once
+#define TRACE_THREADS   64                  // maximum parser thread count
+
+/**
+ * @brief structure for trace conversion options
+ *
+ */
+typedef struct TraceOptions {
+
+    long long unit;     // nanoseconds for one time unit (0: `TRACE_UNIT`)
+    int threads;        // parser thread count (0: CPU count)
+    size_t window;      // bytes of the trace read at once (0: `TRACE_WINDOW`)
+    bool perTask;       // one process for each task (total run time) instead of each CPU burst
+
+} TraceOptions;
+
+/**
+ * @brief structure for trace conversion statistics
+ *
+ */
+typedef struct TraceStats {
+
+    long long bytes;        // bytes read
+    long long lines;        // lines read
+    long long events;       // sched_switch and sched_wakeup events
+    long long skipped;      // sched_switch or sched_wakeup lines not understood
+    long long tasks;        // tasks seen (process no. except idle 0)
+    long long processes;    // processes given to `sink`
+
+} TraceStats;
+
+// function called for each process derived from the trace, arrival is relative to the first event
+typedef void (*TraceSink)(void *data, const Process *p);
+
+/**
+ * @brief   convert scheduler trace into processes
+ *          CPU burst mode: process no. is the burst no. (0, 1, 2, ... in order of burst end)
+ *          task mode: process no. is the task PID, arrival is the first wakeup
+ *          priority is the kernel priority of the task (`prio`, 120 = nice 0)
+ *
+ * @param fileName  trace file path
+ * @param opt       trace conversion options (NULL for default)
+ * @param sink      function called for each process
+ * @param data      user data passed to `sink`
+ * @param stats     trace conversion statistics (can be NULL)
+ * @return  bool (false if the file can't be read, not enough memory or more than 2^31 CPU bursts)
+ */
+bool parse_trace(const char *fileName, const TraceOptions *opt, TraceSink sink, void *data, TraceStats *stats);
+
+/**
+ * @brief   load scheduler trace as workload, sorted by arrival (stable)
+ *
+ * @param fileName  trace file path
+ * @param opt       trace conversion options (NULL for default)
+ * @param n         pointer for total process count
+ * @param t         pointer for total burst time
+ * @return  Process* (NULL if the file can't be read or has no process)
+ */
+Process* load_trace(const char *fileName, const TraceOptions *opt, int *n, Time *t);
+
+#endif
@@ -0,0 +1,166 @@
+/**
+ * @file    tune.h
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   parameter tuning of libcpusched policies (successive halving)
+ *          - tunable families: RR (quantum), MLFQ (levels, base quantum, priority boost interval)
+ *            and priority with aging (aging rate), all as `Policy` hooks on the same engine
+ *          - candidates are drawn from the parameter space, every round runs them on the first
+ *            processes of the workload (short horizon), keeps the best 1 / `eta` and grows the horizon
+ *            `eta` times, the last round runs the whole workload
+ *          - the runs of a round are spread over the worker threads (`pool.h`)
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+#ifndef TUNE_H
+#define TUNE_H
+
+// standard library
+#include <stdbool.h>
+
+// user define library
+#include "process.h"
+
+/**
+ * @brief tune.h variable info
+ *
+ *  type            name                pointer     info
+ *  #define         TUNE_CANDIDATES     n           default candidate count
+ *  #define         TUNE_ETA            n           default halving rate
+ *  #define         TUNE_MIN_HORIZON    n           fewest processes of a short run
+ *  #define         TUNE_MAX_QUANTUM    n           largest quantum of the space
+ *  #define         TUNE_MAX_LEVELS     n           largest MLFQ level count of the space
+ *  #define         TUNE_MAX_BOOST      n           longest priority boost interval of the space
+ *  enum            TuneFamily          n           tunable policy family
+ *  enum            TuneMetric          n           target metric (smaller is better)
+ *  TuneParams      prm                 y           parameters of a policy
+ *  TuneOptions     opt                 y           family, metric and search options
+ *  TuneResult      res                 y           best parameters and their metric
+ *
+ *  MLFQ: a new process enters level 0, the quantum of level `l` is `quantum` * 2^l, a process that uses
+ *  its whole quantum moves one level down (the last level is round robin), a process of a higher level
+ *  preempts the running one, every `boost` time units every process goes back to level 0 (0: never)
+ *  aging: non-preemptive priority, the effective priority is priority - `aging` * waiting
+ *  (smaller value is higher priority, as NPP), `aging` 0 is NPP
+ *  space: quantum 1 ~ `TUNE_MAX_QUANTUM`, levels 1 ~ `TUNE_MAX_LEVELS`, boost 0 or 10 ~ `TUNE_MAX_BOOST`,
+ *  aging 0 or 1e-4 ~ 1, drawn on a log scale, the first candidate is the default of the family
+ *
+ */
+
+#define TUNE_CANDIDATES     81      // default candidate count
+#define TUNE_ETA            3       // default halving rate
+#define TUNE_MIN_HORIZON    50      // fewest processes of a short run
+#define TUNE_MAX_QUANTUM    64      // largest quantum of the space
+#define TUNE_MAX_LEVELS     8       // largest MLFQ level count of the space
+#define TUNE_MAX_BOOST      10000   // longest priority boost interval of the space
+
+/**
+ * @brief enumeration for tunable policy family
+ *
+ */
+typedef enum TuneFamily {
+
+    TUNE_RR,        // round robin: quantum
+    TUNE_MLFQ,      // multi-level feedback queue: levels, quantum, boost
+    TUNE_AGING,     // priority with aging: aging
+    TUNE_FAMILIES   // family count
+
+} TuneFamily;
+
+/**
+ * @brief enumeration for target metric (smaller is better)
+ *
+ */
+typedef enum TuneMetric {
+
+    TUNE_WAITING,       // average waiting
+    TUNE_TURNAROUND,    // average turnaround
+    TUNE_RESPONSE,      // average response
+    TUNE_METRICS        // metric count
+
+} TuneMetric;
+
+/**
+ * @brief structure for parameters of a policy
+ *
+ */
+typedef struct TuneParams {
+
+    int quantum;    // time quantum (RR), quantum of level 0 (MLFQ)
+    int levels;     // MLFQ level count
+    Time boost;     // MLFQ priority boost interval (0: never)
+    double aging;   // priority gained per waiting time unit (aging)
+
+} TuneParams;
+
+/**
+ * @brief structure for family, metric and search options
+ *
+ */
+typedef struct TuneOptions {
+
+    TuneFamily family;          // policy family to tune
+    TuneMetric metric;          // target metric
+    int candidates;             // candidate count (0: `TUNE_CANDIDATES`)
+    int eta;                    // halving rate, at least 2 (0: `TUNE_ETA`)
+    unsigned long long seed;    // random seed of the candidates
+    int jobs;                   // thread count (0: online processor count)
+
+} TuneOptions;
+
+/**
+ * @brief structure for best parameters and their metric
+ *
+ */
+typedef struct TuneResult {
+
+    TuneParams best;            // best parameters on the whole workload (`base` unless better)
+    double value;               // target metric of the best parameters
+    TuneParams base;            // default parameters of the family
+    double baseValue;           // target metric of the default parameters (whole workload)
+    int rounds;                 // halving rounds
+    int evaluations;            // runs (every round)
+    long long simulated;        // processes simulated by every run
+
+} TuneResult;
+
+// family name (`TuneFamily` order)
+extern const char *tuneFamilyName[TUNE_FAMILIES];
+
+// metric name (`TuneMetric` order)
+extern const char *tuneMetricName[TUNE_METRICS];
+
+/**
+ * @brief   default parameters of the family (RR: `QAUNTUM`, MLFQ: 3 levels without boost, aging: 0)
+ *
+ * @param family    policy family
+ * @return  TuneParams
+ */
+TuneParams tune_default(TuneFamily family);
+
+/**
+ * @brief   run the policy of the family with the parameters and save result
+ *
+ * @param family    policy family
+ * @param prm       pointer for parameters
+ * @param p         pointer for process structure
+ * @param n         total process count
+ * @param s         pointer for schedule result save
+ */
+void run_tuned(TuneFamily family, const TuneParams *prm, Process *p, int n, Schedule *s);
+
+/**
+ * @brief   search the parameters of the family with the smallest target metric on the workload
+ *
+ * @param p     pointer for process structure (workload)
+ * @param n     total process count
+ * @param opt   family, metric and search options
+ * @param res   pointer for best parameters and their metric
+ * @return  bool (false if the workload is empty, the options are invalid or not enough memory)
+ */
+bool tune_policy(const Process *p, int n, const TuneOptions *opt, TuneResult *res);
+
+#endif
@@ -0,0 +1,202 @@
+/**
+ * @file    workload.h
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   workload loader for CPU scheduler simulator
+ *          - built-in default process data (`pInfo`)
+ *          - text workload file, one process per line
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+#ifndef WORKLOAD_H
+#define WORKLOAD_H
+
+// standard library
+#include <stdbool.h>
+#include <stdio.h>
+
+// user define library
+#include "process.h"
+
+/**
+ * @brief workload.h variable info
+ *
+ *  type        name        pointer     info
+ *  #define     LINE_MAX_W  n           maximum length of a workload file line
+ *  #define     LABEL_MAX_W n           maximum length of a workload label
+ *  #define     P_COUNT     n           default process count
+ *  #define     P_PARAM     n           default process parameters count
+ *  int         pInfo       y           process default data to be used by the simulator
+ *  Process     p           y           pointer for process structure
+ *  int         pid         n           process no.
+ *  Time        arrival     n           process arrival time
+ *  Time        burst       n           process burst time
+ *  int         priority    n           process priority
+ *  int         n           y           total process count
+ *  Time        t           y           total burst time
+ *  char        fileName    y           workload file path
+ *  bool        binary      n           write binary workload file instead of text
+ *  WorkloadWriter w        y           workload file being written, one process at a time
+ *  WorkloadReader rd       y           workload file being read, one process at a time (pipe)
+ *
+ *  workload file format: `pid arrival burst priority` per line, `#` for comment
+ *  arrival is 0 ~ `ARRIVAL_LIMIT` - 1 and priority is within `PRIORITY_LIMIT` (priority key of PP)
+ *
+ *  binary workload file format (compact 64-bit time, little endian base 128 varint):
+ *      magic `WORKLOAD_MAGIC` (4 bytes), version `WORKLOAD_VERSION` (1 byte), varint process count
+ *      each process: zigzag varint arrival - previous arrival, varint burst,
+ *                    zigzag varint pid - previous pid, zigzag varint priority
+ *      arrival sorted workload with sequential pid takes 4 ~ 6 bytes for each process
+ *      process count may be padded with 0x80 bytes (written last when streaming)
+ *      process count 0 of a stream: processes until the end of file
+ *
+ */
+
+#define LINE_MAX_W  256     // maximum length of a workload file line
+#define LABEL_MAX_W 256     // maximum length of a workload label
+#define P_COUNT     5       // default process count
+#define P_PARAM     4       // default process parameters count
+
+#define WORKLOAD_MAGIC      "CPSW"  // binary workload file magic
+#define WORKLOAD_VERSION    1       // binary workload file version
+#define WORKLOAD_COUNT_W    5       // bytes of the process count varint written by `WorkloadWriter`
+
+// process default data to be used by the simulator
+extern int pInfo[P_COUNT][P_PARAM];
+
+/**
+ * @brief structure for loaded workload
+ *
+ */
+typedef struct Workload {
+
+    char label[LABEL_MAX_W];    // workload name (used as output file name prefix)
+    Process *p;                 // process data
+    int n;                      // total process count
+    Time t;                     // total burst time
+
+} Workload;
+
+/**
+ * @brief   initialize process data to be used by the simulator
+ *
+ * @param p         pointer for process structure
+ * @param pid       process no.
+ * @param arrival   process arrival time
+ * @param burst     process burst time
+ * @param priority  process priority
+ */
+void init_process(Process *p, int pid, Time arrival, Time burst, int priority);
+
+/**
+ * @brief   load built-in process data(`pInfo`)
+ *
+ * @param n pointer for total process count
+ * @param t pointer for total burst time
+ * @return  Process*
+ */
+Process* default_workload(int *n, Time *t);
+
+/**
+ * @brief   load process data from workload file (text or binary), sorted by arrival (stable)
+ *
+ * @param fileName  workload file path
+ * @param n         pointer for total process count
+ * @param t         pointer for total burst time
+ * @return  Process* (NULL if the file can't be read or the gantt chart ends after `TIME_MAX`)
+ */
+Process* load_workload(const char *fileName, int *n, Time *t);
+
+/**
+ * @brief structure for workload file being written (streaming, any process order)
+ *
+ */
+typedef struct WorkloadWriter {
+
+    FILE *fp;                   // output file
+    const char *fileName;       // output file path
+    bool binary;                // binary workload file
+    long countPos;              // file position of the process count (binary)
+    long long count;            // written process count
+    long long arrival;          // previous arrival (binary delta)
+    long long pid;              // previous process no. (binary delta)
+
+} WorkloadWriter;
+
+/**
+ * @brief   create workload file to be written one process at a time
+ *
+ * @param w         pointer for workload writer
+ * @param fileName  workload file path (binary file must be seekable)
+ * @param binary    write binary workload file instead of text
+ * @return  bool (false if the file can't be created)
+ */
+bool begin_workload(WorkloadWriter *w, const char *fileName, bool binary);
+
+/**
+ * @brief   write one process to workload file
+ *
+ * @param w pointer for workload writer
+ * @param p pointer for process structure
+ */
+void write_process(WorkloadWriter *w, const Process *p);
+
+/**
+ * @brief   finish and close workload file
+ *
+ * @param w pointer for workload writer
+ * @return  bool (false if the file can't be written)
+ */
+bool end_workload(WorkloadWriter *w);
+
+/**
+ * @brief structure for workload file being read (streaming, pipe or any file, no seek)
+ *
+ */
+typedef struct WorkloadReader {
+
+    FILE *fp;                   // input file
+    const char *fileName;       // input file path (for messages)
+    bool binary;                // binary workload file
+    long long count;            // process count of binary workload (-1: until the end of file)
+    long long read;             // read process count
+    long long line;             // line no. of text workload
+    long long arrival;          // previous arrival (binary delta)
+    long long pid;              // previous process no. (binary delta)
+
+} WorkloadReader;
+
+/**
+ * @brief   start reading workload file one process at a time (text or binary)
+ *
+ * @param rd        pointer for workload reader
+ * @param fp        input file (opened by the caller, e.g. `stdin`)
+ * @param fileName  input file path (for messages)
+ * @return  bool (false if the file is an unsupported binary workload)
+ */
+bool begin_read_workload(WorkloadReader *rd, FILE *fp, const char *fileName);
+
+/**
+ * @brief   read next process of workload file (file order, not sorted)
+ *
+ * @param rd    pointer for workload reader
+ * @param p     pointer for process structure
+ * @return  bool (false at the end of file or invalid process)
+ */
+bool read_process(WorkloadReader *rd, Process *p);
+
+/**
+ * @brief   save process data to workload file
+ *
+ * @param fileName  workload file path
+ * @param p         pointer for process structure
+ * @param n         total process count
+ * @param binary    write binary workload file instead of text
+ * @return  bool (false if the file can't be written)
+ */
+bool save_workload(const char *fileName, const Process *p, int n, bool binary);
+
+#endif
@@ -9,26 +9,32 @@
  * 
  */
 
+// standard library
+#include <string.h>
+#include <unistd.h>
+
 // external library & user define library
-#include "FCFS.h"
-#include "SJF.h"
-#include "HRN.h"
-#include "NPP.h"
-#include "PP.h"
-#include "RR.h"
-#include "SRT.h"
+#include "draw.h"
 #include "main.h"
+#include "optimal.h"
+#include "playback.h"
+#include "plugin.h"
 #include "process.h"
+#include "report.h"
+#include "scheduler.h"
+#include "workload.h"
 #include "raylib.h"
 
 /**
  * @brief main.c variable info
  *  
  *  type        name        pointer     info
- *  Process     gantt       y           pointer to get gantt chart from function
  *  Process     p           y           pointer for process structure
- *  int         total       n           int variable for total burst time of tasks
- *  Image       temp        n           temporary variable for loading images
+ *  Schedule    current     n           scheduling result of the selected algorithm
+ *  OptimalResult best      n           optimal non-preemptive schedule of the processes
+ *  double      gap         n           optimality gap of the selected algorithm
+ *  int         count       n           total process count
+ *  Time        total       n           total burst time of tasks
  *  Texture2D   logo6pm     n           6pm logo image
  *  Texture2D   logoRay     n           laylib logo image
  *  Texture2D   cardImg     n           card image
@@ -36,53 +42,150 @@
  * 
  */
 
-Process *gantt; // pointer to get gantt chart from function
+/**
+ * @brief   headless report mode, no window is created
+ *          usage: --report <dir> [--format png|qoi|gif|cpsr] [--frames] [--delay CS] [--every N] [--algo NAME] [--plugin FILE] [--cache DIR] [--jobs N] [--font FILE] [workload ...]
+ *          - png, qoi: one report image for each workload and algorithm
+ *          - gif: animated playback of the schedule, one frame for each `--every` time units
+ *          - `--frames`: playback as numbered png/qoi images instead of one report
+ *          - cpsr: columnar results file (`include/results.h`), no image
+ *          - `--plugin`: policy plugin (shared object) instead of the built-in algorithms
+ *          - `--cache`: result cache directory, built-in algorithm results are reused (not plugins)
+ *
+ * @param argc  argument count
+ * @param argv  argument string array
+ * @return  int (exit code)
+ */
+int report_main(int argc, char *argv[]) {
+
+    const char *dir  = NULL;            // output directory
+    const char *ext  = ".png";          // output file extension
+    char format[16]  = { 0 };           // output file extension given by arguments
+    const char *font = REPORT_FONT;     // bitmap font path
+    ExportFunc render = export_report;  // function to render and export one schedule
+    bool frames = false;                // write playback as image sequence
+    int algo  = -1;                     // algorithm index, -1 for every algorithm
+    Plugin plugin = { 0 };              // policy plugin loaded by `--plugin`
+    const char *cacheDir = NULL;        // result cache directory
+    ResultCache cache;                  // result cache opened from `cacheDir`
+    int jobs  = 1;                      // worker thread count
+    int count = 0;                      // workload count
+    int given = 0;                      // workload file count given by arguments
+    Workload *w = calloc(argc, sizeof(Workload));
+
+#ifdef _SC_NPROCESSORS_ONLN
+    jobs = (int) sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    // parse command line arguments
+    bool valid = true;
+    for(int i = 1; i < argc && valid; i++) {
+        if(TextIsEqual(argv[i], "--report") && i + 1 < argc)
+            dir = argv[++i];
+        else if(TextIsEqual(argv[i], "--format") && i + 1 < argc)
+            snprintf(format, sizeof(format), ".%s", argv[++i]), ext = format;
+        else if(TextIsEqual(argv[i], "--frames"))
+            frames = true;
+        else if(TextIsEqual(argv[i], "--delay") && i + 1 < argc)
+            playbackDelay = atoi(argv[++i]);
+        else if(TextIsEqual(argv[i], "--every") && i + 1 < argc)
+            valid = (playbackEvery = atoi(argv[++i])) > 0;
+        else if(TextIsEqual(argv[i], "--algo") && i + 1 < argc)
+            valid = (algo = find_algorithm(argv[++i])) >= 0;
+        else if(TextIsEqual(argv[i], "--plugin") && i + 1 < argc && plugin.policy == NULL)
+            valid = load_plugin(argv[++i], &plugin);
+        else if(TextIsEqual(argv[i], "--cache") && i + 1 < argc)
+            cacheDir = argv[++i];
+        else if(TextIsEqual(argv[i], "--jobs") && i + 1 < argc)
+            jobs = atoi(argv[++i]);
+        else if(TextIsEqual(argv[i], "--font") && i + 1 < argc)
+            font = argv[++i];
+        else if(argv[i][0] == '-')
+            valid = false;
+        else if(given++, (w[count].p = load_workload(argv[i], &w[count].n, &w[count].t)) != NULL)
+            strncpy(w[count++].label, GetFileNameWithoutExt(argv[i]), LABEL_MAX_W - 1);
+    }
 
-int main(void) {    
+    // choose exporter by output format
+    if(TextIsEqual(ext, ".gif"))
+        render = export_playback_gif;
+    else if(TextIsEqual(ext, ".cpsr"))
+        render = export_results;
+    else if(TextIsEqual(ext, ".png") || TextIsEqual(ext, ".qoi"))
+        render = frames ? export_playback_frames : export_report;
+    else
+        valid = false;
+
+    if(!valid || dir == NULL) {
+        fprintf(stderr, "usage: %s --report <dir> [--format png|qoi|gif|cpsr] [--frames] [--delay CS] [--every N] [--algo NAME] [--plugin FILE] [--cache DIR] [--jobs N] [--font FILE] [workload ...]\n", argv[0]);
+        for(int i = 0; i < count; i++)
+            free(w[i].p);
+        free(w);
+        unload_plugin(&plugin);
+        return 1;
+    }
 
-    // dynamic memory allocation
+    // use built-in process data if no workload file is given
+    if(given == 0) {
+        w[0].p = default_workload(&w[0].n, &w[0].t);
+        strcpy(w[count++].label, "default");
+    }
 
-    Process *p = malloc(sizeof(Process) * P_COUNT); // process structure pointer to be used by the simulator
+    Font cpuFont = load_report_font(font);
+    if(cpuFont.glyphCount == 0)
+        TraceLog(LOG_WARNING, "REPORT: [%s] failed to load font, text is not drawn", font);
 
-    // load process data to the process structure
+    // cache is optional, reports are made without it if the directory can't be used
+    bool cached = cacheDir != NULL && cache_init(&cache, cacheDir, 0);
 
-    int total = 0; // int variable for total burst time of tasks
-    for(int i = 0; i < P_COUNT; i++) {
-            
-        p[i].processID = pInfo[i][0];
-        p[i].arrival   = pInfo[i][1];
-        p[i].burst     = pInfo[i][2];
-        p[i].priority  = pInfo[i][3];
-        p[i].remain    = p[i].burst;
-        p[i].timeout   = p[i].arrival;
-        p[i].waiting   = 0;
-        p[i].execute   = 0;
-        total         += p[i].burst;
-    }
+    // workload files failed to load are counted as failed reports
+    int failed = export_reports(w, count, algo, plugin.policy, cached ? &cache : NULL, dir, ext, render, cpuFont, jobs < 1 ? 1 : jobs) + given - count;
+    if(failed > 0)
+        TraceLog(LOG_WARNING, "REPORT: %d report(s) failed to export", failed);
 
-    // memory allocate to gantt array
-    gantt = malloc(sizeof(Process) * total);
+    // memory allocate disable
+    unload_report_font(cpuFont);
+    unload_plugin(&plugin);
+    for(int i = 0; i < count; i++)
+        free(w[i].p);
+    free(w);
 
-    // default config settings
-    InitWindow(SCREEN_W, SCREEN_H, "CPU Scheduling Simulator with raylib");
-    SetTargetFPS(TARGET_FPS);
+    return failed > 0;
+}
 
-    Image temp; // temporary variable for loading images
+int main(int argc, char *argv[]) {    
 
-    // load image from `image.h`, and load textrue from image
-    // WARN: be sure to call `InitWindows()` before creating a texture image
+    // run headless report mode if any argument is given
+    if(argc > 1)
+        return report_main(argc, argv);
 
-    temp = LoadImageFromMemory(".png", logo_6pm, LOGO_6PM_LEN);
-    Texture2D logo6pm = LoadTextureFromImage(temp); // 6pm logo texture
+    // load process data to the process structure
+
+    int count = 0; // total process count
+    Time total = 0; // total burst time of tasks
+    Process *p = default_workload(&count, &total); // process structure pointer to be used by the simulator
+
+    Schedule current = { 0 }; // scheduling result of the selected algorithm
+    Metrics metrics  = { 0 }; // average metrics of the selected algorithm
 
-    temp = LoadImageFromMemory(".png", logo_ray, LOGO_RAY_LEN);
-    Texture2D logoRay = LoadTextureFromImage(temp); // raylib logo texture
+    // optimal non-preemptive schedule once: the gap of each algorithm is measured from it
+    OptimalResult best;
+    OptimalOptions bestOpt = { .objective = OPTIMAL_WAITING, .nodeLimit = 1000000 };
+    bool solved = solve_optimal(p, count, &bestOpt, &best);
+    double gap  = 0;
 
-    temp = LoadImageFromMemory(".png", card_img, CARD_IMG_LEN);
-    Texture2D cardImg = LoadTextureFromImage(temp); // card texture
+    // default config settings
+    InitWindow(SCREEN_W, SCREEN_H, "CPU Scheduling Simulator with raylib");
+    SetTargetFPS(TARGET_FPS);
 
-    // unloadimage temporary variable
-    UnloadImage(temp);
+    // load textrue from pre-decoded image of `image.h`
+    // WARN: be sure to call `InitWindows()` before creating a texture image
+    // WARN: `*_IMAGE` points to static data, do not call `UnloadImage()`
+    Texture2D logo6pm = LoadTextureFromImage(LOGO_6PM_IMAGE);   // 6pm logo texture
+    Texture2D logoRay = LoadTextureFromImage(LOGO_RAY_IMAGE);   // raylib logo texture
+    Texture2D cardImg = LoadTextureFromImage(CARD_IMG_IMAGE);   // card texture
 
     // define position for default mouse position
     
@@ -109,6 +212,13 @@ int main(void) {
 
                     // change the flag corresponding to the clicked button
                     btnClickFlag[i] = 1;      
+
+                    // run the algorithm once, result is drawn every frame
+                    free_schedule(&current);
+                    run_algorithm(i, p, count, total, &current);
+                    metrics = get_metrics(&current);
+                    if(solved)
+                        gap = optimal_gap(&best, &current);
                 }
             }
         }
@@ -133,56 +243,9 @@ int main(void) {
                 );
             }
 
-            // draw gantt chart
-            for(int i = 0; i < 7; i++) {
-
-                // if the flag corresponding to the `i` variable is 1
-                if(btnClickFlag[i] == 1) {
-
-                    // enforce algorithms that fit `i` variable
-                    switch(i) {
-                    case 0:
-                        // First Come First Served
-                        FCFS(p, P_COUNT, total, cardImg);
-                        break;
-                        
-                    case 1:
-                        // Shortest Job First
-                        SJF(p, P_COUNT, total, cardImg);
-                        break;
-                        
-                    case 2:
-                        // Highest Responese Ratio Next
-                        HRN(p, P_COUNT, total, cardImg);
-                        break;
-                        
-                    case 3:
-                        // Non-Preemption Prioity
-                        NPP(p, P_COUNT, total, cardImg);
-                        break;
-                        
-                    case 4:
-                        // Preemption Prioity
-                        PP(p, P_COUNT, total, cardImg);
-                        break;
-                        
-                    case 5:
-                        // Round-Robin
-                        RR(p, P_COUNT, total, QAUNTUM, cardImg);
-                        break;
-                        
-                    case 6:
-                        // Shortest Remaining Time
-                        SRT(p, P_COUNT, total, cardImg);
-                        break;
-                        
-                    default:
-                        // if system can't get `i` answer
-                        TraceLog(LOG_WARNING, "unknown variable `i`");
-                        break;
-                    }
-                }
-            }
+            // draw gantt chart and result table of the selected algorithm
+            if(current.algo != NULL)
+                draw_everything(current.result, current.gantt, current.segments, cardImg, current.t, current.n, current.algo, &metrics, solved ? &best : NULL, gap);
 
             DrawTexturePro(
                 logo6pm,    
@@ -215,6 +278,7 @@ int main(void) {
 
     CloseWindow();
 
+    free_schedule(&current);
     free(p);
 
     return 0;
@@ -0,0 +1,35 @@
+/**
+ * @file    FCFS.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   = CPU schedule simulator
+ *          = non preemeption method - FCFS(first come first served)
+ *          - assign to CPU in order of arrival in the ready queue
+ *          - once executed, wait until the next order is over
+ *          - all processes have the same priority
+ * @version 0.1
+ * @date    (first date: 2023-05-03, last date: 2026-10-17)
+ * 
+ * @copyright Copyright (c) 2023 Minsu Bak
+ * 
+ */
+
+// user define library
+#include "FCFS.h"
+#include "engine.h"
+#include "policy.h"
+#include "process.h"
+#include "scheduler.h"
+
+// ready queue order: enqueue order only (FIFO, no `on_arrival`)
+
+// non preemption: the running process keeps the CPU until it terminates
+
+// FCFS scheduling policy
+const Policy policyFCFS = {
+    .name           = "FCFS",
+};
+
+void FCFS(Process *p, int n, Time t, Schedule *s) {
+
+    engine_run(&policyFCFS, 0, p, n, t, s);
+}
@@ -0,0 +1,43 @@
+/**
+ * @file    HRN.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   = CPU schedule simulator
+ *          = non-preemption method - HRN(Highest Response Ratio Next)
+ *          - priority = (waiting + burst) / burst
+ *          - priotiy changes as priority is pushed out
+ *          - 
+ * @version 0.1
+ * @date    (first date: 2023-05-17, last date: 2026-10-17)
+ * 
+ * @copyright Copyright (c) 2023 Minsu Bak
+ * 
+ */
+
+// user define library
+#include "HRN.h"
+#include "engine.h"
+#include "policy.h"
+#include "process.h"
+#include "scheduler.h"
+
+// ready queue key: (waiting + burst) / burst, same formula as `compare_for_HRN()`
+// the key is taken once at arrival, when waiting is 0, so it is 1 for every process and the
+// order is the arrival order (same as FCFS): the behavior of the original simulator is kept
+static long long HRN_arrival(void *data, const Process *p) {
+
+    (void) data;
+    return (p->waiting + p->burst) / p->burst;
+}
+
+// non preemption: the running process keeps the CPU until it terminates
+
+// HRN scheduling policy
+const Policy policyHRN = {
+    .name           = "HRN",
+    .on_arrival     = HRN_arrival,
+};
+
+void HRN(Process *p, int n, Time t, Schedule *s) {
+
+    engine_run(&policyHRN, 0, p, n, t, s);
+}
@@ -0,0 +1,42 @@
+/**
+ * @file    NPP.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   = CPU schedule simulator
+ *          = non preemeption method - NPP(Non-Preemption Priority)
+ *          - assign to CPU in order of priority in the ready queue
+ *          - run first-time task regardless of priority
+ *          -
+ * @version 0.1
+ * @date    (first date: 2023-05-10, last date: 2026-10-17)
+ * 
+ * @copyright Copyright (c) 2023 Minsu Bak
+ * 
+ */
+
+// user define library
+#include "NPP.h"
+#include "engine.h"
+#include "policy.h"
+#include "process.h"
+#include "scheduler.h"
+
+// ready queue order: higher priority (smaller value) first, earlier arrival for the same priority
+// no process enters the ready queue twice: enqueue order is arrival order, the priority is the whole key
+static long long NPP_arrival(void *data, const Process *p) {
+
+    (void) data;
+    return p->priority;
+}
+
+// non preemption: the running process keeps the CPU until it terminates
+
+// NPP scheduling policy
+const Policy policyNPP = {
+    .name           = "NPP",
+    .on_arrival     = NPP_arrival,
+};
+
+void NPP(Process *p, int n, Time t, Schedule *s) {
+
+    engine_run(&policyNPP, 0, p, n, t, s);
+}
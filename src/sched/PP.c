@@ -0,0 +1,47 @@
+/**
+ * @file    PP.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   = CPU schedule simulator
+ *          = preemeption method - PP(Preemption Priority)
+ *          - priority-based algorithm
+ *          - change if other tasks have high priority during operation
+ *          -
+ * @version 0.1
+ * @date    (first date: 2023-05-11, last date: 2026-10-17)
+ * 
+ * @copyright Copyright (c) 2023 Minsu Bak
+ * 
+ */
+
+// user define library
+#include "PP.h"
+#include "engine.h"
+#include "policy.h"
+#include "process.h"
+#include "scheduler.h"
+
+// ready queue order: higher priority (smaller value) first, earlier arrival for the same priority
+static long long PP_arrival(void *data, const Process *p) {
+
+    (void) data;
+    return priority_key(p->priority, p->arrival);
+}
+
+// preemption: the next process has higher priority than the running process
+static bool PP_preempt(void *data, const Process *next, const Process *cur) {
+
+    (void) data;
+    return next->priority < cur->priority;
+}
+
+// PP scheduling policy
+const Policy policyPP = {
+    .name           = "PP",
+    .on_arrival     = PP_arrival,
+    .should_preempt = PP_preempt,
+};
+
+void PP(Process *p, int n, Time t, Schedule *s) {
+
+    engine_run(&policyPP, 0, p, n, t, s);
+}
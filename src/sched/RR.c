@@ -0,0 +1,42 @@
+/**
+ * @file    RR.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   = CPU schedule simulator
+ *          = preemption method - RR(Round-Robin)
+ *          - run by time quantum variable and move to next action
+ *          -
+ *          -
+ * @version 0.1
+ * @date    (first date: 2023-05-15, last date: 2026-10-17)
+ * 
+ * @copyright Copyright (c) 2023 Minsu Bak
+ * 
+ */
+
+// user define library
+#include "RR.h"
+#include "engine.h"
+#include "policy.h"
+#include "process.h"
+#include "scheduler.h"
+
+// ready queue order: enqueue order only (FIFO, no `on_arrival`)
+
+// time quantum expiration: the running process executed `q` time units
+static bool RR_expire(void *data, const Process *cur, int q) {
+
+    (void) data;
+    return cur->execute == q;
+}
+
+// RR scheduling policy
+const Policy policyRR = {
+    .name           = "RR",
+    .quantum        = QAUNTUM,
+    .on_tick_expire = RR_expire,
+};
+
+void RR(Process *p, int n, Time t, int q, Schedule *s) {
+
+    engine_run(&policyRR, q, p, n, t, s);
+}
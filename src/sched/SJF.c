@@ -0,0 +1,41 @@
+/**
+ * @file    SJF.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   = CPU schedule simulator
+ *          = non preemeption method - SJF(Shortest Job First)
+ *          - assign to CPU in order of burst time in the ready queue
+ *          - improve efficiency by reducing the Conboy effect
+ *          -
+ * @version 0.1
+ * @date    (first date: 2023-05-09, last date: 2026-10-17)
+ * 
+ * @copyright Copyright (c) 2023 Minsu Bak
+ * 
+ */
+
+// user define library
+#include "SJF.h"
+#include "engine.h"
+#include "policy.h"
+#include "process.h"
+#include "scheduler.h"
+
+// ready queue order: shorter burst time first
+static long long SJF_arrival(void *data, const Process *p) {
+
+    (void) data;
+    return p->burst;
+}
+
+// non preemption: the running process keeps the CPU until it terminates
+
+// SJF scheduling policy
+const Policy policySJF = {
+    .name           = "SJF",
+    .on_arrival     = SJF_arrival,
+};
+
+void SJF(Process *p, int n, Time t, Schedule *s) {
+
+    engine_run(&policySJF, 0, p, n, t, s);
+}
@@ -0,0 +1,47 @@
+/**
+ * @file    SRT.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   = CPU schedule simulator
+ *          = preemption method - SRT(Shortest Remaining Time)
+ *          - less task left to work first of all
+ *          - less worklaod transforms tasks to exist
+ *          -
+ * @version 0.1
+ * @date    (first date: 2023-05-17, last date: 2026-10-17)
+ * 
+ * @copyright Copyright (c) 2023 Minsu Bak
+ * 
+ */
+
+// user define library
+#include "SRT.h"
+#include "engine.h"
+#include "policy.h"
+#include "process.h"
+#include "scheduler.h"
+
+// ready queue order: shorter remain time first
+static long long SRT_arrival(void *data, const Process *p) {
+
+    (void) data;
+    return p->remain;
+}
+
+// preemption: the next process has shorter remain time than the running process
+static bool SRT_preempt(void *data, const Process *next, const Process *cur) {
+
+    (void) data;
+    return next->remain < cur->remain;
+}
+
+// SRT scheduling policy
+const Policy policySRT = {
+    .name           = "SRT",
+    .on_arrival     = SRT_arrival,
+    .should_preempt = SRT_preempt,
+};
+
+void SRT(Process *p, int n, Time t, Schedule *s) {
+
+    engine_run(&policySRT, 0, p, n, t, s);
+}
@@ -0,0 +1,188 @@
+/**
+ * @file    analytic.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   analytic M/G/1 estimators of libcpusched (no simulation)
+ *          - burst pmf: P(burst = j) = F(j + 0.5) - F(j - 0.5) of the continuous distribution,
+ *            burst 1 takes everything under 1.5 (same rounding as `generator_source()`)
+ *          - size based formulas (SJF, SRT) walk the pmf once with the partial load
+ *            ρ(x) = λ Σ_{j <= x} j p_j, a burst tie never preempts or jumps ahead (FIFO)
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// standard library
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// user define library
+#include "analytic.h"
+#include "scheduler.h"
+
+/**
+ * @brief analytic.c variable info
+ *
+ *  type        name        pointer     info
+ *  double      pmf         y           probability of each burst (index: burst)
+ *  int         max         n           largest burst of the pmf
+ *  double      lambda      n           arrival rate
+ *  double      w0          n           mean residual work of the server (λ E[S²] / 2)
+ *  double      before      n           load of the classes served before this one
+ *  double      upto        n           load of the classes up to this one
+ *
+ */
+
+/**
+ * @brief   cumulative distribution of the burst before rounding
+ *
+ * @param spec  distribution spec
+ * @param x     burst time
+ * @return  double
+ */
+static double burst_cdf(const ArrivalGen *spec, double x) {
+
+    double m = spec->meanBurst, cv2 = spec->cv * spec->cv;
+
+    if(x <= 0)
+        return 0;
+    if(spec->cv == 0)
+        return x >= m ? 1 : 0;
+
+    // Erlang of k phases (same k as the generator)
+    if(cv2 < 1) {
+        int k = (int) (1.0 / cv2 + 0.5);
+        double mx = k / m * x, sum = 0;
+        for(int n = 0; n < k; n++)
+            sum += exp(-mx + n * log(mx) - lgamma(n + 1.0));
+        return 1 - sum;
+    }
+    if(cv2 == 1)
+        return 1 - exp(-x / m);
+
+    // balanced two-phase hyperexponential
+    double p1 = 0.5 * (1 + sqrt((cv2 - 1) / (cv2 + 1)));
+    return 1 - p1 * exp(-x * 2 * p1 / m) - (1 - p1) * exp(-x * 2 * (1 - p1) / m);
+}
+
+/**
+ * @brief   probability of each burst after rounding to time units
+ *
+ * @param spec  distribution spec
+ * @param max   pointer for largest burst
+ * @return  double* (index: burst, 0 is unused)
+ */
+static double* burst_pmf(const ArrivalGen *spec, int *max) {
+
+    int capacity = 1024;
+    double *pmf  = calloc(capacity, sizeof(double));
+    double prev  = burst_cdf(spec, 1.5);
+
+    pmf[1] = prev;
+    *max   = 1;
+    for(int j = 2; 1 - prev > ANALYTIC_TAIL && j <= ANALYTIC_MAX_BURST; j++) {
+        if(j == capacity) {
+            capacity *= 2;
+            pmf = realloc(pmf, sizeof(double) * capacity);
+        }
+        double cdf = burst_cdf(spec, j + 0.5);
+        pmf[j] = cdf - prev;
+        prev   = cdf;
+        *max   = j;
+    }
+
+    // the cut tail stays at the largest burst
+    pmf[*max] += 1 - prev > 0 ? 1 - prev : 0;
+    return pmf;
+}
+
+bool analytic_supported(int algo) {
+
+    if(algo < 0 || algo >= ALGO_COUNT)
+        return false;
+
+    const char *name = algoName[algo];
+    return strcmp(name, "FCFS") == 0 || strcmp(name, "SJF") == 0 || strcmp(name, "NPP") == 0
+        || strcmp(name, "PP") == 0 || strcmp(name, "SRT") == 0;
+}
+
+bool analytic_estimate(int algo, const ArrivalGen *spec, AnalyticResult *r) {
+
+    *r = (AnalyticResult) { 0 };
+    if(!analytic_supported(algo) || spec->rate <= 0 || spec->meanBurst <= 0)
+        return false;
+
+    int max;
+    double *pmf = burst_pmf(spec, &max);
+    double lambda = spec->rate;
+    const char *name = algoName[algo];
+
+    for(int j = 1; j <= max; j++) {
+        r->mean_burst    += j * pmf[j];
+        r->second_moment += (double) j * j * pmf[j];
+    }
+    r->rho    = lambda * r->mean_burst;
+    r->stable = r->rho < 1;
+    if(!r->stable) {
+        r->avg_waiting = r->avg_turnaround = INFINITY;
+        free(pmf);
+        return true;
+    }
+
+    double w0 = lambda * r->second_moment / 2;
+    int k     = spec->priorities > 0 ? spec->priorities : 1;
+
+    // Pollaczek-Khinchine
+    if(strcmp(name, "FCFS") == 0)
+        r->avg_turnaround = w0 / (1 - r->rho) + r->mean_burst;
+
+    // Cobham: class i waits for the residual work and every class up to i
+    else if(strcmp(name, "NPP") == 0) {
+        for(int i = 1; i <= k; i++) {
+            double before = r->rho * (i - 1) / k, upto = r->rho * i / k;
+            r->avg_turnaround += (w0 / ((1 - before) * (1 - upto)) + r->mean_burst) / k;
+        }
+    }
+
+    // preemptive-resume priority: only the classes up to i delay class i
+    else if(strcmp(name, "PP") == 0) {
+        for(int i = 1; i <= k; i++) {
+            double before = r->rho * (i - 1) / k, upto = r->rho * i / k;
+            r->avg_turnaround += (r->mean_burst / (1 - before) + w0 * i / k / ((1 - before) * (1 - upto))) / k;
+        }
+    }
+
+    // Cobham with a class for each burst (shortest first, FIFO for the same burst)
+    else if(strcmp(name, "SJF") == 0) {
+        double before = 0;
+        for(int x = 1; x <= max; x++) {
+            double upto = before + lambda * x * pmf[x];
+            r->avg_turnaround += pmf[x] * (w0 / ((1 - before) * (1 - upto)) + x);
+            before = upto;
+        }
+    }
+
+    // Schrage-Miller: waiting for the work up to x (arrivals of the same burst do not jump ahead,
+    // so the busy period grows with the shorter arrivals only), then residence with every shorter arrival
+    else {
+        double load = 0, second = 0, residence = 0, tail = 1;
+        for(int x = 1; x <= max; x++) {
+            double shorter = load;
+            residence += 1 / (1 - shorter);
+            load      += lambda * x * pmf[x];
+            second    += (double) x * x * pmf[x];
+            tail      -= pmf[x];
+            double wait = lambda * (second + (double) x * x * (tail > 0 ? tail : 0)) / (2 * (1 - load) * (1 - shorter));
+            r->avg_turnaround += pmf[x] * (wait + residence);
+        }
+    }
+
+    r->avg_waiting = r->avg_turnaround - r->mean_burst;
+
+    // memory allocate disable
+    free(pmf);
+
+    return true;
+}
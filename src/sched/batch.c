@@ -0,0 +1,256 @@
+/**
+ * @file    batch.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   batched engine of libcpusched: many small workloads of the same size at once
+ *          - workloads are moved into the lanes of a group (process data in arrival order),
+ *            the kernel of the instruction set runs the whole group, the sums are taken back
+ *          - AVX2 and AVX-512 kernels are built for their instruction set (function attribute)
+ *            and selected at run time, the generic kernel is built for the base instruction set
+ *          - a workload that does not fit in 32-bit lanes runs on the ordinary engine
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// standard library
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// user define library
+#include "batch.h"
+#include "RR.h"
+#include "scheduler.h"
+
+/**
+ * @brief batch.c variable info
+ *
+ *  type            name        pointer     info
+ *  BatchLanes      b           y           process data and sums of a group of lanes
+ *  BatchAlgo       mode        n           algorithm of the lanes (resolved from `algoName` once per run)
+ *  LaneKernel      kernel      y           lockstep kernel of an instruction set
+ *  #define         BATCH_X86   n           AVX2 and AVX-512 kernels are built (x86 with GCC or clang)
+ *  #define         BATCH_KEY   n           largest key in a lane (priority, burst or response ratio)
+ *
+ */
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(__EMSCRIPTEN__)
+    #define BATCH_X86
+#endif
+
+#define BATCH_KEY   (1 << 30)   // largest key in a lane (priority, burst or response ratio)
+
+// instruction set name (`BatchIsa` order)
+const char *batchIsaName[BATCH_ISAS] = { "auto", "generic", "avx2", "avx512" };
+
+/**
+ * @brief structure for process data and sums of a group of lanes
+ *
+ */
+typedef struct BatchLanes {
+
+    int32_t arrival[BATCH_MAX_PROCESS * BATCH_LANES];   // arrival time (index: process * lanes + lane)
+    int32_t burst[BATCH_MAX_PROCESS * BATCH_LANES];     // remain time at arrival
+    int32_t key[BATCH_MAX_PROCESS * BATCH_LANES];       // ready queue key (SJF, HRN, NPP)
+    int32_t turnaround[BATCH_LANES];                    // the sum of turnaround of each lane
+    int32_t response[BATCH_LANES];                      // the sum of response of each lane
+
+} BatchLanes;
+
+/**
+ * @brief algorithm of the lanes, resolved from the name in `algoName` (no index is assumed)
+ *
+ */
+typedef enum BatchAlgo {
+
+    BATCH_NONE,     // not run in lanes (preemption by key: PP, SRT)
+    BATCH_FCFS,     // arrival order
+    BATCH_SJF,      // key: burst time
+    BATCH_HRN,      // key: response ratio at arrival
+    BATCH_NPP,      // key: priority
+    BATCH_RR        // arrival order, time quantum
+
+} BatchAlgo;
+
+// lockstep kernel of an instruction set
+typedef void (*LaneKernel)(BatchLanes *b, int n, bool keyed, int32_t q);
+
+// generic kernel: base instruction set of the build (one 128-bit register: SSE2, NEON)
+#define LANE_COUNT  4
+#define LANE_NAME   lanes_generic
+#define LANE_TARGET
+#include "lanes.h"
+
+#ifdef BATCH_X86
+    #define LANE_COUNT  8
+    #define LANE_NAME   lanes_avx2
+    #define LANE_TARGET __attribute__((target("avx2")))
+    #include "lanes.h"
+
+    #define LANE_COUNT  16
+    #define LANE_NAME   lanes_avx512
+    #define LANE_TARGET __attribute__((target("avx512f")))
+    #include "lanes.h"
+#endif
+
+bool batch_supported(BatchIsa isa) {
+
+    switch(isa) {
+    case BATCH_AUTO:
+    case BATCH_GENERIC:
+        return true;
+#ifdef BATCH_X86
+    case BATCH_AVX2:
+        return __builtin_cpu_supports("avx2");
+    case BATCH_AVX512:
+        return __builtin_cpu_supports("avx512f");
+#endif
+    default:
+        return false;
+    }
+}
+
+// widest instruction set supported for `BATCH_AUTO`
+static BatchIsa batch_resolve(BatchIsa isa) {
+
+    if(isa != BATCH_AUTO)
+        return isa;
+    return batch_supported(BATCH_AVX512) ? BATCH_AVX512 : batch_supported(BATCH_AVX2) ? BATCH_AVX2 : BATCH_GENERIC;
+}
+
+int batch_lanes(BatchIsa isa) {
+
+    if(!batch_supported(isa))
+        return 0;
+    isa = batch_resolve(isa);
+    return isa == BATCH_AVX512 ? 16 : isa == BATCH_AVX2 ? 8 : 4;
+}
+
+// algorithm of the lanes for the algorithm index (`BATCH_NONE` if not supported)
+static BatchAlgo batch_algo(int algo) {
+
+    const char *name[] = { NULL, "FCFS", "SJF", "HRN", "NPP", "RR" };    // `BatchAlgo` order
+
+    if(algo < 0 || algo >= ALGO_COUNT)
+        return BATCH_NONE;
+    for(int mode = BATCH_FCFS; mode <= BATCH_RR; mode++)
+        if(strcmp(algoName[algo], name[mode]) == 0)
+            return (BatchAlgo) mode;
+    return BATCH_NONE;
+}
+
+/**
+ * @brief   sort a workload by arrival (stable) and check it fits in a lane
+ *
+ * @param p     pointer for process structure (sorted in place)
+ * @param n     total process count
+ * @param mode  algorithm of the lanes (key of the ready queue)
+ * @param key   pointer for ready queue key of each process
+ * @return  bool (false if the workload runs on the ordinary engine)
+ */
+static bool batch_prepare(Process *p, int n, BatchAlgo mode, int32_t *key) {
+
+    // insertion sort: a few processes, usually sorted already
+    for(int i = 1; i < n; i++) {
+        Process x = p[i];
+        int j = i;
+        for(; j > 0 && p[j - 1].arrival > x.arrival; j--)
+            p[j] = p[j - 1];
+        p[j] = x;
+    }
+
+    // the CPU is busy from each arrival until the ready queue is empty, same as the engine
+    Time length = 0;
+    for(int i = 0; i < n; i++) {
+        if(p[i].arrival < 0 || p[i].remain < 1 || p[i].burst < 1 || p[i].burst > BATCH_MAX_TIME)
+            return false;
+        length = (p[i].arrival > length ? p[i].arrival : length) + p[i].remain;
+        if(length > BATCH_MAX_TIME)
+            return false;
+
+        // same order as the `on_arrival` key of the policy, the tie of arrival is the lane order
+        long long k = mode == BATCH_SJF ? p[i].burst : mode == BATCH_HRN ? (p[i].waiting + p[i].burst) / p[i].burst
+                    : mode == BATCH_NPP ? p[i].priority : 0;
+        if(k <= -BATCH_KEY || k >= BATCH_KEY)
+            return false;
+        key[i] = (int32_t) k;
+    }
+
+    return true;
+}
+
+bool run_batch(int algo, const Process *p, int n, int count, int q, BatchIsa isa, BatchResult *out) {
+
+    BatchAlgo mode = batch_algo(algo);
+    if(mode == BATCH_NONE || n < 1 || n > BATCH_MAX_PROCESS || count < 0 || !batch_supported(isa))
+        return false;
+
+    LaneKernel kernel = lanes_generic;
+    isa = batch_resolve(isa);
+#ifdef BATCH_X86
+    if(isa == BATCH_AVX2)
+        kernel = lanes_avx2;
+    if(isa == BATCH_AVX512)
+        kernel = lanes_avx512;
+#endif
+    int lanes  = batch_lanes(isa);
+    bool keyed = mode == BATCH_SJF || mode == BATCH_HRN || mode == BATCH_NPP;
+    if(q <= 0)
+        q = QAUNTUM;
+
+    BatchLanes *b = malloc(sizeof(BatchLanes));
+    if(b == NULL)
+        return false;
+    Process w[BATCH_MAX_PROCESS];
+    int32_t key[BATCH_MAX_PROCESS];
+    Time executed[BATCH_LANES];
+    bool used[BATCH_LANES];
+
+    for(int g = 0; g < count; g += lanes) {
+        // move each workload of the group into its lane
+        for(int l = 0; l < lanes; l++) {
+            used[l]     = false;
+            executed[l] = 0;
+            if(g + l < count) {
+                memcpy(w, &p[(size_t) (g + l) * n], sizeof(Process) * n);
+                used[l] = batch_prepare(w, n, mode, key);
+            }
+
+            // out of the lane range: ordinary engine with the same result
+            if(g + l < count && !used[l]) {
+                Schedule s = { 0 };
+                Time t     = 0;
+                for(int i = 0; i < n; i++)
+                    t += w[i].burst;
+                if(mode == BATCH_RR)
+                    RR(w, n, t, q, &s);
+                else
+                    run_algorithm(algo, w, n, t, &s);
+                out[g + l] = (BatchResult) { s.total_turnaround, s.total_waiting, s.total_response };
+                free_schedule(&s);
+            }
+
+            // empty lane: one process of one time unit each
+            for(int i = 0; i < n; i++) {
+                b->arrival[i * lanes + l] = used[l] ? (int32_t) w[i].arrival : 0;
+                b->burst[i * lanes + l]   = used[l] ? (int32_t) w[i].remain : 1;
+                b->key[i * lanes + l]     = used[l] ? key[i] : 0;
+                executed[l]              += used[l] ? w[i].remain : 0;
+            }
+        }
+
+        kernel(b, n, keyed, mode == BATCH_RR ? q : INT32_MAX);
+
+        // waiting is turnaround without the time executed
+        for(int l = 0; l < lanes; l++)
+            if(used[l])
+                out[g + l] = (BatchResult) { b->turnaround[l], b->turnaround[l] - executed[l], b->response[l] };
+    }
+
+    // memory allocate disable
+    free(b);
+
+    return true;
+}
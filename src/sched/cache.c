@@ -0,0 +1,291 @@
+/**
+ * @file    cache.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   content-addressed result cache of libcpusched
+ *          - file name: `<dir>/<32 hex digits of the key>.cpsr`
+ *          - the directory size is estimated from the puts, eviction scans the directory only
+ *            when the estimate passes the limit, and removes files down to 90% of the limit
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// standard library
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <utime.h>
+
+#ifdef _WIN32
+    #include <direct.h>
+    #include <process.h>
+#else
+    #include <unistd.h>
+#endif
+
+// user define library
+#include "cache.h"
+#include "results.h"
+
+/**
+ * @brief cache.c variable info
+ *
+ *  type        name        pointer     info
+ *  #define     PRIME_1     n           multiplier of hash lane 0
+ *  #define     PRIME_2     n           multiplier of hash lane 1
+ *  CacheFile   file        y           results file in the cache directory (eviction)
+ *  char        path        y           path of the results file of the key
+ *  int         tmpSeq      n           sequence no. of temporary files in this process
+ *
+ */
+
+#define PRIME_1 0x9e3779b185ebca87ULL   // multiplier of hash lane 0
+#define PRIME_2 0xc2b2ae3d27d4eb4fULL   // multiplier of hash lane 1
+
+/**
+ * @brief structure for results file in the cache directory
+ *
+ */
+typedef struct CacheFile {
+
+    long long mtime;        // last use (modification time, nanosecond if the system has it)
+    long long size;         // file size
+    char name[48];          // file name
+
+} CacheFile;
+
+// sequence no. of temporary files in this process
+static int tmpSeq = 0;
+
+static unsigned long long rotl64(unsigned long long x, int r) { return x << r | x >> (64 - r); }
+
+// final mix of hash lane (murmur3 finalizer)
+static unsigned long long mix64(unsigned long long x) {
+
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    return x ^ x >> 33;
+}
+
+// add one 64-bit word to both hash lanes
+static void hash_word(CacheKey *k, unsigned long long w) {
+
+    k->h[0] = rotl64(k->h[0] ^ w * PRIME_2, 31) * PRIME_1;
+    k->h[1] = rotl64(k->h[1] + w * PRIME_1, 27) * PRIME_2 + k->h[0];
+}
+
+CacheKey cache_key(const Process *p, int n, const Policy *pol) {
+
+    CacheKey k = { { 0x243f6a8885a308d3ULL ^ CACHE_VERSION, 0x13198a2e03707344ULL ^ RESULTS_VERSION } };
+
+    // workload: input fields of each process in order
+    for(int i = 0; i < n; i++) {
+        hash_word(&k, (unsigned long long) (unsigned int) p[i].processID | (unsigned long long) (unsigned int) p[i].priority << 32);
+        hash_word(&k, (unsigned long long) p[i].arrival);
+        hash_word(&k, (unsigned long long) p[i].burst);
+    }
+
+    // policy configuration: name and quantum
+    size_t len = pol->name ? strlen(pol->name) : 0;
+    for(size_t i = 0; i < len; i += 8) {
+        unsigned long long w = 0;
+        for(size_t j = i; j < len && j < i + 8; j++)
+            w |= (unsigned long long) (unsigned char) pol->name[j] << (j - i) * 8;
+        hash_word(&k, w);
+    }
+    hash_word(&k, (unsigned long long) len << 32 | (unsigned int) pol->quantum);
+    hash_word(&k, (unsigned long long) n);
+
+    k.h[0] = mix64(k.h[0]);
+    k.h[1] = mix64(k.h[1] ^ k.h[0]);
+    return k;
+}
+
+// path of the results file of the key
+static void key_path(const ResultCache *c, CacheKey key, char *path, size_t size) {
+
+    snprintf(path, size, "%s/%016llx%016llx.cpsr", c->dir, key.h[0], key.h[1]);
+}
+
+// results file of the cache directory (`<32 hex digits>.cpsr`)
+static bool is_cache_file(const char *name) {
+
+    size_t len = strlen(name);
+    return len == 37 && strcmp(name + 32, ".cpsr") == 0;
+}
+
+// oldest first
+static int compare_mtime(const void *a, const void *b) {
+
+    const CacheFile *x = a, *y = b;
+    return x->mtime < y->mtime ? -1 : x->mtime > y->mtime ? 1 : strcmp(x->name, y->name);
+}
+
+bool cache_init(ResultCache *c, const char *dir, long long limit) {
+
+    *c = (ResultCache) { .limit = limit > 0 ? limit : CACHE_LIMIT };
+    snprintf(c->dir, sizeof(c->dir), "%s", dir);
+
+    struct stat st;
+#ifdef _WIN32
+    _mkdir(dir);
+#else
+    mkdir(dir, 0755);
+#endif
+    if(stat(dir, &st) != 0 || !S_ISDIR(st.st_mode)) {
+        fprintf(stderr, "WARNING: CACHE: [%s] failed to create directory\n", dir);
+        return false;
+    }
+
+    // size of the directory (and eviction if it is already past the limit)
+    c->size = c->limit + 1;
+    cache_evict(c);
+
+    return true;
+}
+
+bool cache_get(ResultCache *c, CacheKey key, Schedule *s) {
+
+    char path[CACHE_PATH_W + 64];
+    struct stat st;
+
+    key_path(c, key, path, sizeof(path));
+    if(stat(path, &st) != 0)
+        return false;
+
+    // broken file (e.g. disk full at write) is removed and counted as a miss
+    if(!load_results(path, s)) {
+        remove(path);
+        return false;
+    }
+
+    // touch for LRU
+    utime(path, NULL);
+    return true;
+}
+
+bool cache_copy(ResultCache *c, CacheKey key, const char *fileName) {
+
+    char path[CACHE_PATH_W + 64], buf[65536];
+    size_t len;
+
+    key_path(c, key, path, sizeof(path));
+    FILE *in = fopen(path, "rb");
+    if(in == NULL)
+        return false;
+
+    FILE *out = fopen(fileName, "wb");
+    bool ok   = out != NULL;
+    while(ok && (len = fread(buf, 1, sizeof(buf), in)) > 0)
+        ok = fwrite(buf, 1, len, out) == len;
+    ok = !ferror(in) && ok;
+    fclose(in);
+    if(out != NULL && fclose(out) != 0)
+        ok = false;
+
+    if(ok)
+        utime(path, NULL);
+    else
+        fprintf(stderr, "WARNING: CACHE: [%s] failed to copy results file\n", fileName);
+    return ok;
+}
+
+bool cache_put(ResultCache *c, CacheKey key, const Schedule *s) {
+
+    char path[CACHE_PATH_W + 64], tmp[CACHE_PATH_W + 96];
+    int seq = __atomic_fetch_add(&tmpSeq, 1, __ATOMIC_RELAXED);
+
+    key_path(c, key, path, sizeof(path));
+#ifdef _WIN32
+    snprintf(tmp, sizeof(tmp), "%s.%d.%d.tmp", path, _getpid(), seq);
+#else
+    snprintf(tmp, sizeof(tmp), "%s.%d.%d.tmp", path, (int) getpid(), seq);
+#endif
+
+    // atomic write: readers see the old file or the whole new file, never a part of it
+    if(!save_results(tmp, s)) {
+        remove(tmp);
+        return false;
+    }
+#ifdef _WIN32
+    remove(path);
+#endif
+    if(rename(tmp, path) != 0) {
+        fprintf(stderr, "WARNING: CACHE: [%s] failed to rename file\n", path);
+        remove(tmp);
+        return false;
+    }
+
+    struct stat st;
+    if(stat(path, &st) == 0 && __atomic_add_fetch(&c->size, (long long) st.st_size, __ATOMIC_RELAXED) > c->limit)
+        cache_evict(c);
+
+    return true;
+}
+
+int cache_evict(ResultCache *c) {
+
+    // one eviction at a time, others keep going
+    if(__atomic_exchange_n(&c->evicting, 1, __ATOMIC_ACQUIRE))
+        return 0;
+
+    DIR *d = opendir(c->dir);
+    if(d == NULL) {
+        __atomic_store_n(&c->evicting, 0, __ATOMIC_RELEASE);
+        return 0;
+    }
+
+    CacheFile *file = NULL;
+    int count = 0, capacity = 0, removed = 0;
+    long long total = 0;
+    char path[CACHE_PATH_W + 64];
+    struct dirent *e;
+    struct stat st;
+
+    while((e = readdir(d)) != NULL) {
+        if(!is_cache_file(e->d_name))
+            continue;
+        snprintf(path, sizeof(path), "%s/%s", c->dir, e->d_name);
+        if(stat(path, &st) != 0)
+            continue;
+        if(count == capacity) {
+            capacity = capacity ? capacity * 2 : 256;
+            file     = realloc(file, sizeof(CacheFile) * capacity);
+        }
+        file[count].mtime = (long long) st.st_mtime * 1000000000LL;
+#ifdef __linux__
+        file[count].mtime += st.st_mtim.tv_nsec;
+#endif
+        file[count].size  = (long long) st.st_size;
+        snprintf(file[count].name, sizeof(file[count].name), "%s", e->d_name);
+        total += file[count++].size;
+    }
+    closedir(d);
+
+    // least recently used first, down to 90% of the limit so the next puts do not scan again
+    if(total > c->limit) {
+        qsort(file, count, sizeof(CacheFile), compare_mtime);
+        for(int i = 0; i < count && total > c->limit / 10 * 9; i++) {
+            snprintf(path, sizeof(path), "%s/%s", c->dir, file[i].name);
+            if(remove(path) == 0) {
+                total -= file[i].size;
+                removed++;
+            }
+        }
+    }
+
+    __atomic_store_n(&c->size, total, __ATOMIC_RELAXED);
+    __atomic_store_n(&c->evicting, 0, __ATOMIC_RELEASE);
+
+    // memory allocate disable
+    free(file);
+
+    return removed;
+}
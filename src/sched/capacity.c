@@ -0,0 +1,289 @@
+/**
+ * @file    capacity.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   capacity planning of libcpusched: maximum arrival rate under a latency SLO
+ *          - every round is one task list over the worker threads (`pool.h`):
+ *            `k` probes for each policy still searching, `k` = threads / policies (at least 1)
+ *          - probe: waiting of each termination in a buffer, MSER-5 warm-up (`steady.h`),
+ *            quantile of the rest, and `STEADY_BATCHES` batch quantiles for the confidence bounds
+ *          - the burst distribution is the same for every probe, its mean comes from
+ *            the rounded distribution of `analytic.h`
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// standard library
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// user define library
+#include "analytic.h"
+#include "capacity.h"
+#include "pool.h"
+#include "scheduler.h"
+#include "steady.h"
+#include "stream.h"
+
+/**
+ * @brief capacity.c variable info
+ *
+ *  type            name        pointer     info
+ *  Sample          sm          y           waiting of each termination of a probe
+ *  Probe           probe       y           one probe: policy, arrival rate and the estimate
+ *  Search          search      y           bracket of each policy
+ *  CapacityRun     run         y           probes of the present round
+ *  double          lo          n           highest probed rate meeting the SLO (bracket low)
+ *  double          hi          n           lowest probed rate missing the SLO (bracket high)
+ *
+ */
+
+/**
+ * @brief structure for waiting of each termination of a probe
+ *
+ */
+typedef struct Sample {
+
+    double *v;          // waiting in termination order
+    long long count;    // value count
+    long long limit;    // values to collect
+
+} Sample;
+
+/**
+ * @brief structure for one probe
+ *
+ */
+typedef struct Probe {
+
+    int policy;         // index of the policy array
+    double rate;        // arrival rate
+    double value;       // quantile of waiting after the warm-up
+    double halfWidth;   // half-width of its confidence interval (batch quantiles)
+    bool failed;        // not enough memory or the stream ended early
+
+} Probe;
+
+/**
+ * @brief structure for bracket of each policy
+ *
+ */
+typedef struct Search {
+
+    double lo;          // highest probed rate meeting the SLO
+    double hi;          // lowest probed rate missing the SLO
+    bool done;          // bracket is narrower than the tolerance
+
+} Search;
+
+/**
+ * @brief structure for probes of the present round
+ *
+ */
+typedef struct CapacityRun {
+
+    const Policy *const *pol;       // policy array
+    const CapacityOptions *opt;     // options
+    Probe *probe;                   // probes of the round
+    double quantile;                // quantile of the SLO
+    double confidence;              // confidence level
+    long long samples;              // terminations of each probe
+
+} CapacityRun;
+
+// each termination: waiting into the buffer
+static void sample_add(void *data, const Process *p, Time completion) {
+
+    Sample *sm = data;
+    if(sm->count < sm->limit)
+        sm->v[sm->count++] = (double) (completion - p->arrival - p->burst);
+}
+
+// stop once the buffer is full
+static bool sample_full(void *data, Time time) {
+
+    (void) time;
+    return ((Sample*) data)->count >= ((Sample*) data)->limit;
+}
+
+static int compare_double(const void *a, const void *b) {
+
+    double x = *(const double*) a, y = *(const double*) b;
+    return x < y ? -1 : x > y;
+}
+
+// quantile of sorted values (nearest rank)
+static double sorted_quantile(const double *v, long long n, double q) {
+
+    long long rank = (long long) ceil(q * n);
+    return v[rank < 1 ? 0 : rank > n ? n - 1 : rank - 1];
+}
+
+/**
+ * @brief   run one probe: simulation at the rate, warm-up cut, quantile and its bounds
+ *
+ * @param data  pointer for probes of the round (`CapacityRun`)
+ * @param i     probe index
+ */
+static void probe_task(void *data, int i) {
+
+    CapacityRun *run = data;
+    Probe *pr = &run->probe[i];
+    const CapacityOptions *opt = run->opt;
+
+    Sample sm = { .v = malloc(sizeof(double) * run->samples), .limit = run->samples };
+    StreamStats *st = malloc(sizeof(StreamStats));
+    StreamOptions so = { .data = &sm, .on_complete = sample_add, .should_stop = sample_full };
+    ArrivalGen gen;
+    SteadyState ss = { 0 };
+    SteadyEstimate est;
+
+    pr->value = pr->halfWidth = 0;
+    pr->failed = sm.v == NULL || st == NULL || !steady_init(&ss);
+    if(!pr->failed) {
+        init_generator(&gen, pr->rate, opt->meanBurst, opt->cv, opt->priorities, 0, opt->seed);
+        run_stream(run->pol[pr->policy], generator_source, &gen, &so, st);
+        pr->failed = st->failed;
+    }
+    if(pr->failed) {
+        steady_free(&ss);
+        free(sm.v);
+        free(st);
+        return;
+    }
+
+    // warm-up: MSER-5 on the waiting in termination order
+    for(long long k = 0; k < sm.count; k++)
+        steady_add(&ss, sm.v[k]);
+    long long cut = steady_estimate(&ss, run->confidence, &est) ? est.truncated : 0;
+    steady_free(&ss);
+
+    // batch quantiles after the warm-up (the remainder is dropped from the front)
+    long long size = (sm.count - cut) / STEADY_BATCHES;
+    double *rest   = sm.v + cut;
+    long long n    = sm.count - cut;
+    if(size >= 1) {
+        double y[STEADY_BATCHES], sum = 0, dev = 0;
+        double *batch = sm.v + sm.count - size * STEADY_BATCHES;
+        for(int j = 0; j < STEADY_BATCHES; j++) {
+            qsort(batch + j * size, size, sizeof(double), compare_double);
+            y[j] = sorted_quantile(batch + j * size, size, run->quantile);
+            sum += y[j];
+        }
+        for(int j = 0; j < STEADY_BATCHES; j++)
+            dev += (y[j] - sum / STEADY_BATCHES) * (y[j] - sum / STEADY_BATCHES);
+        pr->halfWidth = t_quantile(STEADY_BATCHES - 1, run->confidence) * sqrt(dev / (STEADY_BATCHES - 1) / STEADY_BATCHES);
+    }
+    if(n > 0) {
+        qsort(rest, n, sizeof(double), compare_double);
+        pr->value = sorted_quantile(rest, n, run->quantile);
+    }
+
+    // memory allocate disable
+    free(sm.v);
+    free(st);
+}
+
+bool plan_capacity(const Policy *const *pol, int count, const CapacityOptions *opt, CapacityResult *res) {
+
+    if(count < 1 || opt->meanBurst < 1 || opt->slo < 0)
+        return false;
+
+    // mean of the rounded burst distribution: load 1 is the end of the search
+    ArrivalGen spec;
+    AnalyticResult ar;
+    init_generator(&spec, 1, opt->meanBurst, opt->cv, opt->priorities, 0, opt->seed);
+    analytic_estimate(find_algorithm("FCFS"), &spec, &ar);
+    double mean = ar.mean_burst > 0 ? ar.mean_burst : opt->meanBurst;
+
+    CapacityRun run = {
+        .pol        = pol,
+        .opt        = opt,
+        .quantile   = opt->quantile > 0 ? opt->quantile : 0.99,
+        .confidence = opt->confidence > 0 ? opt->confidence : 0.95,
+        .samples    = opt->samples > 0 ? opt->samples : CAPACITY_SAMPLES
+    };
+    double tolerance = opt->tolerance > 0 ? opt->tolerance : 0.005;
+    int jobs         = opt->jobs > 0 ? opt->jobs : pool_default_jobs();
+    Search *search   = malloc(sizeof(Search) * count);
+    run.probe        = malloc(sizeof(Probe) * (count * jobs + count));
+    if(search == NULL || run.probe == NULL) {
+        fprintf(stderr, "WARNING: CAPACITY: not enough memory for %d policies\n", count);
+        free(run.probe);
+        free(search);
+        return false;
+    }
+
+    for(int i = 0; i < count; i++) {
+        search[i] = (Search) { .lo = 0, .hi = 1 / mean };
+        res[i]    = (CapacityResult) { .high = 1 / mean };
+    }
+
+    for(int round = 0; round < CAPACITY_ROUNDS; round++) {
+
+        // probes of the round: `k` rates evenly inside the bracket of each policy still searching
+        int active = 0, probes = 0;
+        for(int i = 0; i < count; i++)
+            active += !search[i].done;
+        if(active == 0)
+            break;
+        int k = jobs / active > 1 ? jobs / active : 1;
+        for(int i = 0; i < count; i++) {
+            if(search[i].done)
+                continue;
+            for(int j = 1; j <= k; j++)
+                run.probe[probes++] = (Probe) { .policy = i, .rate = search[i].lo + (search[i].hi - search[i].lo) * j / (k + 1) };
+        }
+
+        run_pool(probe_task, &run, probes, jobs);
+        for(int p = 0; p < probes; p++) {
+            if(run.probe[p].failed) {
+                fprintf(stderr, "WARNING: CAPACITY: [%s] probe at rate %g failed, the plan stops\n", pol[run.probe[p].policy]->name, run.probe[p].rate);
+                free(run.probe);
+                free(search);
+                return false;
+            }
+        }
+
+        // probes of each policy are in ascending rate: the bracket ends at the first miss
+        for(int p = 0; p < probes; p++) {
+            Probe *pr = &run.probe[p];
+            Search *s = &search[pr->policy];
+            CapacityResult *r = &res[pr->policy];
+
+            r->probes++;
+            if(pr->value + pr->halfWidth <= opt->slo && pr->rate > r->low)
+                r->low = pr->rate;
+            if(pr->value - pr->halfWidth > opt->slo && pr->rate < r->high)
+                r->high = pr->rate;
+
+            if(pr->rate <= s->lo || pr->rate >= s->hi)
+                continue;
+            if(pr->value <= opt->slo) {
+                s->lo        = pr->rate;
+                r->value     = pr->value;
+                r->halfWidth = pr->halfWidth;
+            }
+            else
+                s->hi = pr->rate;
+        }
+        for(int i = 0; i < count; i++)
+            if((search[i].hi - search[i].lo) * mean < tolerance)
+                search[i].done = true;
+    }
+
+    for(int i = 0; i < count; i++) {
+        res[i].rate = (search[i].lo + search[i].hi) / 2;
+        res[i].load = res[i].rate * mean;
+    }
+
+    // memory allocate disable
+    free(run.probe);
+    free(search);
+
+    return true;
+}
@@ -0,0 +1,558 @@
+/**
+ * @file    checkpoint.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   checkpoint and resume of long scheduling runs (libcpusched)
+ *          - `engine_step()` runs until the next snapshot time, the state is written, repeat
+ *          - the snapshot writer does not allocate (safe in a forked child of a threaded process):
+ *            varints go through a fixed buffer straight to the file descriptor
+ *          - gantt chart segments are appended to the segment log, each snapshot writes only the
+ *            segments since the last one (the state file keeps the segment count)
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// standard library
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+    #include <sys/wait.h>
+    #define CHECKPOINT_FORK
+#endif
+
+#ifdef _WIN32
+    #include <io.h>
+#endif
+
+#ifndef O_BINARY
+    #define O_BINARY 0
+#endif
+
+// user define library
+#include "cache.h"
+#include "checkpoint.h"
+#include "engine.h"
+
+/**
+ * @brief checkpoint.c variable info
+ *
+ *  type            name            pointer     info
+ *  #define         SNAP_BUFFER     n           bytes of the snapshot write buffer
+ *  #define         SNAP_PATH_W     n           maximum length of snapshot file path
+ *  #define         SEGMENT_BYTES   n           bytes of a record of the segment log
+ *  SnapWriter      w               y           snapshot file writer (no allocation)
+ *  SnapReader      rd              y           snapshot file reader
+ *  Engine          e               y           engine state of the run
+ *  CacheKey        key             n           key of workload and policy configuration
+ *  long long       logged          n           segments already in the segment log
+ *  unsigned long long sum          n           checksum of the snapshot (FNV-1a)
+ *
+ */
+
+#define SNAP_BUFFER 65536   // bytes of the snapshot write buffer
+#define SNAP_PATH_W 4096    // maximum length of snapshot file path
+#define SEGMENT_BYTES 12    // bytes of a record of the segment log (start 8 bytes, process no. 4 bytes)
+
+#define FNV_OFFSET  0xcbf29ce484222325ULL
+#define FNV_PRIME   0x100000001b3ULL
+
+/**
+ * @brief structure for snapshot file writer
+ *
+ */
+typedef struct SnapWriter {
+
+    int fd;                             // file descriptor
+    bool ok;                            // every write succeeded
+    size_t len;                         // bytes in the buffer
+    unsigned long long sum;             // checksum of the bytes written
+    unsigned char buf[SNAP_BUFFER];     // write buffer
+
+} SnapWriter;
+
+/**
+ * @brief structure for snapshot file reader
+ *
+ */
+typedef struct SnapReader {
+
+    FILE *fp;                   // file pointer
+    bool ok;                    // every read succeeded
+    unsigned long long sum;     // checksum of the bytes read
+
+} SnapReader;
+
+// zigzag encoding: small negative value takes a few bytes too
+static unsigned long long zigzag(long long v)           { return ((unsigned long long) v << 1) ^ (unsigned long long) (v >> 63); }
+static long long          unzigzag(unsigned long long v) { return (long long) (v >> 1) ^ -(long long) (v & 1); }
+
+// write the buffer to the file
+static void snap_flush(SnapWriter *w) {
+
+    for(size_t done = 0; w->ok && done < w->len; ) {
+        ssize_t r = write(w->fd, w->buf + done, w->len - done);
+        if(r <= 0)
+            w->ok = false;
+        else
+            done += (size_t) r;
+    }
+    w->len = 0;
+}
+
+static void snap_byte(SnapWriter *w, unsigned char c) {
+
+    if(w->len == SNAP_BUFFER)
+        snap_flush(w);
+    w->buf[w->len++] = c;
+    w->sum = (w->sum ^ c) * FNV_PRIME;
+}
+
+// unsigned varint (7 bits for each byte, lower bits first)
+static void snap_varint(SnapWriter *w, unsigned long long v) {
+
+    while(v >= 0x80) {
+        snap_byte(w, (unsigned char) (v & 0x7f) | 0x80);
+        v >>= 7;
+    }
+    snap_byte(w, (unsigned char) v);
+}
+
+static void snap_signed(SnapWriter *w, long long v) { snap_varint(w, zigzag(v)); }
+
+// process record as zigzag deltas of the previous record (the same process differs in a few fields)
+static void snap_process(SnapWriter *w, const Process *p, Process *prev) {
+
+    snap_signed(w, (long long) p->processID - prev->processID);
+    snap_signed(w, (long long) p->priority - prev->priority);
+    snap_signed(w, p->arrival - prev->arrival);
+    snap_signed(w, p->burst - prev->burst);
+    snap_signed(w, p->remain - prev->remain);
+    snap_signed(w, p->waiting - prev->waiting);
+    snap_signed(w, p->timeout - prev->timeout);
+    snap_signed(w, p->execute - prev->execute);
+    *prev = *p;
+}
+
+static unsigned char read_byte(SnapReader *rd) {
+
+    int c = fgetc(rd->fp);
+    if(c == EOF) {
+        rd->ok = false;
+        return 0;
+    }
+    rd->sum = (rd->sum ^ (unsigned char) c) * FNV_PRIME;
+    return (unsigned char) c;
+}
+
+static unsigned long long read_varint(SnapReader *rd) {
+
+    unsigned long long v = 0;
+    for(int shift = 0; shift < 64 && rd->ok; shift += 7) {
+        unsigned char c = read_byte(rd);
+        v |= (unsigned long long) (c & 0x7f) << shift;
+        if(!(c & 0x80))
+            return v;
+    }
+    rd->ok = false;
+    return 0;
+}
+
+static long long read_signed(SnapReader *rd) { return unzigzag(read_varint(rd)); }
+
+static void read_process(SnapReader *rd, Process *p, Process *prev) {
+
+    p->processID = (int) (prev->processID + read_signed(rd));
+    p->priority  = (int) (prev->priority + read_signed(rd));
+    p->arrival   = prev->arrival + read_signed(rd);
+    p->burst     = prev->burst + read_signed(rd);
+    p->remain    = prev->remain + read_signed(rd);
+    p->waiting   = prev->waiting + read_signed(rd);
+    p->timeout   = prev->timeout + read_signed(rd);
+    p->execute   = prev->execute + read_signed(rd);
+    *prev = *p;
+}
+
+/**
+ * @brief   write the gantt chart segments since the last snapshot to the segment log
+ *          (no allocation, called in the forked child)
+ *          records from `logged` on are overwritten: left by a failed write or an older run
+ *
+ * @param e         pointer for engine state
+ * @param logged    segments already in the segment log
+ * @param fileName  snapshot file path (the log is `<file>.seg`)
+ * @return  bool
+ */
+static bool write_segments(const Engine *e, long long logged, const char *fileName) {
+
+    static SnapWriter w;
+    char log[SNAP_PATH_W];
+
+    snprintf(log, sizeof(log), "%s.seg", fileName);
+    w = (SnapWriter) { .fd = open(log, O_WRONLY | O_CREAT | (logged == 0 ? O_TRUNC : 0) | O_BINARY, 0644), .ok = true };
+    if(w.fd < 0)
+        return false;
+
+    // fixed size records: the segment count of the state file is the valid length of the log
+    w.ok = lseek(w.fd, (off_t) (logged * SEGMENT_BYTES), SEEK_SET) >= 0;
+    for(long long k = logged; k < e->segments && w.ok; k++) {
+        for(int b = 0; b < 8; b++)
+            snap_byte(&w, (unsigned char) ((unsigned long long) e->gantt[k].start >> b * 8));
+        for(int b = 0; b < 4; b++)
+            snap_byte(&w, (unsigned char) ((unsigned int) e->gantt[k].processID >> b * 8));
+    }
+    snap_flush(&w);
+
+#ifdef _WIN32
+    bool ok = w.ok && _commit(w.fd) == 0;
+#else
+    bool ok = w.ok && fsync(w.fd) == 0;
+#endif
+    return close(w.fd) == 0 && ok;
+}
+
+/**
+ * @brief   write snapshot of the engine state (no allocation, called in the forked child)
+ *          the segment log is complete on disk before the state file refers to it
+ *
+ * @param e         pointer for engine state
+ * @param q         time quantum
+ * @param key       key of workload and policy configuration
+ * @param fileName  snapshot file path
+ * @param logged    segments already in the segment log
+ * @return  bool
+ */
+static bool write_snapshot(const Engine *e, int q, CacheKey key, const char *fileName, long long logged) {
+
+    static SnapWriter w;
+    char tmp[SNAP_PATH_W];
+    Process prev;
+
+    if(!write_segments(e, logged, fileName))
+        return false;
+
+    snprintf(tmp, sizeof(tmp), "%s.tmp", fileName);
+    w = (SnapWriter) { .fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC | O_BINARY, 0644), .ok = true, .sum = FNV_OFFSET };
+    if(w.fd < 0)
+        return false;
+
+    // header: magic, version, key
+    for(int i = 0; i < 4; i++)
+        snap_byte(&w, (unsigned char) CHECKPOINT_MAGIC[i]);
+    snap_byte(&w, CHECKPOINT_VERSION);
+    for(int i = 0; i < 2; i++)
+        for(int b = 0; b < 8; b++)
+            snap_byte(&w, (unsigned char) (key.h[i] >> b * 8));
+
+    // clock, counters and metric accumulators
+    snap_signed(&w, q);
+    snap_varint(&w, (unsigned long long) e->n);
+    snap_varint(&w, (unsigned long long) e->terminate);
+    snap_varint(&w, (unsigned long long) e->next);
+    snap_varint(&w, (unsigned long long) (e->cur + 1));
+    snap_varint(&w, (unsigned long long) e->time);
+    snap_varint(&w, (unsigned long long) e->length);
+    snap_signed(&w, e->total_turnaround);
+    snap_signed(&w, e->total_waiting);
+    snap_signed(&w, e->total_response);
+
+    // process table and result table, processes not arrived yet are the same as `engine_init()`
+    prev = (Process) { 0 };
+    for(int i = 0; i < e->next; i++)
+        snap_process(&w, &e->r.proc[i], &prev);
+    prev = (Process) { 0 };
+    for(int i = 0; i < e->terminate; i++)
+        snap_process(&w, &e->result[i], &prev);
+
+    // response flags, 8 for each byte
+    for(int i = 0; i < e->n; i += 8) {
+        unsigned char bits = 0;
+        for(int b = 0; b < 8 && i + b < e->n; b++)
+            bits |= (unsigned char) ((e->response[i + b] != 0) << b);
+        snap_byte(&w, bits);
+    }
+
+    // ready queue (heap or array order as it is)
+    snap_varint(&w, (unsigned long long) e->r.count);
+    snap_varint(&w, (unsigned long long) e->r.seq);
+    snap_byte(&w, e->r.changed);
+    for(int i = 0; i < e->r.count; i++) {
+        snap_signed(&w, e->r.item[i].key);
+        snap_varint(&w, (unsigned long long) e->r.item[i].seq);
+        snap_varint(&w, (unsigned long long) e->r.item[i].idx);
+    }
+
+    // gantt chart: segment count of the segment log, the last segment to check the log
+    snap_varint(&w, (unsigned long long) e->segments);
+    if(e->segments > 0) {
+        snap_varint(&w, (unsigned long long) e->gantt[e->segments - 1].start);
+        snap_signed(&w, e->gantt[e->segments - 1].processID);
+    }
+
+    // checksum of everything above
+    unsigned long long sum = w.sum;
+    for(int b = 0; b < 8; b++)
+        snap_byte(&w, (unsigned char) (sum >> b * 8));
+    snap_flush(&w);
+
+#ifdef _WIN32
+    bool ok = w.ok && _commit(w.fd) == 0;
+#else
+    bool ok = w.ok && fsync(w.fd) == 0;
+#endif
+    ok = close(w.fd) == 0 && ok;
+
+    // the snapshot file is replaced only by a complete snapshot
+#ifdef _WIN32
+    if(ok)
+        remove(fileName);
+#endif
+    if(!ok || rename(tmp, fileName) != 0) {
+        remove(tmp);
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief   read the gantt chart segments of the snapshot from the segment log
+ *          each segment starts after the previous one and before the time of the snapshot
+ *
+ * @param e         pointer for engine state (clock already read)
+ * @param segments  segment count of the snapshot
+ * @param last      last segment of the snapshot
+ * @param fileName  snapshot file path (the log is `<file>.seg`)
+ * @return  bool (false if the log is shorter than the snapshot or does not match it)
+ */
+static bool read_segments(Engine *e, long long segments, Segment last, const char *fileName) {
+
+    char log[SNAP_PATH_W];
+
+    snprintf(log, sizeof(log), "%s.seg", fileName);
+    SnapReader rd = { .fp = fopen(log, "rb"), .ok = true };
+    if(rd.fp == NULL)
+        return segments == 0;
+
+    if(segments > e->capacity) {
+        Segment *grown = realloc(e->gantt, sizeof(Segment) * segments);
+        if(grown == NULL)
+            rd.ok = false;
+        else {
+            e->capacity = segments;
+            e->gantt    = grown;
+        }
+    }
+
+    // records after the segment count are left by a snapshot not completed
+    for(long long k = 0; k < segments && rd.ok; k++) {
+        unsigned long long start = 0;
+        unsigned int pid = 0;
+        for(int b = 0; b < 8; b++)
+            start |= (unsigned long long) read_byte(&rd) << b * 8;
+        for(int b = 0; b < 4; b++)
+            pid |= (unsigned int) read_byte(&rd) << b * 8;
+        e->gantt[k] = (Segment) { .start = (Time) start, .processID = (int) pid };
+        if(k > 0 ? e->gantt[k].start <= e->gantt[k - 1].start : e->gantt[k].start != 0)
+            rd.ok = false;
+        if(e->gantt[k].start >= e->time)
+            rd.ok = false;
+    }
+    if(rd.ok && segments > 0)
+        rd.ok = e->gantt[segments - 1].start == last.start && e->gantt[segments - 1].processID == last.processID;
+    e->segments = rd.ok ? segments : 0;
+
+    fclose(rd.fp);
+    return rd.ok;
+}
+
+/**
+ * @brief   read snapshot into the engine state prepared by `engine_init()`
+ *
+ * @param e         pointer for engine state
+ * @param q         time quantum
+ * @param key       key of workload and policy configuration
+ * @param fileName  snapshot file path
+ * @return  bool (false if the file is invalid or from another workload or policy)
+ */
+static bool read_snapshot(Engine *e, int q, CacheKey key, const char *fileName) {
+
+    SnapReader rd = { .fp = fopen(fileName, "rb"), .ok = true, .sum = FNV_OFFSET };
+    Process prev;
+
+    if(rd.fp == NULL)
+        return false;
+
+    // header: magic, version, key
+    char magic[4];
+    for(int i = 0; i < 4; i++)
+        magic[i] = (char) read_byte(&rd);
+    bool same = memcmp(magic, CHECKPOINT_MAGIC, 4) == 0 && read_byte(&rd) == CHECKPOINT_VERSION;
+    for(int i = 0; i < 2 && same; i++) {
+        unsigned long long h = 0;
+        for(int b = 0; b < 8; b++)
+            h |= (unsigned long long) read_byte(&rd) << b * 8;
+        same = h == key.h[i];
+    }
+    same = same && read_signed(&rd) == q && read_varint(&rd) == (unsigned long long) e->n;
+    if(!same || !rd.ok) {
+        fclose(rd.fp);
+        return false;
+    }
+
+    // clock, counters and metric accumulators
+    e->terminate        = (int) read_varint(&rd);
+    e->next             = (int) read_varint(&rd);
+    e->cur              = (int) read_varint(&rd) - 1;
+    e->time             = (Time) read_varint(&rd);
+    Time length         = (Time) read_varint(&rd);
+    e->total_turnaround = read_signed(&rd);
+    e->total_waiting    = read_signed(&rd);
+    e->total_response   = read_signed(&rd);
+    if(!rd.ok || length != e->length || e->time > e->length || e->terminate < 0 || e->terminate > e->n
+        || e->next < 0 || e->next > e->n || e->cur < -1 || e->cur >= e->n) {
+        fclose(rd.fp);
+        return false;
+    }
+
+    // process table and result table
+    prev = (Process) { 0 };
+    for(int i = 0; i < e->next && rd.ok; i++)
+        read_process(&rd, &e->r.proc[i], &prev);
+    prev = (Process) { 0 };
+    for(int i = 0; i < e->terminate && rd.ok; i++)
+        read_process(&rd, &e->result[i], &prev);
+
+    // response flags
+    for(int i = 0; i < e->n && rd.ok; i += 8) {
+        unsigned char bits = read_byte(&rd);
+        for(int b = 0; b < 8 && i + b < e->n; b++)
+            e->response[i + b] = (char) (bits >> b & 1);
+    }
+
+    // ready queue, `pick_next` handles point into the process table
+    e->r.count   = (int) read_varint(&rd);
+    e->r.seq     = (int) read_varint(&rd);
+    e->r.changed = read_byte(&rd) != 0;
+    for(int i = 0; i < e->r.count && e->r.count <= e->n && rd.ok; i++) {
+        e->r.item[i].key = read_signed(&rd);
+        e->r.item[i].seq = (int) read_varint(&rd);
+        e->r.item[i].idx = (int) read_varint(&rd);
+        if(e->r.item[i].idx < 0 || e->r.item[i].idx >= e->n)
+            rd.ok = false;
+        else if(e->r.handle)
+            e->r.handle[i] = &e->r.proc[e->r.item[i].idx];
+    }
+    if(e->r.count < 0 || e->r.count > e->n)
+        rd.ok = false;
+
+    // gantt chart: segment count of the segment log and the last segment
+    Segment last = { 0 };
+    long long segments = rd.ok ? (long long) read_varint(&rd) : 0;
+    if(segments < 0 || segments > e->time)
+        rd.ok = false;
+    if(rd.ok && segments > 0) {
+        last.start     = (Time) read_varint(&rd);
+        last.processID = (int) read_signed(&rd);
+    }
+
+    // checksum
+    unsigned long long sum = rd.sum, stored = 0;
+    for(int b = 0; b < 8; b++)
+        stored |= (unsigned long long) read_byte(&rd) << b * 8;
+    bool ok = rd.ok && stored == sum;
+
+    fclose(rd.fp);
+    return ok && read_segments(e, segments, last, fileName);
+}
+
+bool run_checkpointed(const Policy *pol, Process *p, int n, Schedule *s, const CheckpointOptions *opt, CheckpointStats *stats) {
+
+    CheckpointStats dummy;
+    if(stats == NULL)
+        stats = &dummy;
+    *stats = (CheckpointStats) { .resumed = -1 };
+
+    if(opt == NULL || opt->fileName == NULL || strlen(opt->fileName) + 5 > SNAP_PATH_W)
+        return false;
+
+    Time interval = opt->interval > 0 ? opt->interval : CHECKPOINT_INTERVAL;
+    CacheKey key  = cache_key(p, n, pol);
+    long long logged = 0;   // segments already in the segment log
+    Engine e;
+
+    // resume from the snapshot of the same workload and policy, or start from the beginning
+    if(engine_init(&e, pol, p, n) && opt->resume) {
+        FILE *fp = fopen(opt->fileName, "rb");
+        if(fp != NULL) {
+            fclose(fp);
+            if(read_snapshot(&e, pol->quantum, key, opt->fileName)) {
+                stats->resumed = e.time;
+                logged         = e.segments;
+            }
+            else {
+                fprintf(stderr, "WARNING: CHECKPOINT: [%s] invalid snapshot or another workload, started from the beginning\n", opt->fileName);
+                engine_free(&e);
+                engine_init(&e, pol, p, n);
+            }
+        }
+    }
+
+#ifdef CHECKPOINT_FORK
+    pid_t child = 0;        // process writing the last snapshot
+    long long pending = 0;  // segments in the segment log once the child succeeds
+    int status;
+#endif
+
+    while(!engine_step(&e, pol, pol->quantum, e.time + interval)) {
+
+#ifdef CHECKPOINT_FORK
+        if(!opt->sync) {
+            // never wait for the writer: skip this snapshot if the last one is still being written
+            if(child > 0) {
+                pid_t done = waitpid(child, &status, WNOHANG);
+                if(done == 0) {
+                    stats->skipped++;
+                    continue;
+                }
+                if(done < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+                    stats->failed++;
+                else
+                    logged = pending;
+                child = 0;
+            }
+
+            // the child writes the copy-on-write image of the state
+            pid_t pid = fork();
+            if(pid == 0)
+                _exit(write_snapshot(&e, pol->quantum, key, opt->fileName, logged) ? 0 : 1);
+            if(pid > 0) {
+                child   = pid;
+                pending = e.segments;
+                stats->snapshots++;
+                continue;
+            }
+        }
+#endif
+        // written in the calling thread (no fork, or fork failed)
+        stats->snapshots++;
+        if(!write_snapshot(&e, pol->quantum, key, opt->fileName, logged))
+            stats->failed++;
+        else
+            logged = e.segments;
+    }
+
+#ifdef CHECKPOINT_FORK
+    // the last snapshot is complete before return
+    if(child > 0 && (waitpid(child, &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0))
+        stats->failed++;
+#endif
+
+    engine_finish(&e, pol, s);
+    return true;
+}
@@ -0,0 +1,67 @@
+/**
+ * @file    compare.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   compare function package for qsort()
+ * @version 0.1
+ * @date    (first date: 2023-05-15, last date: 2026-10-17)
+ * 
+ * @copyright Copyright (c) 2023 Minsu Bak
+ * 
+ */
+
+// user define library
+#include "compare.h"
+#include "process.h"
+
+int compare_for_arrival(const void* a, const void* b) {
+        
+    // compare target match progress
+
+    Process* A = (Process*) a;
+    Process* B = (Process*) b;
+
+    return (A->arrival>B->arrival)-(A->arrival<B->arrival);
+}
+
+int compare_for_burst(const void* a, const void* b) {
+    
+    // compare target match progress
+
+    Process* A = (Process*) a;
+    Process* B = (Process*) b;
+
+    return (A->burst>B->burst)-(A->burst<B->burst);
+}
+
+int compare_for_priority(const void* a, const void* b) {
+    
+    // compare target match progress
+
+    Process* A = (Process*) a;
+    Process* B = (Process*) b;
+
+    // if compare target A and B was same
+    if(A->priority == B->priority)
+        return (A->arrival>B->arrival)-(A->arrival<B->arrival);
+    return (A->priority>B->priority)-(A->priority<B->priority);
+}
+
+int compare_for_remain(const void* a, const void* b) {
+    
+    // compare target match progress
+
+    Process* A = (Process*) a;
+    Process* B = (Process*) b;
+
+    return (A->remain>B->remain)-(A->remain<B->remain);
+}
+
+int compare_for_HRN(const void* a, const void* b) {
+
+    // compare target match progress
+
+    Process* A = (Process*) a;
+    Process* B = (Process*) b;
+
+    return (((A->waiting + A->burst) / A->burst) > ((B->waiting + B->burst) / B->burst)) - (((A->waiting + A->burst) / A->burst) < ((B->waiting + B->burst) / B->burst));
+}
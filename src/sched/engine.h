@@ -0,0 +1,559 @@
+/**
+ * @file    engine.h
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   scheduling engine of libcpusched (private header)
+ *          - `engine_run()` runs any `Policy`, hooks are called through the policy table
+ *          - `engine_run()` is always inlined: called with a constant built-in policy,
+ *            the compiler resolves and inlines every hook (no function pointer, no qsort)
+ *          - ready queue is a binary heap ordered by (key, enqueue order),
+ *            or an array in enqueue order if the policy has `pick_next`
+ *          - `pick_next` is called only on scheduling events (dispatch, ready queue changed)
+ * @version 0.3
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+#ifndef ENGINE_H
+#define ENGINE_H
+
+// standard library
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// user define library
+#include "policy.h"
+#include "process.h"
+#include "radix.h"
+
+/**
+ * @brief engine.h variable info
+ *
+ *  type        name             pointer    info
+ *  Policy      pol              y          pointer for scheduling policy
+ *  Ready       r                y          pointer for ready queue
+ *  ReadyItem   item             y          ready queue storage (heap or array)
+ *  Process     handle           y          ready processes for `pick_next` (same order as `item`)
+ *  int         count            n          number of process in the ready queue
+ *  int         seq              n          enqueue order (tie breaker of the same key)
+ *  bool        changed          n          ready queue changed since the last `pick_next`
+ *  Process     proc             y          process data sorted by arrival
+ *  int         next             n          index of the next arriving process
+ *  int         cur              n          index of the running process (-1 if none)
+ *  Process     result           y          structure for CPU scheduling result save
+ *  Segment     gantt            y          gantt chart segments (run-length, one for each run or idle gap)
+ *  long long   segments         n          gantt chart segment count
+ *  long long   capacity         n          gantt chart segments allocated
+ *  char        response         y          array for check the response time of the process (index: dense slot)
+ *  Time        total_turnaround n          the sum of turnaround
+ *  Time        total_waiting    n          the sum of waiting
+ *  Time        total_response   n          the sum of response
+ *  Time        time             n          flow of time in the scheduler
+ *  int         terminate        n          number of process terminated
+ *  bool        failed           n          out of memory or time out of range (empty schedule)
+ *  Engine      e                y          engine state of a run (stopped and continued by `engine_step()`)
+ *
+ */
+
+#define ENGINE_INLINE static inline __attribute__((always_inline))
+
+/**
+ * @brief structure for ready queue item
+ *
+ */
+typedef struct ReadyItem {
+
+    long long key;  // sort key of the policy
+    int seq;        // enqueue order
+    int idx;        // index of process data
+
+} ReadyItem;
+
+/**
+ * @brief structure for ready queue
+ *
+ */
+typedef struct Ready {
+
+    ReadyItem *item;        // ready queue storage (heap or array)
+    const Process **handle; // ready processes for `pick_next`
+    Process *proc;          // process data
+    int count;              // number of process in the ready queue
+    int seq;                // enqueue order
+    bool changed;           // ready queue changed since the last `pick_next`
+
+} Ready;
+
+/**
+ * @brief   sort key of priority first, earlier arrival for the same priority
+ *          one 64-bit key keeps the ready queue item at 16 bytes:
+ *          priority in the upper 24 bits, arrival in the lower 40 bits
+ *          exact for arrival 0 ~ `ARRIVAL_LIMIT` - 1 and priority within `PRIORITY_LIMIT`:
+ *          `engine_init()` and `run_stream()` stop the run on processes out of this range
+ *
+ * @param priority  process priority
+ * @param arrival   process arrival time
+ * @return  long long
+ */
+ENGINE_INLINE long long priority_key(int priority, Time arrival) {
+
+    return (long long) priority * (1LL << ARRIVAL_BITS) + arrival;
+}
+
+/**
+ * @brief   check heap order of two ready queue items
+ *
+ * @param a ready queue item a
+ * @param b ready queue item b
+ * @return  bool (true if `a` runs before `b`)
+ */
+ENGINE_INLINE bool ready_before(const ReadyItem *a, const ReadyItem *b) {
+
+    return a->key < b->key || (a->key == b->key && a->seq < b->seq);
+}
+
+/**
+ * @brief   insert process into the ready queue
+ *
+ * @param pol   pointer for scheduling policy
+ * @param r     pointer for ready queue
+ * @param idx   index of process data
+ */
+ENGINE_INLINE void ready_push(const Policy *pol, Ready *r, int idx) {
+
+    ReadyItem item = { pol->on_arrival ? pol->on_arrival(pol->data, &r->proc[idx]) : 0, r->seq++, idx };
+
+    // array in enqueue order
+    if(pol->pick_next) {
+        r->changed = true;
+        r->handle[r->count] = &r->proc[idx];
+        r->item[r->count++] = item;
+        return;
+    }
+
+    // binary heap
+    int i = r->count++;
+    while(i > 0) {
+        int parent = (i - 1) / 2;
+        if(!ready_before(&item, &r->item[parent]))
+            break;
+        r->item[i] = r->item[parent];
+        i = parent;
+    }
+    r->item[i] = item;
+}
+
+/**
+ * @brief   move heap item down from `i` to its place
+ *
+ * @param r     pointer for ready queue
+ * @param i     start position in the heap
+ * @param item  ready queue item to be placed
+ */
+ENGINE_INLINE void ready_sift_down(Ready *r, int i, ReadyItem item) {
+
+    while(1) {
+        int child = i * 2 + 1;
+        if(child >= r->count)
+            break;
+        if(child + 1 < r->count && ready_before(&r->item[child + 1], &r->item[child]))
+            child++;
+        if(!ready_before(&r->item[child], &item))
+            break;
+        r->item[i] = r->item[child];
+        i = child;
+    }
+    r->item[i] = item;
+}
+
+/**
+ * @brief   insert every process arriving at the same time into the ready queue at once
+ *          heap: rebuilt bottom-up if the run is not smaller than the queue, else inserted one by one
+ *
+ * @param pol   pointer for scheduling policy
+ * @param r     pointer for ready queue
+ * @param from  index of the first arriving process
+ * @param to    index after the last arriving process
+ */
+ENGINE_INLINE void ready_push_run(const Policy *pol, Ready *r, int from, int to) {
+
+    if(pol->pick_next || to - from < r->count) {
+        for(int idx = from; idx < to; idx++)
+            ready_push(pol, r, idx);
+        return;
+    }
+
+    // append the run in arrival order, then heapify (O(count))
+    for(int idx = from; idx < to; idx++)
+        r->item[r->count++] = (ReadyItem) { pol->on_arrival ? pol->on_arrival(pol->data, &r->proc[idx]) : 0, r->seq++, idx };
+    for(int i = r->count / 2 - 1; i >= 0; i--)
+        ready_sift_down(r, i, r->item[i]);
+}
+
+/**
+ * @brief   find the process to be dispatched next, not removed
+ *
+ * @param pol   pointer for scheduling policy
+ * @param r     pointer for ready queue
+ * @param cur   running process (NULL at dispatch)
+ * @param time  present time of the engine
+ * @return  int (position in the ready queue, -1 if `cur` keeps running)
+ */
+ENGINE_INLINE int ready_first(const Policy *pol, Ready *r, const Process *cur, Time time) {
+
+    if(!pol->pick_next)
+        return 0;
+
+    r->changed = false;
+    int pos = pol->pick_next(pol->data, r->handle, r->count, cur, time);
+    if(pos < 0 || pos >= r->count)
+        return cur ? -1 : 0;
+    return pos;
+}
+
+/**
+ * @brief   remove process from the ready queue
+ *
+ * @param pol   pointer for scheduling policy
+ * @param r     pointer for ready queue
+ * @param pos   position in the ready queue (always 0 for heap)
+ * @return  int (index of process data)
+ */
+ENGINE_INLINE int ready_remove(const Policy *pol, Ready *r, int pos) {
+
+    int idx = r->item[pos].idx;
+
+    // array in enqueue order
+    if(pol->pick_next) {
+        r->count--;
+        memmove(r->item + pos, r->item + pos + 1, sizeof(ReadyItem) * (r->count - pos));
+        memmove(r->handle + pos, r->handle + pos + 1, sizeof(Process*) * (r->count - pos));
+        return idx;
+    }
+
+    // binary heap
+    r->count--;
+    ready_sift_down(r, 0, r->item[r->count]);
+
+    return idx;
+}
+
+/**
+ * @brief structure for engine state (every variable of a run, see `engine_step()`)
+ *
+ */
+typedef struct Engine {
+
+    Ready r;                // ready queue and process data sorted by arrival
+    Process *result;        // structure for CPU scheduling result save
+    Segment *gantt;         // gantt chart segments (run-length, one for each run or idle gap)
+    long long segments;     // gantt chart segment count
+    long long capacity;     // gantt chart segments allocated
+    char *response;         // array for check the response time of the process (dense slot)
+    int n;                  // total process count
+    int terminate;          // number of process terminated
+    int next;               // index of the next arriving process
+    int cur;                // index of the running process (-1 if none)
+    Time time;              // flow of time in the scheduler
+    Time length;            // gantt chart length (burst time and idle time)
+    Time total_turnaround;  // the sum of turnaround
+    Time total_waiting;     // the sum of waiting
+    Time total_response;    // the sum of response
+    bool failed;            // out of memory or time out of range (empty schedule)
+
+} Engine;
+
+/**
+ * @brief   stop the run, the schedule will be empty
+ *
+ * @param e     pointer for engine state
+ * @param pol   pointer for scheduling policy
+ * @param what  reason of the failure
+ * @return  bool (always false)
+ */
+static inline bool engine_fail(Engine *e, const Policy *pol, const char *what) {
+
+    fprintf(stderr, "WARNING: ENGINE: [%s] %s, empty schedule\n", pol->name, what);
+    e->failed = true;
+    return false;
+}
+
+/**
+ * @brief   prepare engine state of a run: process data sorted by arrival, empty ready queue
+ *
+ * @param e     pointer for engine state
+ * @param pol   pointer for scheduling policy
+ * @param p     pointer for process structure
+ * @param n     total process count
+ * @return  bool (false if out of memory, arrival or priority out of range or the gantt chart is longer than `TIME_MAX`)
+ */
+ENGINE_INLINE bool engine_init(Engine *e, const Policy *pol, const Process *p, int n) {
+
+    *e = (Engine) {
+        .r = {
+            .item   = malloc(sizeof(ReadyItem) * (n + 1)),
+            .handle = pol->pick_next ? malloc(sizeof(Process*) * (n + 1)) : NULL,
+            .proc   = malloc(sizeof(Process) * (n > 0 ? n : 1))
+        },
+        .result   = malloc(sizeof(Process) * (n > 0 ? n : 1)),
+        .response = calloc(n > 0 ? n : 1, sizeof(char)),
+        .n        = n,
+        .cur      = -1
+    };
+    if(e->r.item == NULL || (pol->pick_next && e->r.handle == NULL) || e->r.proc == NULL || e->result == NULL || e->response == NULL)
+        return engine_fail(e, pol, "not enough memory for the processes");
+
+    // workload loaders sort by arrival once, only checked here if already sorted
+    memcpy(e->r.proc, p, sizeof(Process) * n);
+    if(!sort_by_arrival(e->r.proc, n, 0))
+        return engine_fail(e, pol, "not enough memory to sort the processes");
+
+    // the CPU is busy from each arrival until the ready queue is empty, same for every policy
+    for(int i = 0; i < n; i++) {
+        // the ready queue key of PP packs priority and arrival (`priority_key()`), any caller array is checked
+        if(e->r.proc[i].arrival < 0 || e->r.proc[i].arrival >= ARRIVAL_LIMIT
+            || e->r.proc[i].priority < -PRIORITY_LIMIT || e->r.proc[i].priority >= PRIORITY_LIMIT)
+            return engine_fail(e, pol, "arrival or priority out of range (see ARRIVAL_LIMIT and PRIORITY_LIMIT)");
+        Time start = e->r.proc[i].arrival > e->length ? e->r.proc[i].arrival : e->length;
+        if(e->r.proc[i].remain > TIME_MAX - start)
+            return engine_fail(e, pol, "time out of range (the gantt chart ends after TIME_MAX)");
+        e->length = start + e->r.proc[i].remain;
+    }
+
+    // one run and at most one idle gap before it for each process without preemption, grows on demand
+    e->capacity = (long long) n * 2 + 1;
+    e->gantt    = malloc(sizeof(Segment) * e->capacity);
+    if(e->gantt == NULL)
+        return engine_fail(e, pol, "not enough memory for the gantt chart");
+
+    return true;
+}
+
+/**
+ * @brief   start a gantt chart segment, the same process running on stays in the last segment
+ *          a segment started at the same time (dispatched, then preempted at once) has no time unit: replaced
+ *
+ * @param e     pointer for engine state
+ * @param pol   pointer for scheduling policy
+ * @param start start time
+ * @param pid   process no. (`IDLE_PID` if the CPU is idle)
+ */
+ENGINE_INLINE void engine_segment(Engine *e, const Policy *pol, Time start, int pid) {
+
+    if(e->segments > 0 && e->gantt[e->segments - 1].start == start)
+        e->segments--;
+    if(e->segments > 0 && e->gantt[e->segments - 1].processID == pid)
+        return;
+    if(e->segments == e->capacity) {
+        Segment *grown = (size_t) e->capacity < SIZE_MAX / 2 / sizeof(Segment)
+                       ? realloc(e->gantt, sizeof(Segment) * e->capacity * 2) : NULL;
+        if(grown == NULL) {
+            engine_fail(e, pol, "not enough memory for the gantt chart");
+            return;
+        }
+        e->capacity *= 2;
+        e->gantt     = grown;
+    }
+    e->gantt[e->segments++] = (Segment) { .start = start, .processID = pid };
+}
+
+/**
+ * @brief   run scheduling policy until every process terminates or the time reaches `until`
+ *          event order in each time unit:
+ *          arrival (every process of the time unit), dispatch,
+ *          preemption or time quantum expiration, run one time unit
+ *          idle CPU jumps to the next arrival, the idle time is one `IDLE_PID` segment of the gantt chart
+ *          a segment starts at each dispatch, preemption or expiration (O(events), not O(time))
+ *          per-process arrays are indexed by dense slot (index of arrival order), any process no. works
+ *          scalar state is kept in local variables while running, the engine state is updated on return
+ *
+ * @param e     pointer for engine state
+ * @param pol   pointer for scheduling policy
+ * @param q     time quantum
+ * @param until stop time (checked between time units, an idle jump may pass it)
+ * @return  bool (true if every process terminated or the run failed, see `failed`)
+ */
+ENGINE_INLINE bool engine_step(Engine *e, const Policy *pol, int q, Time until) {
+
+    Time total_turnaround = e->total_turnaround;        // the sum of turnaround
+    Time total_waiting    = e->total_waiting;           // the sum of waiting
+    Time total_response   = e->total_response;          // the sum of response
+    Time time             = e->time;                    // flow of time in the scheduler
+    int terminate         = e->terminate;               // number of process terminated
+    int next              = e->next;                    // index of the next arriving process
+    int cur               = e->cur;                     // index of the running process
+    int n                 = e->n;                       // total process count
+    char *response        = e->response;                // array for check the response time of the process (dense slot)
+    Process *result       = e->result;                  // structure for CPU scheduling result save
+    Ready r               = e->r;                       // ready queue
+
+    while(terminate < n && time < until && !e->failed) {
+
+        // every process arriving until this time unit enters the ready queue at once
+        if(next < n && r.proc[next].arrival <= time) {
+            int from = next;
+            while(next < n && r.proc[next].arrival <= time)
+                next++;
+            ready_push_run(pol, &r, from, next);
+            if(CHECK) // debug
+                for(int i = from; i < next; i++)
+                    fprintf(stderr, "arrival:\tt: %2lld, p: %2d\n", time, r.proc[i].processID);
+        }
+
+        // idle CPU: jump to the next arrival, one idle segment
+        if(cur < 0 && r.count == 0) {
+            engine_segment(e, pol, time, IDLE_PID);
+            time = r.proc[next].arrival;
+            continue;
+        }
+
+        // dispatch new PCB: if the previous task terminated
+        if(cur < 0 && r.count > 0) {
+            cur = ready_remove(pol, &r, ready_first(pol, &r, NULL, time));
+            r.proc[cur].waiting  = time - r.proc[cur].timeout;
+            total_waiting       += r.proc[cur].waiting;
+            r.proc[cur].execute  = 0;
+            engine_segment(e, pol, time, r.proc[cur].processID);
+            if(CHECK) // debug
+                fprintf(stderr, "dispatch:\tt: %2lld, p: %2d, w: %2lld\n", time, r.proc[cur].processID, r.proc[cur].waiting);
+        }
+
+        // timeout & dispatch new PCB: preemption or time quantum expiration
+        bool timeout = false;
+        int first    = 0;
+        if(pol->pick_next) {
+            // batch hook: asked again only if the ready queue changed
+            if(r.changed && r.count > 0)
+                timeout = (first = ready_first(pol, &r, &r.proc[cur], time)) >= 0;
+        }
+        else if(pol->should_preempt && r.count > 0) {
+            first   = ready_first(pol, &r, &r.proc[cur], time);
+            timeout = pol->should_preempt(pol->data, &r.proc[r.item[first].idx], &r.proc[cur]);
+        }
+        if(!timeout && (pol->on_tick_expire ? pol->on_tick_expire(pol->data, &r.proc[cur], q)
+                                            : q > 0 && r.proc[cur].execute >= q)) {
+            timeout = true;
+            first   = -1;
+        }
+        if(timeout) {
+            if(CHECK) // debug
+                fprintf(stderr, "timeout:\tt: %2lld, p: %2d, w: %2lld\n", time, r.proc[cur].processID, r.proc[cur].waiting);
+            r.proc[cur].timeout  = time;
+            total_turnaround    += r.proc[cur].execute + r.proc[cur].waiting;
+
+            // preempted by the selected process, or expired process goes back to the ready queue first
+            int prev = cur;
+            if(first >= 0)
+                cur = ready_remove(pol, &r, first);
+            ready_push(pol, &r, prev);
+            if(first < 0)
+                cur = ready_remove(pol, &r, ready_first(pol, &r, NULL, time));
+
+            r.proc[cur].waiting  = time - r.proc[cur].timeout;
+            total_waiting       += r.proc[cur].waiting;
+            r.proc[cur].execute  = 0;
+            engine_segment(e, pol, time, r.proc[cur].processID);
+        }
+
+        // check the response time of the process
+        if(response[cur] == 0) {
+            response[cur] = 1;
+            total_response += time - r.proc[cur].arrival;
+        }
+
+        // scheduler task progress
+        time++;
+        r.proc[cur].remain--;
+        r.proc[cur].execute++;
+
+        // terminate present PCB
+        if(r.proc[cur].remain == 0) {
+            if(CHECK) // debug
+                fprintf(stderr, "terminate:\tt: %2lld, p: %2d\n", time, r.proc[cur].processID);
+            total_turnaround   += r.proc[cur].execute + r.proc[cur].waiting;
+            result[terminate++] = r.proc[cur];
+            cur = -1;
+        }
+    }
+
+    e->r                = r;
+    e->total_turnaround = total_turnaround;
+    e->total_waiting    = total_waiting;
+    e->total_response   = total_response;
+    e->time             = time;
+    e->terminate        = terminate;
+    e->next             = next;
+    e->cur              = cur;
+
+    return terminate == n || e->failed;
+}
+
+/**
+ * @brief   release memory of the engine state
+ *
+ * @param e pointer for engine state
+ */
+ENGINE_INLINE void engine_free(Engine *e) {
+
+    free(e->response);
+    free(e->result);
+    free(e->gantt);
+    free(e->r.item);
+    free(e->r.handle);
+    free(e->r.proc);
+    *e = (Engine) { 0 };
+}
+
+/**
+ * @brief   save result of the finished run, the schedule takes the result and gantt chart
+ *          a failed run saves an empty schedule (no process, no gantt chart)
+ *
+ * @param e     pointer for engine state
+ * @param pol   pointer for scheduling policy
+ * @param s     pointer for schedule result save
+ * @return  bool (false if the run failed)
+ */
+ENGINE_INLINE bool engine_finish(Engine *e, const Policy *pol, Schedule *s) {
+
+    if(e->failed) {
+        engine_free(e);
+        save_schedule(s, pol->name, NULL, NULL, 0, 0, 0, 0, 0, 0);
+        return false;
+    }
+
+    // save gantt chart and result table for drawing
+    save_schedule(s, pol->name, e->result, e->gantt, e->segments, e->n, e->time, e->total_turnaround, e->total_waiting, e->total_response);
+
+    // memory allocate disable
+    e->result = NULL;
+    e->gantt  = NULL;
+    engine_free(e);
+
+    return true;
+}
+
+/**
+ * @brief   run scheduling policy and save result
+ *
+ * @param pol   pointer for scheduling policy
+ * @param q     time quantum
+ * @param p     pointer for process structure
+ * @param n     total process count
+ * @param t     total burst time (gantt chart length is computed with idle time)
+ * @param s     pointer for schedule result save (empty with a warning if the run failed)
+ */
+ENGINE_INLINE void engine_run(const Policy *pol, int q, Process *p, int n, Time t, Schedule *s) {
+
+    Engine e;
+
+    (void) t;
+    if(engine_init(&e, pol, p, n))
+        engine_step(&e, pol, q, TIME_MAX);
+    engine_finish(&e, pol, s);
+}
+
+#endif
@@ -0,0 +1,129 @@
+/**
+ * @file    lanes.h
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   lockstep kernel of the batched engine of libcpusched (private header)
+ *          - included by `batch.c` once for each instruction set: `LANE_COUNT` lanes of 32-bit
+ *            integers (GCC vector extension), the compiler emits the instructions of `LANE_TARGET`
+ *          - no branch on lane data: each lane takes its value by mask (`LANE_PICK()`)
+ *          - FIFO order without a queue: the earliest stamp runs first, a process waiting since its
+ *            arrival has 2 * arrival, an expired process has 2 * timeout + 1 (after the arrivals of
+ *            the same time unit, as the engine pushes them), a terminated process has `LANE_DONE`
+ *          - one event runs the selected process for min(remain, quantum) time units
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// no include guard: defined again for each instruction set, the macros are undefined at the end
+
+/**
+ * @brief lanes.h variable info
+ *
+ *  type            name            pointer     info
+ *  #define         LANE_COUNT      n           lane count (set before include)
+ *  #define         LANE_NAME       n           kernel function name (set before include)
+ *  #define         LANE_TARGET     n           kernel function attribute (set before include)
+ *  #define         LANE_DONE       n           stamp of a terminated process (and empty key)
+ *  LANE_VECTOR     stamp           y           enqueue stamp of each process
+ *  LANE_VECTOR     remain          y           remain time of each process
+ *  LANE_VECTOR     time            n           flow of time of each lane
+ *  LANE_VECTOR     best            n           process index selected in each lane
+ *
+ */
+
+#ifndef LANE_DONE
+    #define LANE_DONE           INT32_MAX
+    #define LANE_JOIN2(a, b)    a##b
+    #define LANE_JOIN(a, b)     LANE_JOIN2(a, b)
+    #define LANE_PICK(m, a, b)  (((a) & (m)) | ((b) & ~(m)))
+#endif
+
+#define LANE_VECTOR LANE_JOIN(LANE_NAME, _vector)
+
+typedef int32_t LANE_VECTOR __attribute__((vector_size(LANE_COUNT * sizeof(int32_t))));
+
+/**
+ * @brief   run every lane of `b` until each workload terminates, save the sums of each lane
+ *
+ * @param b     pointer for lanes (process data in arrival order, index: process * `LANE_COUNT` + lane)
+ * @param n     process count of each workload
+ * @param keyed true: smallest key among the arrived processes (SJF, HRN, NPP), false: earliest stamp
+ * @param q     time quantum (`INT32_MAX` for non-preemptive)
+ */
+static LANE_TARGET void LANE_NAME(BatchLanes *b, int n, bool keyed, int32_t q) {
+
+    LANE_VECTOR stamp[BATCH_MAX_PROCESS], remain[BATCH_MAX_PROCESS];
+    LANE_VECTOR arrival, burst, key;
+    LANE_VECTOR time       = { 0 };
+    LANE_VECTOR turnaround = { 0 };
+    LANE_VECTOR response   = { 0 };
+    const LANE_VECTOR done    = (LANE_VECTOR) { 0 } + LANE_DONE;
+    const LANE_VECTOR quantum = (LANE_VECTOR) { 0 } + q;
+
+    for(int j = 0; j < n; j++) {
+        memcpy(&arrival, &b->arrival[j * LANE_COUNT], sizeof(arrival));
+        memcpy(&remain[j], &b->burst[j * LANE_COUNT], sizeof(remain[j]));
+        stamp[j] = arrival * 2;
+    }
+
+    while(1) {
+        // earliest stamp, lower index (arrival order) on a tie
+        LANE_VECTOR first = done, best = { 0 };
+        for(int j = 0; j < n; j++) {
+            LANE_VECTOR m = stamp[j] < first;
+            first = LANE_PICK(m, stamp[j], first);
+            best  = LANE_PICK(m, (LANE_VECTOR) { 0 } + j, best);
+        }
+
+        // every lane terminated
+        LANE_VECTOR active = first != done;
+        int running = 0;
+        for(int l = 0; l < LANE_COUNT; l++)
+            running |= active[l];
+        if(!running)
+            break;
+
+        // idle CPU: fast-forward to the arrival
+        LANE_VECTOR ready = first >> 1;
+        time = LANE_PICK(active & (time < ready), ready, time);
+
+        // smallest key among the processes in the ready queue, lower index on a tie
+        if(keyed) {
+            LANE_VECTOR limit = time * 2 + 1, least = done;
+            for(int j = 0; j < n; j++) {
+                memcpy(&key, &b->key[j * LANE_COUNT], sizeof(key));
+                LANE_VECTOR m = (stamp[j] <= limit) & (key < least);
+                least = LANE_PICK(m, key, least);
+                best  = LANE_PICK(m, (LANE_VECTOR) { 0 } + j, best);
+            }
+        }
+
+        // selected process runs one time slice
+        LANE_VECTOR advance = { 0 };
+        for(int j = 0; j < n; j++) {
+            LANE_VECTOR sel = active & (best == (LANE_VECTOR) { 0 } + j);
+            memcpy(&arrival, &b->arrival[j * LANE_COUNT], sizeof(arrival));
+            memcpy(&burst, &b->burst[j * LANE_COUNT], sizeof(burst));
+
+            LANE_VECTOR run  = LANE_PICK(remain[j] < quantum, remain[j], quantum);
+            LANE_VECTOR left = remain[j] - run;
+            LANE_VECTOR end  = time + run;
+            response   += sel & (remain[j] == burst) & (time - arrival);
+            turnaround += sel & (left == 0) & (end - arrival);
+            advance    += sel & run;
+            remain[j]   = LANE_PICK(sel, left, remain[j]);
+            stamp[j]    = LANE_PICK(sel, LANE_PICK(left == 0, done, end * 2 + 1), stamp[j]);
+        }
+        time += advance;
+    }
+
+    memcpy(b->turnaround, &turnaround, sizeof(turnaround));
+    memcpy(b->response, &response, sizeof(response));
+}
+
+#undef LANE_VECTOR
+#undef LANE_COUNT
+#undef LANE_NAME
+#undef LANE_TARGET
@@ -0,0 +1,598 @@
+/**
+ * @file    optimal.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   optimal non-preemptive schedule of libcpusched (branch and bound)
+ *          - a node is an order of the first processes: processes left (bit set), end time and cost so far
+ *          - children are pushed in order of lower bound (the best child is taken first),
+ *            a node whose bound reaches the incumbent is dropped
+ *          - worker threads (`pool.h`) are the searchers: deques are locked by a spin flag
+ *            (short sections), the search ends when every running searcher is idle
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// standard library
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef __EMSCRIPTEN__
+    #include <sched.h>
+#endif
+
+// user define library
+#include "optimal.h"
+#include "pool.h"
+
+/**
+ * @brief optimal.c variable info
+ *
+ *  type            name        pointer     info
+ *  Job             job         y           process of the instance (arrival order)
+ *  Node            node        y           order of the first processes
+ *  Deque           dq          y           nodes of a searcher (newest for the owner, oldest for thieves)
+ *  Search          s           y           instance, incumbent and searchers
+ *
+ */
+
+/**
+ * @brief structure for process of the instance (arrival order)
+ *
+ */
+typedef struct Job {
+
+    Time arrival;   // arrival time
+    Time burst;     // burst time
+    double weight;  // weight of the completion time
+    double ratio;   // weight / burst
+    int index;      // index of the input array
+
+} Job;
+
+/**
+ * @brief structure for order of the first processes
+ *
+ */
+typedef struct Node {
+
+    unsigned long long left;                    // processes left (bit of the job index)
+    Time time;                                  // end time of the order
+    double cost;                                // cost of the order
+    double bound;                               // lower bound of every completion of the order
+    int depth;                                  // processes in the order
+    unsigned char seq[OPTIMAL_MAX_PROCESS];     // job index in order of run
+
+} Node;
+
+/**
+ * @brief structure for nodes of a searcher
+ *
+ */
+typedef struct Deque {
+
+    Node *node;     // ring buffer
+    int head;       // oldest node
+    int count;      // node count
+    int cap;        // buffer size
+    char lock;      // spin flag
+
+} Deque;
+
+/**
+ * @brief structure for instance, incumbent and searchers
+ *
+ */
+typedef struct Search {
+
+    Job job[OPTIMAL_MAX_PROCESS];           // processes in arrival order
+    int n;                                  // process count
+    bool weighted;                          // objective: weighted completion time
+    Deque *deque;                           // deque of each searcher
+    int jobs;                               // searcher count
+    long long limit;                        // node limit (0: no limit)
+    long long nodes;                        // nodes expanded (atomic)
+    int running;                            // searchers started (atomic)
+    int idle;                               // searchers without work (atomic)
+    bool stopped;                           // node limit reached
+    double best;                            // incumbent cost (atomic)
+    unsigned char bestSeq[OPTIMAL_MAX_PROCESS]; // incumbent order
+    char bestLock;                          // spin flag of the incumbent
+
+} Search;
+
+static void spin_lock(char *lock) {
+
+    while(__atomic_test_and_set(lock, __ATOMIC_ACQUIRE))
+        ;
+}
+
+static void spin_unlock(char *lock) {
+
+    __atomic_clear(lock, __ATOMIC_RELEASE);
+}
+
+// newest node for the owner, at the end of the ring
+static void deque_push(Deque *dq, const Node *node) {
+
+    spin_lock(&dq->lock);
+    if(dq->count == dq->cap) {
+        int cap = dq->cap ? dq->cap * 2 : 256;
+        Node *grown = malloc(sizeof(Node) * cap);
+        for(int i = 0; i < dq->count; i++)
+            grown[i] = dq->node[(dq->head + i) % dq->cap];
+        free(dq->node);
+        dq->node = grown;
+        dq->head = 0;
+        dq->cap  = cap;
+    }
+    dq->node[(dq->head + dq->count) % dq->cap] = *node;
+    __atomic_store_n(&dq->count, dq->count + 1, __ATOMIC_RELAXED);
+    spin_unlock(&dq->lock);
+}
+
+static bool deque_pop(Deque *dq, Node *node) {
+
+    bool taken = false;
+
+    spin_lock(&dq->lock);
+    if(dq->count > 0) {
+        *node = dq->node[(dq->head + dq->count - 1) % dq->cap];
+        __atomic_store_n(&dq->count, dq->count - 1, __ATOMIC_RELAXED);
+        taken = true;
+    }
+    spin_unlock(&dq->lock);
+
+    return taken;
+}
+
+// oldest node for a thief: nearest to the root, the largest subtree
+static bool deque_steal(Deque *dq, Node *node) {
+
+    bool taken = false;
+
+    if(__atomic_load_n(&dq->count, __ATOMIC_RELAXED) == 0)
+        return false;
+    spin_lock(&dq->lock);
+    if(dq->count > 0) {
+        *node    = dq->node[dq->head];
+        dq->head = (dq->head + 1) % dq->cap;
+        __atomic_store_n(&dq->count, dq->count - 1, __ATOMIC_RELAXED);
+        taken = true;
+    }
+    spin_unlock(&dq->lock);
+
+    return taken;
+}
+
+/**
+ * @brief   SRPT lower bound: total completion time of the preemptive schedule of the processes left
+ *
+ * @param s     pointer for instance
+ * @param left  processes left
+ * @param time  start time (arrival before it counts as `time`)
+ * @return  double
+ */
+static double srpt_bound(const Search *s, unsigned long long left, Time time) {
+
+    Time heap[OPTIMAL_MAX_PROCESS];     // remaining burst of the arrived processes (min heap)
+    int size = 0, i = 0;
+    double total = 0;
+    Time now = time;
+
+    for(;;) {
+        // arrivals until now into the heap
+        for(; i < s->n && (!(left >> i & 1) || s->job[i].arrival <= now); i++) {
+            if(!(left >> i & 1))
+                continue;
+            int k = size++;
+            for(; k > 0 && heap[(k - 1) / 2] > s->job[i].burst; k = (k - 1) / 2)
+                heap[k] = heap[(k - 1) / 2];
+            heap[k] = s->job[i].burst;
+        }
+        if(size == 0) {
+            if(i == s->n)
+                break;
+            now = s->job[i].arrival;
+            continue;
+        }
+
+        // run the shortest until it ends or the next arrival
+        Time next = i < s->n ? s->job[i].arrival : TIME_MAX;
+        if(now + heap[0] <= next) {
+            now   += heap[0];
+            total += now;
+            Time last = heap[--size];
+            int k = 0;
+            for(int c; (c = 2 * k + 1) < size; k = c) {
+                if(c + 1 < size && heap[c + 1] < heap[c])
+                    c++;
+                if(heap[c] >= last)
+                    break;
+                heap[k] = heap[c];
+            }
+            heap[k] = last;
+        }
+        else {
+            heap[0] -= next - now;
+            now      = next;
+        }
+    }
+
+    return total;
+}
+
+/**
+ * @brief   job splitting lower bound: weighted completion time of the preemptive schedule by the
+ *          highest weight / burst, each run segment is a piece with its share of the weight
+ *          (the running process keeps the CPU on a tie)
+ *
+ * @param s     pointer for instance
+ * @param left  processes left
+ * @param time  start time (arrival before it counts as `time`)
+ * @return  double
+ */
+static double split_bound(const Search *s, unsigned long long left, Time time) {
+
+    Time remain[OPTIMAL_MAX_PROCESS];   // remaining burst (job index)
+    Time done[OPTIMAL_MAX_PROCESS];     // run but not charged (job index)
+    unsigned long long ready = 0;       // arrived processes left
+    double total = 0;
+    Time now = time;
+    int i = 0, cur = -1;
+
+    for(;;) {
+        for(; i < s->n && (!(left >> i & 1) || s->job[i].arrival <= now); i++)
+            if(left >> i & 1) {
+                ready |= 1ULL << i;
+                remain[i] = s->job[i].burst;
+                done[i]   = 0;
+            }
+        if(ready == 0) {
+            if(i == s->n)
+                break;
+            now = s->job[i].arrival;
+            continue;
+        }
+
+        // highest ratio, the running process on a tie: a preempted process is a finished piece
+        int pick = cur >= 0 && (ready >> cur & 1) ? cur : -1;
+        for(unsigned long long r = ready; r; r &= r - 1) {
+            int k = __builtin_ctzll(r);
+            if(pick < 0 || s->job[k].ratio > s->job[pick].ratio)
+                pick = k;
+        }
+        if(cur >= 0 && cur != pick && (ready >> cur & 1) && done[cur] > 0) {
+            total    += s->job[cur].ratio * done[cur] * now;
+            done[cur] = 0;
+        }
+        cur = pick;
+
+        Time next = i < s->n ? s->job[i].arrival : TIME_MAX;
+        if(now + remain[cur] <= next) {
+            now   += remain[cur];
+            total += s->job[cur].ratio * (done[cur] + remain[cur]) * now;
+            ready &= ~(1ULL << cur);
+            cur    = -1;
+        }
+        else {
+            done[cur]   += next - now;
+            remain[cur] -= next - now;
+            now          = next;
+        }
+    }
+
+    return total;
+}
+
+static double lower_bound(const Search *s, unsigned long long left, Time time) {
+
+    return s->weighted ? split_bound(s, left, time) : srpt_bound(s, left, time);
+}
+
+// cost of a process completed at the time
+static double completion_cost(const Search *s, int j, Time completion) {
+
+    return s->weighted ? s->job[j].weight * completion : (double) completion;
+}
+
+static double load_best(Search *s) {
+
+    double best;
+    __atomic_load(&s->best, &best, __ATOMIC_RELAXED);
+    return best;
+}
+
+// node can't be better than the incumbent (tolerance for the weighted sums)
+static bool is_pruned(Search *s, double bound) {
+
+    double best = load_best(s);
+    return bound >= best - 1e-9 * (best > 1 ? best : 1);
+}
+
+static void update_best(Search *s, const Node *node) {
+
+    spin_lock(&s->bestLock);
+    if(node->cost < load_best(s)) {
+        memcpy(s->bestSeq, node->seq, s->n);
+        __atomic_store(&s->best, &node->cost, __ATOMIC_RELAXED);
+    }
+    spin_unlock(&s->bestLock);
+}
+
+// heavier bound first: pushed first, taken last
+static int compare_bound(const void *a, const void *b) {
+
+    double x = ((const Node*) a)->bound, y = ((const Node*) b)->bound;
+    return x > y ? -1 : x < y;
+}
+
+/**
+ * @brief   expand node: a child for each process that can run next
+ *
+ * @param s     pointer for instance and incumbent
+ * @param dq    deque of the searcher
+ * @param node  node to expand
+ * @param child buffer of the children (`OPTIMAL_MAX_PROCESS`)
+ */
+static void expand(Search *s, Deque *dq, const Node *node, Node *child) {
+
+    // the two earliest ends of a process run next (dominance rule)
+    Time end1 = TIME_MAX, end2 = TIME_MAX;
+    int first = -1, count = 0;
+    for(unsigned long long r = node->left; r; r &= r - 1) {
+        int k = __builtin_ctzll(r);
+        Time end = (s->job[k].arrival > node->time ? s->job[k].arrival : node->time) + s->job[k].burst;
+        if(end < end1)
+            end2 = end1, end1 = end, first = k;
+        else if(end < end2)
+            end2 = end;
+    }
+
+    for(unsigned long long r = node->left; r; r &= r - 1) {
+        int j = __builtin_ctzll(r);
+        Time start = s->job[j].arrival > node->time ? s->job[j].arrival : node->time;
+
+        // another process could run to its end before `j` starts: put it first instead
+        Time other = j == first ? end2 : end1;
+        if(other < start || (other == start && j != first && first < j))
+            continue;
+
+        Node *c  = &child[count];
+        c->left  = node->left & ~(1ULL << j);
+        c->time  = start + s->job[j].burst;
+        c->cost  = node->cost + completion_cost(s, j, c->time);
+        c->depth = node->depth + 1;
+        memcpy(c->seq, node->seq, node->depth);
+        c->seq[node->depth] = (unsigned char) j;
+
+        if(c->left == 0) {
+            if(c->cost < load_best(s))
+                update_best(s, c);
+            continue;
+        }
+        c->bound = c->cost + lower_bound(s, c->left, c->time);
+        if(!is_pruned(s, c->bound))
+            count++;
+    }
+
+    qsort(child, count, sizeof(Node), compare_bound);
+    for(int i = 0; i < count; i++)
+        deque_push(dq, &child[i]);
+}
+
+/**
+ * @brief   searcher: own nodes newest first, steal the oldest of another searcher when empty
+ *
+ * @param data  pointer for instance and searchers (`Search`)
+ * @param id    searcher index
+ */
+static void search_worker(void *data, int id) {
+
+    Search *s = data;
+    Deque *own = &s->deque[id];
+    Node node, *child = malloc(sizeof(Node) * OPTIMAL_MAX_PROCESS);
+
+    __atomic_add_fetch(&s->running, 1, __ATOMIC_SEQ_CST);
+
+    for(;;) {
+        bool found = deque_pop(own, &node);
+        for(int v = 1; !found && v < s->jobs; v++)
+            found = deque_steal(&s->deque[(id + v) % s->jobs], &node);
+
+        if(found) {
+            if(__atomic_load_n(&s->stopped, __ATOMIC_RELAXED) || is_pruned(s, node.bound))
+                continue;
+            long long nodes = __atomic_add_fetch(&s->nodes, 1, __ATOMIC_RELAXED);
+            if(s->limit > 0 && nodes > s->limit) {
+                __atomic_store_n(&s->stopped, true, __ATOMIC_RELAXED);
+                continue;
+            }
+            expand(s, own, &node, child);
+            continue;
+        }
+
+        // no work: done when every running searcher is idle (only the owner fills a deque)
+        __atomic_add_fetch(&s->idle, 1, __ATOMIC_SEQ_CST);
+        bool done = false;
+        while(!done) {
+            if(__atomic_load_n(&s->idle, __ATOMIC_SEQ_CST) == __atomic_load_n(&s->running, __ATOMIC_SEQ_CST)) {
+                done = true;
+                break;
+            }
+            bool work = false;
+            for(int v = 0; v < s->jobs && !work; v++)
+                work = __atomic_load_n(&s->deque[v].count, __ATOMIC_RELAXED) > 0;
+            if(work) {
+                __atomic_sub_fetch(&s->idle, 1, __ATOMIC_SEQ_CST);
+                break;
+            }
+#ifndef __EMSCRIPTEN__
+            sched_yield();
+#endif
+        }
+        if(done)
+            break;
+    }
+
+    // memory allocate disable
+    free(child);
+}
+
+// non-delay order: the arrived process of the smallest key first (arrival order if `key` is NULL)
+static void greedy_order(const Search *s, const double *key, unsigned char *seq) {
+
+    unsigned long long left = s->n == 64 ? ~0ULL : (1ULL << s->n) - 1;
+    Time now = 0;
+
+    for(int d = 0; d < s->n; d++) {
+        int pick = -1;
+        for(unsigned long long r = left; r; r &= r - 1) {
+            int k = __builtin_ctzll(r);
+            if(pick < 0)
+                pick = k;
+            else if(s->job[k].arrival <= now && key != NULL &&
+                    (s->job[pick].arrival > now || key[k] < key[pick]))
+                pick = k;
+        }
+        seq[d] = (unsigned char) pick;
+        left  &= ~(1ULL << pick);
+        now    = (s->job[pick].arrival > now ? s->job[pick].arrival : now) + s->job[pick].burst;
+    }
+}
+
+static double order_cost(const Search *s, const unsigned char *seq) {
+
+    double cost = 0;
+    Time now = 0;
+
+    for(int d = 0; d < s->n; d++) {
+        const Job *j = &s->job[seq[d]];
+        now   = (j->arrival > now ? j->arrival : now) + j->burst;
+        cost += completion_cost(s, seq[d], now);
+    }
+
+    return cost;
+}
+
+// weight of the completion time: 1 / priority (smaller value is higher priority)
+static double process_weight(const Process *p, bool weighted) {
+
+    return weighted && p->priority > 0 ? 1.0 / p->priority : 1;
+}
+
+static int compare_job(const void *a, const void *b) {
+
+    const Job *x = a, *y = b;
+    if(x->arrival != y->arrival)
+        return x->arrival < y->arrival ? -1 : 1;
+    return x->index - y->index;
+}
+
+bool solve_optimal(const Process *p, int n, const OptimalOptions *opt, OptimalResult *r) {
+
+    if(n < 1 || n > OPTIMAL_MAX_PROCESS)
+        return false;
+
+    OptimalOptions none = { 0 };
+    if(opt == NULL)
+        opt = &none;
+
+    Search *s   = calloc(1, sizeof(Search));
+    s->n        = n;
+    s->weighted = opt->objective == OPTIMAL_WEIGHTED;
+    s->limit    = opt->nodeLimit;
+    s->jobs     = opt->jobs > 0 ? opt->jobs : pool_default_jobs();
+    for(int i = 0; i < n; i++) {
+        Job *j = &s->job[i];
+        j->arrival = p[i].arrival;
+        j->burst   = p[i].burst;
+        j->weight  = process_weight(&p[i], s->weighted);
+        j->ratio   = j->burst > 0 ? j->weight / j->burst : INFINITY;
+        j->index   = i;
+    }
+    qsort(s->job, n, sizeof(Job), compare_job);
+
+    // incumbent: best of arrival order, shortest burst first and weighted shortest burst first
+    double key[OPTIMAL_MAX_PROCESS];
+    unsigned char seq[OPTIMAL_MAX_PROCESS];
+    s->best = INFINITY;
+    for(int h = 0; h < 3; h++) {
+        for(int i = 0; i < n; i++)
+            key[i] = h == 1 ? (double) s->job[i].burst : -s->job[i].ratio;
+        greedy_order(s, h == 0 ? NULL : key, seq);
+        double cost = order_cost(s, seq);
+        if(cost < s->best) {
+            s->best = cost;
+            memcpy(s->bestSeq, seq, n);
+        }
+    }
+
+    // root node to the first searcher
+    Node root   = { .left = n == 64 ? ~0ULL : (1ULL << n) - 1 };
+    root.bound  = lower_bound(s, root.left, 0);
+    s->deque    = calloc(s->jobs, sizeof(Deque));
+    deque_push(&s->deque[0], &root);
+
+    run_pool(search_worker, s, s->jobs, s->jobs);
+
+    // order to the input array: start times and metrics
+    double waiting = 0, turnaround = 0, base = 0;
+    Time now = 0;
+    r->optimal   = !s->stopped;
+    r->objective = opt->objective;
+    r->n         = n;
+    r->nodes     = s->nodes;
+    for(int d = 0; d < n; d++) {
+        const Job *j = &s->job[s->bestSeq[d]];
+        Time start   = j->arrival > now ? j->arrival : now;
+        now          = start + j->burst;
+        r->order[d]        = j->index;
+        r->start[j->index] = start;
+        waiting    += start - j->arrival;
+        turnaround += now - j->arrival;
+        base       += s->weighted ? 0 : (double) (j->arrival + j->burst);
+    }
+    r->cost           = s->best - base;
+    r->rootBound      = root.bound - base;
+    r->avg_waiting    = waiting / n;
+    r->avg_turnaround = turnaround / n;
+
+    // memory allocate disable
+    for(int i = 0; i < s->jobs; i++)
+        free(s->deque[i].node);
+    free(s->deque);
+    free(s);
+
+    return true;
+}
+
+double schedule_cost(const OptimalResult *r, const Schedule *s) {
+
+    if(r->objective == OPTIMAL_WAITING)
+        return (double) s->total_waiting;
+
+    // completion: end of the last gantt chart segment of the process (the fields of a preempted
+    // process do not add up to its turnaround)
+    double cost = 0;
+    for(int i = 0; i < s->n; i++) {
+        const Process *p = &s->result[i];
+        long long k = s->segments - 1;
+        while(k >= 0 && s->gantt[k].processID != p->processID)
+            k--;
+        cost += process_weight(p, true) * (k >= 0 ? segment_end(s, k) : 0);
+    }
+
+    return cost;
+}
+
+double optimal_gap(const OptimalResult *r, const Schedule *s) {
+
+    double cost = schedule_cost(r, s);
+
+    if(r->cost > 0)
+        return (cost - r->cost) / r->cost;
+    return cost > 0 ? INFINITY : 0;
+}
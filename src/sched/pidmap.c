@@ -0,0 +1,104 @@
+/**
+ * @file    pidmap.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   process no. to dense slot index (open addressing hash, linear probing)
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// standard library
+#include <stdlib.h>
+
+// user define library
+#include "pidmap.h"
+
+/**
+ * @brief pidmap.c variable info
+ *
+ *  type        name        pointer     info
+ *  int         mask        n           bucket index mask (capacity - 1)
+ *  int         b           n           bucket index
+ *
+ */
+
+/**
+ * @brief   allocate empty buckets
+ *
+ * @param m         pointer for process no. index
+ * @param capacity  bucket count (power of 2)
+ */
+static void pidmap_alloc(PidMap *m, int capacity) {
+
+    m->capacity = capacity;
+    m->pid      = malloc(sizeof(int) * capacity);
+    m->slot     = malloc(sizeof(int) * capacity);
+    for(int i = 0; i < capacity; i++)
+        m->slot[i] = -1;
+}
+
+void pidmap_init(PidMap *m, int expected) {
+
+    int capacity = 16;
+    while(capacity < 0x40000000 && (long long) capacity * PIDMAP_LOAD < (long long) expected * 100)
+        capacity *= 2;
+
+    m->count = 0;
+    pidmap_alloc(m, capacity);
+}
+
+int pidmap_find(const PidMap *m, int pid) {
+
+    int mask = m->capacity - 1;
+    for(int b = (int) (pid_hash(pid) & mask); m->slot[b] >= 0; b = (b + 1) & mask)
+        if(m->pid[b] == pid)
+            return m->slot[b];
+
+    return -1;
+}
+
+int pidmap_insert(PidMap *m, int pid, bool *added) {
+
+    // grow: rehash every process no. into twice the buckets, slots are kept
+    if((long long) (m->count + 1) * 100 > (long long) m->capacity * PIDMAP_LOAD) {
+        PidMap old = *m;
+        pidmap_alloc(m, old.capacity * 2);
+        for(int i = 0; i < old.capacity; i++) {
+            if(old.slot[i] < 0)
+                continue;
+            int b = (int) (pid_hash(old.pid[i]) & (m->capacity - 1));
+            while(m->slot[b] >= 0)
+                b = (b + 1) & (m->capacity - 1);
+            m->pid[b]  = old.pid[i];
+            m->slot[b] = old.slot[i];
+        }
+        pidmap_free(&old);
+    }
+
+    int mask = m->capacity - 1;
+    int b    = (int) (pid_hash(pid) & mask);
+    for(; m->slot[b] >= 0; b = (b + 1) & mask) {
+        if(m->pid[b] == pid) {
+            if(added) *added = false;
+            return m->slot[b];
+        }
+    }
+
+    m->pid[b]  = pid;
+    m->slot[b] = m->count++;
+    if(added) *added = true;
+
+    return m->slot[b];
+}
+
+void pidmap_free(PidMap *m) {
+
+    free(m->pid);
+    free(m->slot);
+    m->pid      = NULL;
+    m->slot     = NULL;
+    m->capacity = 0;
+    m->count    = 0;
+}
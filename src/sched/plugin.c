@@ -0,0 +1,95 @@
+/**
+ * @file    plugin.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   runtime-loadable scheduling policy plugin of libcpusched
+ *          - dlopen on POSIX, LoadLibrary on Windows, not supported on the web
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// standard library
+#include <stdio.h>
+
+#if defined(_WIN32)
+    #include <windows.h>
+#elif !defined(__EMSCRIPTEN__)
+    #include <dlfcn.h>
+#endif
+
+// user define library
+#include "plugin.h"
+#include "policy.h"
+
+/**
+ * @brief plugin.c variable info
+ *
+ *  type        name        pointer     info
+ *  void        handle      y           shared object handle
+ *  PluginEntry entry       y           plugin entry function
+ *  Policy      policy      y           policy of the plugin
+ *
+ */
+
+bool load_plugin(const char *path, Plugin *plugin) {
+
+    plugin->handle = NULL;
+    plugin->policy = NULL;
+
+#if defined(__EMSCRIPTEN__)
+    fprintf(stderr, "WARNING: [%s] plugin is not supported on this platform\n", path);
+    return false;
+#else
+    PluginEntry entry = NULL;
+
+    // open shared object and find the entry function
+#if defined(_WIN32)
+    HMODULE handle = LoadLibraryA(path);
+    if(handle == NULL) {
+        fprintf(stderr, "WARNING: [%s] failed to load plugin (error %lu)\n", path, GetLastError());
+        return false;
+    }
+    entry = (PluginEntry) (void (*)(void)) GetProcAddress(handle, CPUSCHED_PLUGIN_ENTRY);
+#else
+    void *handle = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+    if(handle == NULL) {
+        fprintf(stderr, "WARNING: [%s] failed to load plugin: %s\n", path, dlerror());
+        return false;
+    }
+    *(void**) &entry = dlsym(handle, CPUSCHED_PLUGIN_ENTRY);
+#endif
+
+    const Policy *policy = entry ? entry(CPUSCHED_PLUGIN_ABI) : NULL;
+    if(policy == NULL || policy->name == NULL) {
+        if(entry == NULL)
+            fprintf(stderr, "WARNING: [%s] `%s` is not found\n", path, CPUSCHED_PLUGIN_ENTRY);
+        else
+            fprintf(stderr, "WARNING: [%s] plugin does not support ABI version %d\n", path, CPUSCHED_PLUGIN_ABI);
+#if defined(_WIN32)
+        FreeLibrary(handle);
+#else
+        dlclose(handle);
+#endif
+        return false;
+    }
+
+    plugin->handle = (void*) handle;
+    plugin->policy = policy;
+    return true;
+#endif
+}
+
+void unload_plugin(Plugin *plugin) {
+
+#if defined(_WIN32)
+    if(plugin->handle)
+        FreeLibrary((HMODULE) plugin->handle);
+#elif !defined(__EMSCRIPTEN__)
+    if(plugin->handle)
+        dlclose(plugin->handle);
+#endif
+    plugin->handle = NULL;
+    plugin->policy = NULL;
+}
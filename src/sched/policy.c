@@ -0,0 +1,21 @@
+/**
+ * @file    policy.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   scheduling policy interface of libcpusched
+ *          - generic entry of the engine for user defined policies
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// user define library
+#include "engine.h"
+#include "policy.h"
+#include "process.h"
+
+void run_policy(const Policy *pol, Process *p, int n, Time t, Schedule *s) {
+
+    engine_run(pol, pol->quantum, p, n, t, s);
+}
@@ -0,0 +1,114 @@
+/**
+ * @file    pool.h
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   worker threads over a task list of libcpusched (private header)
+ *          - tasks are taken in index order by the next free thread, the calling thread works too:
+ *            the caller puts the most expensive tasks first (longest processing time first)
+ *          - runs in the calling thread if threads are not available
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+#ifndef POOL_H
+#define POOL_H
+
+// standard library
+#include <stdlib.h>
+
+#ifndef __EMSCRIPTEN__
+    #include <pthread.h>
+    #include <unistd.h>
+#endif
+
+/**
+ * @brief pool.h variable info
+ *
+ *  type        name        pointer     info
+ *  PoolTask    task        y           function of one task (`i`: task index)
+ *  Pool        pool        y           shared state of the task list
+ *  int         jobs        n           thread count (0: online processor count)
+ *
+ */
+
+// function of one task
+typedef void (*PoolTask)(void *data, int i);
+
+/**
+ * @brief structure for shared state of the task list
+ *
+ */
+typedef struct Pool {
+
+    PoolTask task;  // function of one task
+    void *data;     // user data passed to every task
+    int count;      // task count
+    int next;       // next task index (atomic)
+
+} Pool;
+
+// take tasks until the list is empty
+static void* pool_worker(void *arg) {
+
+    Pool *pool = arg;
+    int i;
+
+    while((i = __atomic_fetch_add(&pool->next, 1, __ATOMIC_RELAXED)) < pool->count)
+        pool->task(pool->data, i);
+
+    return NULL;
+}
+
+/**
+ * @brief   online processor count
+ *
+ * @return  int (at least 1)
+ */
+static inline int pool_default_jobs(void) {
+
+#ifndef __EMSCRIPTEN__
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int) n : 1;
+#else
+    return 1;
+#endif
+}
+
+/**
+ * @brief   run every task with worker threads, return when all are done
+ *
+ * @param task  function of one task
+ * @param data  user data passed to every task
+ * @param count task count
+ * @param jobs  thread count (0: online processor count)
+ */
+static inline void run_pool(PoolTask task, void *data, int count, int jobs) {
+
+    Pool pool = { task, data, count, 0 };
+
+    if(jobs <= 0)
+        jobs = pool_default_jobs();
+    if(jobs > count)
+        jobs = count;
+
+#ifndef __EMSCRIPTEN__
+    pthread_t *thread = malloc(sizeof(pthread_t) * (jobs > 1 ? jobs : 1));
+    int started = 1;
+
+    for(; started < jobs; started++)
+        if(pthread_create(&thread[started], NULL, pool_worker, &pool) != 0)
+            break;
+    pool_worker(&pool);
+    for(int i = 1; i < started; i++)
+        pthread_join(thread[i], NULL);
+
+    // memory allocate disable
+    free(thread);
+#else
+    pool_worker(&pool);
+#endif
+}
+
+#endif
@@ -0,0 +1,56 @@
+/**
+ * @file    process.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   CPU scheduler simulator process: scheduling result save and metrics
+ * @version 0.1
+ * @date    (frist date: 2023-05-03, last date: 2026-10-17)
+ * 
+ * @copyright Copyright (c) 2023 Minsu Bak
+ * 
+ */
+
+// standard libaray
+#include <stdlib.h>
+
+// user define library
+#include "process.h"
+
+void save_schedule(Schedule *s, const char *algo, Process *p, Segment *g, long long segments, int n, Time t, Time tt, Time tw, Time tr) {
+
+    s->algo             = algo;
+    s->result           = p;
+    s->gantt            = g;
+    s->segments         = segments;
+    s->n                = n;
+    s->t                = t;
+    s->total_turnaround = tt;
+    s->total_waiting    = tw;
+    s->total_response   = tr;
+}
+
+void free_schedule(Schedule *s) {
+
+    free(s->result);
+    free(s->gantt);
+    *s = (Schedule) { 0 };
+}
+
+Time segment_end(const Schedule *s, long long i) {
+
+    return i + 1 < s->segments ? s->gantt[i + 1].start : s->t;
+}
+
+Metrics get_metrics(const Schedule *s) {
+
+    Metrics m = { 0 };
+
+    if(s->n > 0) {
+        m.avg_turnaround = (double) s->total_turnaround / s->n;
+        m.avg_waiting    = (double) s->total_waiting / s->n;
+        m.avg_response   = (double) s->total_response / s->n;
+    }
+    if(s->t > 0)
+        m.throughput = (double) s->n / s->t;
+
+    return m;
+}
@@ -0,0 +1,79 @@
+/**
+ * @file    queue.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   basic queue structure / edit for CPU scheduler simulator
+ * @version 0.1
+ * @date    (last update: 2026-10-17)
+ * 
+ * @copyright Copyright (c) 2022 Minsu Bak
+ * 
+ */
+
+// standard libraray
+#include <stdio.h>
+#include <stdlib.h>
+
+// user define library
+#include "process.h"
+#include "queue.h"
+
+void init_queue(QueueType *q) {
+    
+    q->front = q->rear = 0;
+}
+
+int is_empty_q(QueueType *q) {
+
+    return (q->front == q->rear);
+}
+
+int is_full_q(QueueType *q) {
+
+    return (q->front == (q->rear+1) % MAX);
+}
+
+void enqueue(QueueType *q, Process item) {
+
+    if(is_full_q(q)) {
+        fprintf(stderr, "queue is full!\n");
+        exit(1);
+    }
+    q->rear = (q->rear + 1) % MAX;
+    q->queue[q->rear] = item;
+}
+
+Process* dequeue(QueueType *q) {
+
+    if(is_empty_q(q)) {
+        fprintf(stderr, "queue is empty!\n");
+        return NULL;
+    }
+    q->front = (q->front + 1) % MAX;
+    return &q->queue[q->front];
+}
+
+Process peek(QueueType *q) {
+
+    // empty queue: idle process
+    if(is_empty_q(q)) return (Process) { .processID = IDLE_PID };
+    return q->queue[(q->front + 1) % MAX];
+}
+
+void sort(QueueType *q, int(*compare)(const void* a, const void* b)) {
+
+    int count = (q->rear - q->front + MAX) % MAX;
+
+    // if the queue is wrapped around, sort a copy and put it back in ring order
+    // WARN: storage out of the queue is not touched, dispatched process may point there
+    if(q->front + count >= MAX) {
+        Process temp[MAX];
+        for(int i = 0; i < count; i++)
+            temp[i] = q->queue[(q->front + 1 + i) % MAX];
+        qsort(temp, count, sizeof(Process), compare);
+        for(int i = 0; i < count; i++)
+            q->queue[(q->front + 1 + i) % MAX] = temp[i];
+        return;
+    }
+
+    qsort(q->queue + q->front + 1, count, sizeof(Process), compare);
+}
@@ -0,0 +1,244 @@
+/**
+ * @file    radix.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   parallel LSD radix sort of process data by arrival time
+ *          - sort key: 64-bit arrival with flipped sign bit, the index moves with it in a
+ *            separate array, LSD passes are stable so the index keeps the input order of the same arrival
+ *          - process data is moved once at the end (gather by index)
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// standard library
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef __EMSCRIPTEN__
+    #include <pthread.h>
+    #include <unistd.h>
+#endif
+
+// user define library
+#include "process.h"
+#include "radix.h"
+
+/**
+ * @brief radix.c variable info
+ *
+ *  type        name        pointer     info
+ *  #define     BUCKETS     n           bucket count of one digit
+ *  RadixSort   rs          y           shared state of one sort
+ *  RadixTask   task        y           worker thread state (chunk of the items)
+ *  uint64_t    src         y           sort keys of the present pass
+ *  uint64_t    dst         y           sort keys of the next pass
+ *  uint32_t    srcIndex    y           process index of each key of the present pass
+ *  uint32_t    dstIndex    y           process index of each key of the next pass
+ *  size_t      count       y           bucket count of each chunk
+ *  int         shift       n           bit position of the present digit
+ *
+ */
+
+#define BUCKETS (1 << RADIX_BITS)   // bucket count of one digit
+
+/**
+ * @brief structure for shared state of one sort
+ *
+ */
+typedef struct RadixSort {
+
+    uint64_t *src;          // sort keys of the present pass
+    uint64_t *dst;          // sort keys of the next pass
+    uint32_t *srcIndex;     // process index of each key of the present pass
+    uint32_t *dstIndex;     // process index of each key of the next pass
+    const Process *from;    // process data before sort
+    Process *to;            // process data after sort
+    size_t (*count)[BUCKETS]; // bucket count (then scatter position) of each chunk
+    int shift;              // bit position of the present digit
+    int threads;            // chunk count
+
+} RadixSort;
+
+/**
+ * @brief structure for worker thread state
+ *
+ */
+typedef struct RadixTask {
+
+    RadixSort *rs;          // shared state
+    int id;                 // chunk no.
+    size_t lo, hi;          // chunk range
+
+} RadixTask;
+
+typedef void* (*RadixStep)(void *arg);
+
+// count digits of the chunk
+static void* radix_count(void *arg) {
+
+    RadixTask *task = arg;
+    size_t *count   = task->rs->count[task->id];
+    int shift       = task->rs->shift;
+
+    memset(count, 0, sizeof(size_t) * BUCKETS);
+    for(size_t i = task->lo; i < task->hi; i++)
+        count[(task->rs->src[i] >> shift) & (BUCKETS - 1)]++;
+
+    return NULL;
+}
+
+// move keys (and their index) of the chunk to the scatter position of each digit
+static void* radix_scatter(void *arg) {
+
+    RadixTask *task = arg;
+    RadixSort *rs   = task->rs;
+    size_t *pos     = rs->count[task->id];
+    int shift       = rs->shift;
+
+    for(size_t i = task->lo; i < task->hi; i++) {
+        uint64_t key = rs->src[i];
+        size_t to    = pos[(key >> shift) & (BUCKETS - 1)]++;
+        rs->dst[to]      = key;
+        rs->dstIndex[to] = rs->srcIndex[i];
+    }
+
+    return NULL;
+}
+
+// gather process data of the chunk in sorted order
+static void* radix_gather(void *arg) {
+
+    RadixTask *task = arg;
+
+    for(size_t i = task->lo; i < task->hi; i++)
+        task->rs->to[i] = task->rs->from[task->rs->srcIndex[i]];
+
+    return NULL;
+}
+
+// run one step on every chunk, the calling thread takes the first chunk
+static void radix_step(RadixTask *task, int threads, RadixStep step) {
+
+#ifndef __EMSCRIPTEN__
+    pthread_t thread[RADIX_THREADS];
+    int started = 1;
+
+    for(; started < threads; started++)
+        if(pthread_create(&thread[started], NULL, step, &task[started]) != 0)
+            break;
+    step(&task[0]);
+    for(int i = 1; i < started; i++)
+        pthread_join(thread[i], NULL);
+    // run the rest in the calling thread if a thread could not be created
+    for(int i = started; i < threads; i++)
+        step(&task[i]);
+#else
+    for(int i = 0; i < threads; i++)
+        step(&task[i]);
+#endif
+}
+
+bool sorted_by_arrival(const Process *p, int n) {
+
+    for(int i = 1; i < n; i++)
+        if(p[i].arrival < p[i - 1].arrival)
+            return false;
+
+    return true;
+}
+
+bool sort_by_arrival(Process *p, int n, int threads) {
+
+    if(n < 2 || sorted_by_arrival(p, n))
+        return true;
+
+    // worker thread count: one for each `RADIX_GRAIN` processes, at most CPU count
+    if(threads <= 0) {
+        threads = 1;
+#if defined(_SC_NPROCESSORS_ONLN) && !defined(__EMSCRIPTEN__)
+        threads = (int) sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+        if(threads > n / RADIX_GRAIN)
+            threads = n / RADIX_GRAIN;
+    }
+    if(threads < 1) threads = 1;
+    if(threads > RADIX_THREADS) threads = RADIX_THREADS;
+
+    RadixSort rs = {
+        .src      = malloc(sizeof(uint64_t) * n),
+        .dst      = malloc(sizeof(uint64_t) * n),
+        .srcIndex = malloc(sizeof(uint32_t) * n),
+        .dstIndex = malloc(sizeof(uint32_t) * n),
+        .count    = malloc(sizeof(size_t[BUCKETS]) * threads),
+        .to       = malloc(sizeof(Process) * n),
+        .threads  = threads
+    };
+    if(rs.src == NULL || rs.dst == NULL || rs.srcIndex == NULL || rs.dstIndex == NULL || rs.count == NULL || rs.to == NULL) {
+        free(rs.src);
+        free(rs.dst);
+        free(rs.srcIndex);
+        free(rs.dstIndex);
+        free(rs.count);
+        free(rs.to);
+        return false;
+    }
+    RadixTask task[RADIX_THREADS];
+    for(int i = 0; i < threads; i++)
+        task[i] = (RadixTask) { &rs, i, (size_t) n * i / threads, (size_t) n * (i + 1) / threads };
+
+    // sort key: whole 64-bit arrival with flipped sign bit (unsigned order), index in its own array
+    uint64_t first  = (uint64_t) p[0].arrival ^ 0x8000000000000000ULL;
+    uint64_t differ = 0;
+    for(int i = 0; i < n; i++) {
+        rs.src[i]      = (uint64_t) p[i].arrival ^ 0x8000000000000000ULL;
+        rs.srcIndex[i] = (uint32_t) i;
+        differ        |= rs.src[i] ^ first;
+    }
+
+    for(int shift = 0; shift < 64; shift += RADIX_BITS) {
+
+        // skip digit equal in every process
+        if(((differ >> shift) & (BUCKETS - 1)) == 0)
+            continue;
+
+        rs.shift = shift;
+        radix_step(task, threads, radix_count);
+
+        // scatter position: digit-major, then chunk order (keeps the sort stable)
+        size_t sum = 0;
+        for(int d = 0; d < BUCKETS; d++) {
+            for(int i = 0; i < threads; i++) {
+                size_t c       = rs.count[i][d];
+                rs.count[i][d] = sum;
+                sum           += c;
+            }
+        }
+
+        radix_step(task, threads, radix_scatter);
+
+        uint64_t *swap = rs.src;
+        rs.src = rs.dst;
+        rs.dst = swap;
+        uint32_t *swapIndex = rs.srcIndex;
+        rs.srcIndex = rs.dstIndex;
+        rs.dstIndex = swapIndex;
+    }
+
+    // move process data once, then copy back
+    rs.from = p;
+    radix_step(task, threads, radix_gather);
+    memcpy(p, rs.to, sizeof(Process) * n);
+
+    // memory allocate disable
+    free(rs.to);
+    free(rs.src);
+    free(rs.dst);
+    free(rs.srcIndex);
+    free(rs.dstIndex);
+    free(rs.count);
+
+    return true;
+}
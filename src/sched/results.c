@@ -0,0 +1,547 @@
+/**
+ * @file    results.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   compact columnar results file of libcpusched
+ *          - write: columns are built from the schedule, encoded into memory, then written after
+ *            the header, index and tables
+ *          - read: the file is mapped, only the blocks of the requested rows are decoded
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// standard library
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+// user define library
+#include "pidmap.h"
+#include "results.h"
+
+/**
+ * @brief results.c variable info
+ *
+ *  type            name            pointer     info
+ *  #define         HEADER_SIZE     n           bytes of the header
+ *  #define         INDEX_SIZE      n           bytes of the index entry of each column
+ *  ByteBuffer      buf             y           growable byte array for encoded column data
+ *  long long       value           y           values of one column
+ *  unsigned long long table        y           data offset of each block (relative to the column data)
+ *  unsigned char   entry           y           index entry of the column in the file
+ *
+ */
+
+#define HEADER_SIZE 128 // bytes of the header
+#define INDEX_SIZE  56  // bytes of the index entry of each column
+
+// column name (same order as the column no.)
+const char *resultsColumn[RESULTS_COLUMNS] = {
+    "pid", "priority", "arrival", "burst", "waiting", "timeout", "execute",
+    "completion", "response", "seg_start", "seg_pid"
+};
+
+/**
+ * @brief structure for growable byte array
+ *
+ */
+typedef struct ByteBuffer {
+
+    unsigned char *data;    // bytes
+    size_t size;            // bytes used
+    size_t capacity;        // bytes allocated
+
+} ByteBuffer;
+
+// write little-endian integer of `bytes` bytes
+static void put_le(unsigned char *dst, unsigned long long v, int bytes) {
+
+    for(int i = 0; i < bytes; i++, v >>= 8)
+        dst[i] = (unsigned char) v;
+}
+
+// read little-endian integer of `bytes` bytes
+static unsigned long long get_le(const unsigned char *src, int bytes) {
+
+    unsigned long long v = 0;
+    for(int i = bytes - 1; i >= 0; i--)
+        v = v << 8 | src[i];
+    return v;
+}
+
+// append unsigned varint (7 bits for each byte, lower bits first)
+static void put_varint(ByteBuffer *buf, unsigned long long v) {
+
+    if(buf->size + 10 > buf->capacity) {
+        buf->capacity = buf->capacity ? buf->capacity * 2 : 65536;
+        buf->data     = realloc(buf->data, buf->capacity);
+    }
+    while(v >= 0x80) {
+        buf->data[buf->size++] = (unsigned char) (v & 0x7f) | 0x80;
+        v >>= 7;
+    }
+    buf->data[buf->size++] = (unsigned char) v;
+}
+
+// read unsigned varint, false at the end of data or invalid varint
+static bool get_varint(const unsigned char **pos, const unsigned char *end, unsigned long long *v) {
+
+    *v = 0;
+    for(int shift = 0; shift < 64 && *pos < end; shift += 7) {
+        unsigned char c = *(*pos)++;
+        *v |= (unsigned long long) (c & 0x7f) << shift;
+        if(!(c & 0x80))
+            return true;
+    }
+    return false;
+}
+
+// zigzag encoding: small negative value takes a few bytes too
+static unsigned long long zigzag(long long v)           { return ((unsigned long long) v << 1) ^ (unsigned long long) (v >> 63); }
+static long long          unzigzag(unsigned long long v) { return (long long) (v >> 1) ^ -(long long) (v & 1); }
+
+// block count of `rows` rows
+static long long block_count(long long rows) { return (rows + RESULTS_BLOCK - 1) / RESULTS_BLOCK; }
+
+/**
+ * @brief   encode one column (delta restarts at each block)
+ *
+ * @param buf       byte array for encoded data
+ * @param column    column no.
+ * @param value     values of the column
+ * @param rows      row count
+ * @param table     data offset of each block (relative to the column data)
+ * @param entry     index entry of the column (min and max are filled)
+ */
+static void encode_column(ByteBuffer *buf, int column, const long long *value, long long rows, unsigned long long *table, unsigned char *entry) {
+
+    size_t begin  = buf->size;
+    long long min = rows > 0 ? value[0] : 0, max = min, prev = 0;
+
+    for(long long i = 0; i < rows; i++) {
+        if(i % RESULTS_BLOCK == 0) {
+            table[i / RESULTS_BLOCK] = buf->size - begin;
+            prev = 0;
+        }
+        // segment start only grows: delta is the length of the previous segment
+        if(column == RESULTS_SEG_START)
+            put_varint(buf, (unsigned long long) (value[i] - prev));
+        else
+            put_varint(buf, zigzag(value[i] - prev));
+        prev = value[i];
+        if(value[i] < min) min = value[i];
+        if(value[i] > max) max = value[i];
+    }
+
+    put_le(entry + 0, (unsigned long long) column, 4);
+    put_le(entry + 8, (unsigned long long) rows, 8);
+    put_le(entry + 24, buf->size - begin, 8);
+    put_le(entry + 40, (unsigned long long) min, 8);
+    put_le(entry + 48, (unsigned long long) max, 8);
+}
+
+bool save_results(const char *fileName, const Schedule *s) {
+
+    int n = s->n;
+
+    // segments of the gantt chart, completion and first run of each process
+    long long segments = s->segments;
+    long long *seg     = malloc(sizeof(long long) * (segments * 2 + 1));
+    long long *first   = malloc(sizeof(long long) * (n + 1));
+    long long *last    = malloc(sizeof(long long) * (n + 1));
+    PidMap index;
+
+    // slot of each process is its row (process no. is unique)
+    pidmap_init(&index, n);
+    for(int i = 0; i < n; i++) {
+        pidmap_insert(&index, s->result[i].processID, NULL);
+        first[i] = -1;
+        last[i]  = 0;
+    }
+
+    for(long long m = 0; m < segments; m++) {
+        int pid           = s->gantt[m].processID;
+        int slot          = pid == IDLE_PID ? -1 : pidmap_find(&index, pid);
+        seg[m]            = s->gantt[m].start;
+        seg[segments + m] = pid;
+        if(slot >= 0 && first[slot] < 0)
+            first[slot] = s->gantt[m].start;
+        if(slot >= 0)
+            last[slot] = segment_end(s, m);
+    }
+
+    // header, index and tables
+    long long rows[RESULTS_COLUMNS], blocks = 0;
+    for(int c = 0; c < RESULTS_COLUMNS; c++) {
+        rows[c] = c < RESULTS_SEG_START ? n : segments;
+        blocks += block_count(rows[c]);
+    }
+    size_t head = HEADER_SIZE + INDEX_SIZE * RESULTS_COLUMNS;
+    size_t meta = head + (blocks + block_count(segments)) * 8;
+    unsigned char *header = calloc(1, meta);
+    unsigned long long *table = malloc(sizeof(unsigned long long) * (blocks + 1));
+    ByteBuffer buf = { 0 };
+    long long *value = malloc(sizeof(long long) * (n + 1));
+
+    // columns
+    long long tableAt = 0;
+    for(int c = 0; c < RESULTS_COLUMNS; c++) {
+        const long long *v = value;
+        for(int i = 0; i < n && c < RESULTS_SEG_START; i++) {
+            const Process *p = &s->result[i];
+            switch(c) {
+            case RESULTS_PID:        value[i] = p->processID;            break;
+            case RESULTS_PRIORITY:   value[i] = p->priority;             break;
+            case RESULTS_ARRIVAL:    value[i] = p->arrival;              break;
+            case RESULTS_BURST:      value[i] = p->burst;                break;
+            case RESULTS_WAITING:    value[i] = p->waiting;              break;
+            case RESULTS_TIMEOUT:    value[i] = p->timeout;              break;
+            case RESULTS_EXECUTE:    value[i] = p->execute;              break;
+            case RESULTS_COMPLETION: value[i] = last[i];                 break;
+            case RESULTS_RESPONSE:   value[i] = first[i] - p->arrival;   break;
+            }
+        }
+        if(c == RESULTS_SEG_START) v = seg;
+        if(c == RESULTS_SEG_PID)   v = seg + segments;
+
+        unsigned char *entry = header + HEADER_SIZE + INDEX_SIZE * c;
+        size_t offset        = buf.size;
+        encode_column(&buf, c, v, rows[c], table + tableAt, entry);
+        put_le(entry + 16, meta + offset, 8);
+        put_le(entry + 32, head + tableAt * 8, 8);
+        for(long long b = 0; b < block_count(rows[c]); b++)
+            put_le(header + head + (tableAt + b) * 8, table[tableAt + b], 8);
+        tableAt += block_count(rows[c]);
+    }
+
+    // time index: start time of each segment block
+    for(long long b = 0; b < block_count(segments); b++)
+        put_le(header + head + (blocks + b) * 8, (unsigned long long) seg[b * RESULTS_BLOCK], 8);
+
+    memcpy(header, RESULTS_MAGIC, 4);
+    put_le(header + 4, RESULTS_VERSION, 4);
+    put_le(header + 8, RESULTS_COLUMNS, 4);
+    put_le(header + 12, RESULTS_BLOCK, 4);
+    put_le(header + 16, (unsigned long long) n, 8);
+    put_le(header + 24, (unsigned long long) s->t, 8);
+    put_le(header + 32, (unsigned long long) segments, 8);
+    put_le(header + 40, (unsigned long long) s->total_turnaround, 8);
+    put_le(header + 48, (unsigned long long) s->total_waiting, 8);
+    put_le(header + 56, (unsigned long long) s->total_response, 8);
+    put_le(header + 64, head + blocks * 8, 8);
+    strncpy((char*) header + 72, s->algo ? s->algo : "", RESULTS_ALGO_W - 1);
+
+    FILE *fp = fopen(fileName, "wb");
+    bool ok  = fp != NULL
+            && fwrite(header, 1, meta, fp) == meta
+            && fwrite(buf.data, 1, buf.size, fp) == buf.size;
+    if(fp != NULL && fclose(fp) != 0)
+        ok = false;
+    if(!ok)
+        fprintf(stderr, "WARNING: RESULTS: [%s] failed to write file\n", fileName);
+
+    // memory allocate disable
+    free(buf.data);
+    free(value);
+    free(table);
+    free(header);
+    free(seg);
+    free(first);
+    free(last);
+    pidmap_free(&index);
+
+    return ok;
+}
+
+// index entry of the column
+static const unsigned char* column_entry(const ResultsFile *r, int column) {
+
+    return r->data + HEADER_SIZE + INDEX_SIZE * column;
+}
+
+// check that every offset of the index is inside the file and the header agrees with the columns
+static bool check_results(const ResultsFile *r) {
+
+    if(r->size < HEADER_SIZE + INDEX_SIZE * RESULTS_COLUMNS
+        || memcmp(r->data, RESULTS_MAGIC, 4) != 0
+        || get_le(r->data + 4, 4) != RESULTS_VERSION
+        || get_le(r->data + 8, 4) != RESULTS_COLUMNS
+        || get_le(r->data + 12, 4) != RESULTS_BLOCK)
+        return false;
+
+    long long n        = (long long) get_le(r->data + 16, 8);
+    Time t             = (Time) get_le(r->data + 24, 8);
+    long long segments = (long long) get_le(r->data + 32, 8);
+    unsigned long long timeIndex = get_le(r->data + 64, 8);
+    if(segments < 0 || timeIndex > r->size || (r->size - timeIndex) / 8 < (unsigned long long) block_count(segments))
+        return false;
+
+    // every segment is at least one time unit, the chart is empty only without time
+    if(n < 0 || n > INT_MAX || t < 0 || segments > t || (segments == 0) != (t == 0))
+        return false;
+
+    for(int c = 0; c < RESULTS_COLUMNS; c++) {
+        const unsigned char *e = column_entry(r, c);
+        long long rows           = (long long) get_le(e + 8, 8);
+        unsigned long long data  = get_le(e + 16, 8);
+        unsigned long long bytes = get_le(e + 24, 8);
+        unsigned long long table = get_le(e + 32, 8);
+        if(rows < 0 || data > r->size || bytes > r->size - data || table > r->size
+            || (r->size - table) / 8 < (unsigned long long) block_count(rows))
+            return false;
+
+        // row count of the header, each row is at least one byte of the column data
+        if(rows != (c < RESULTS_SEG_START ? n : segments) || (unsigned long long) rows > bytes)
+            return false;
+        for(long long b = 0; b < block_count(rows); b++)
+            if(get_le(r->data + table + b * 8, 8) > bytes)
+                return false;
+    }
+
+    return true;
+}
+
+bool open_results(const char *fileName, ResultsFile *r) {
+
+    *r = (ResultsFile) { 0 };
+
+#ifndef _WIN32
+    int fd = open(fileName, O_RDONLY);
+    struct stat st;
+    if(fd >= 0 && fstat(fd, &st) == 0 && st.st_size > 0) {
+        void *map = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(map != MAP_FAILED) {
+            r->data   = map;
+            r->size   = (size_t) st.st_size;
+            r->mapped = true;
+        }
+    }
+    if(fd >= 0)
+        close(fd);
+#endif
+
+    // read the whole file if it is not mapped
+    if(r->data == NULL) {
+        FILE *fp = fopen(fileName, "rb");
+        if(fp != NULL) {
+            fseek(fp, 0, SEEK_END);
+            long size = ftell(fp);
+            fseek(fp, 0, SEEK_SET);
+            unsigned char *data = size > 0 ? malloc((size_t) size) : NULL;
+            if(data != NULL && fread(data, 1, (size_t) size, fp) == (size_t) size) {
+                r->data = data;
+                r->size = (size_t) size;
+            }
+            else
+                free(data);
+            fclose(fp);
+        }
+    }
+
+    if(r->data == NULL || !check_results(r)) {
+        fprintf(stderr, "WARNING: RESULTS: [%s] %s\n", fileName, r->data ? "invalid results file" : "failed to open file");
+        close_results(r);
+        return false;
+    }
+
+    const unsigned char *h = r->data;
+    memcpy(r->algo, h + 72, RESULTS_ALGO_W - 1);
+    r->n                = (int) get_le(h + 16, 8);
+    r->t                = (Time) get_le(h + 24, 8);
+    r->segments         = (long long) get_le(h + 32, 8);
+    r->total_turnaround = (Time) get_le(h + 40, 8);
+    r->total_waiting    = (Time) get_le(h + 48, 8);
+    r->total_response   = (Time) get_le(h + 56, 8);
+
+    return true;
+}
+
+void close_results(ResultsFile *r) {
+
+#ifndef _WIN32
+    if(r->mapped)
+        munmap((void*) r->data, r->size);
+    else
+#endif
+        free((void*) r->data);
+
+    *r = (ResultsFile) { 0 };
+}
+
+long long column_range(const ResultsFile *r, int column, long long *min, long long *max) {
+
+    if(column < 0 || column >= RESULTS_COLUMNS)
+        return -1;
+
+    const unsigned char *e = column_entry(r, column);
+    *min = (long long) get_le(e + 40, 8);
+    *max = (long long) get_le(e + 48, 8);
+    return (long long) get_le(e + 8, 8);
+}
+
+long long read_column(const ResultsFile *r, int column, long long first, long long count, long long *out) {
+
+    if(column < 0 || column >= RESULTS_COLUMNS || first < 0 || count < 0)
+        return -1;
+
+    const unsigned char *e = column_entry(r, column);
+    long long rows = (long long) get_le(e + 8, 8);
+    if(first >= rows)
+        return 0;
+    if(count > rows - first)
+        count = rows - first;
+
+    // start at the block of the first row
+    const unsigned char *data = r->data + get_le(e + 16, 8);
+    const unsigned char *end  = data + get_le(e + 24, 8);
+    const unsigned char *tbl  = r->data + get_le(e + 32, 8);
+    long long row  = first / RESULTS_BLOCK * RESULTS_BLOCK;
+    long long prev = 0, done = 0;
+    const unsigned char *pos = data + get_le(tbl + row / RESULTS_BLOCK * 8, 8);
+
+    for(; done < count; row++) {
+        unsigned long long v;
+        if(row % RESULTS_BLOCK == 0)
+            prev = 0;
+        if(!get_varint(&pos, end, &v))
+            return -1;
+        prev += column == RESULTS_SEG_START ? (long long) v : unzigzag(v);
+        if(row >= first)
+            out[done++] = prev;
+    }
+
+    return done;
+}
+
+long long find_segment(const ResultsFile *r, Time time) {
+
+    if(time < 0 || time >= r->t || r->segments == 0)
+        return -1;
+
+    // last segment block starting at or before the time
+    const unsigned char *index = r->data + get_le(r->data + 64, 8);
+    long long lo = 0, hi = block_count(r->segments) - 1;
+    while(lo < hi) {
+        long long mid = (lo + hi + 1) / 2;
+        if((Time) get_le(index + mid * 8, 8) <= time)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+
+    // last segment of the block starting at or before the time
+    long long start[RESULTS_BLOCK];
+    long long count = read_column(r, RESULTS_SEG_START, lo * RESULTS_BLOCK, RESULTS_BLOCK, start);
+    if(count <= 0)
+        return -1;
+    long long k = 0;
+    while(k + 1 < count && start[k + 1] <= time) k++;
+
+    return lo * RESULTS_BLOCK + k;
+}
+
+long long read_segments(const ResultsFile *r, long long first, long long count, ResultsSegment *seg) {
+
+    if(first < 0 || count < 0)
+        return -1;
+    if(first >= r->segments)
+        return 0;
+    if(count > r->segments - first)
+        count = r->segments - first;
+
+    // one more start for the length of the last segment
+    long long *value = malloc(sizeof(long long) * (count + 1) * 2);
+    long long got    = read_column(r, RESULTS_SEG_START, first, count + 1, value);
+    if(got < count || read_column(r, RESULTS_SEG_PID, first, count, value + count + 1) != count) {
+        free(value);
+        return -1;
+    }
+
+    for(long long i = 0; i < count; i++) {
+        seg[i].start  = value[i];
+        seg[i].length = (i + 1 < got ? value[i + 1] : r->t) - value[i];
+        seg[i].pid    = (int) value[count + 1 + i];
+    }
+
+    free(value);
+    return count;
+}
+
+bool load_results(const char *fileName, Schedule *s) {
+
+    ResultsFile r;
+    if(!open_results(fileName, &r))
+        return false;
+
+    // header is checked against the columns by `open_results()`
+    int n = r.n;
+    Process *result = calloc(1, sizeof(Process) * n + RESULTS_ALGO_W);
+    Segment *gantt  = malloc(sizeof(Segment) * (r.segments > 0 ? r.segments : 1));
+    long long *value = malloc(sizeof(long long) * ((size_t) n + 1));
+    ResultsSegment *seg = malloc(sizeof(ResultsSegment) * RESULTS_BLOCK);
+    PidMap index;
+    bool memory = result != NULL && gantt != NULL && value != NULL && seg != NULL;
+    bool ok     = memory;
+
+    // per-process columns
+    for(int c = 0; c < RESULTS_SEG_START && ok; c++) {
+        ok = read_column(&r, c, 0, n, value) == n;
+        for(int i = 0; i < n && ok; i++) {
+            Process *p = &result[i];
+            switch(c) {
+            case RESULTS_PID:       p->processID = (int) value[i];  break;
+            case RESULTS_PRIORITY:  p->priority  = (int) value[i];  break;
+            case RESULTS_ARRIVAL:   p->arrival   = value[i];        break;
+            case RESULTS_BURST:     p->burst     = value[i];        break;
+            case RESULTS_WAITING:   p->waiting   = value[i];        break;
+            case RESULTS_TIMEOUT:   p->timeout   = value[i];        break;
+            case RESULTS_EXECUTE:   p->execute   = value[i];        break;
+            }
+        }
+    }
+
+    // gantt chart from the segments
+    pidmap_init(&index, n);
+    for(int i = 0; i < n && ok; i++)
+        pidmap_insert(&index, result[i].processID, NULL);
+    for(long long first = 0; first < r.segments && ok; first += RESULTS_BLOCK) {
+        long long count = read_segments(&r, first, RESULTS_BLOCK, seg);
+        ok = count > 0;
+        for(long long i = 0; i < count && ok; i++) {
+            // the chart starts at 0, each segment has at least one time unit
+            ok = (first + i > 0 || seg[i].start == 0)
+              && seg[i].length > 0 && seg[i].start + seg[i].length <= r.t
+              && (seg[i].pid == IDLE_PID || pidmap_find(&index, seg[i].pid) >= 0);
+            gantt[first + i] = (Segment) { .start = seg[i].start, .processID = seg[i].pid };
+        }
+    }
+    pidmap_free(&index);
+
+    if(ok) {
+        char *algo = (char*) (result + n);
+        memcpy(algo, r.algo, RESULTS_ALGO_W);
+        save_schedule(s, algo, result, gantt, r.segments, n, r.t, r.total_turnaround, r.total_waiting, r.total_response);
+    }
+    else {
+        fprintf(stderr, "WARNING: RESULTS: [%s] %s\n", fileName, memory ? "invalid results file" : "not enough memory for the schedule");
+        free(result);
+        free(gantt);
+    }
+
+    // memory allocate disable
+    free(value);
+    free(seg);
+    close_results(&r);
+
+    return ok;
+}
@@ -0,0 +1,452 @@
+/**
+ * @file    sampler.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   live workload capture from /proc of the local machine (Linux)
+ *          - list: `/proc` and `/proc/<pid>/task` with `getdents64()` into reused buffers
+ *          - read: `schedstat` and `stat` of each task with `pread()` on files kept open
+ *          - apply: run time growth of each task opens or extends its CPU burst,
+ *            a sleeping or exited task finishes it
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __linux__
+    #include <errno.h>
+    #include <fcntl.h>
+    #include <sys/syscall.h>
+    #include <time.h>
+    #include <unistd.h>
+#endif
+
+// user define library
+#include "pidmap.h"
+#include "sampler.h"
+#include "workload.h"
+
+/**
+ * @brief sampler.c variable info
+ *
+ *  type            name        pointer     info
+ *  #define         DIR_BUFFER  n           bytes of each directory listing buffer
+ *  #define         FILE_BUFFER n           bytes of the file read buffer
+ *  SampleTask      task        y           state of each task (index: dense slot of `index`)
+ *  Sampler         s           y           state of one sampling run
+ *  long long       now         n           time of the sample (nanosecond, CLOCK_MONOTONIC)
+ *
+ */
+
+#ifdef __linux__
+
+#define DIR_BUFFER  32768   // bytes of each directory listing buffer
+#define FILE_BUFFER 4096    // bytes of the file read buffer
+
+enum { FILE_SCHEDSTAT, FILE_STAT };
+
+/**
+ * @brief structure for directory entry of `getdents64()`
+ *
+ */
+typedef struct DirEntry {
+
+    unsigned long long ino;     // inode no.
+    long long off;              // offset of the next entry
+    unsigned short reclen;      // size of this entry
+    unsigned char type;         // file type
+    char name[];                // file name (NUL terminated)
+
+} DirEntry;
+
+/**
+ * @brief structure for state of each task
+ *
+ */
+typedef struct SampleTask {
+
+    int tgid;               // process (thread group) PID
+    int tid;                // task TID
+    int prio;               // kernel priority
+    int fd[2];              // open `schedstat` and `stat` (-1 if not kept open)
+    unsigned long long born;// start time of the task (detects TID reuse)
+    long long run;          // run time at the last sample (nanosecond)
+    long long wait;         // wait time at the last sample (nanosecond)
+    long long seen;         // last sample the task was listed in
+    bool alive;             // listed in the last sample
+    bool open;              // CPU burst in progress
+    long long arrival;      // start of the present CPU burst (nanosecond)
+    long long burst;        // run time of the present CPU burst (nanosecond)
+    long long first;        // start of the first CPU burst (task mode)
+    long long total;        // run time of every CPU burst (task mode)
+
+} SampleTask;
+
+/**
+ * @brief structure for state of one sampling run
+ *
+ */
+typedef struct Sampler {
+
+    SamplerOptions opt;     // options with defaults applied
+    TraceSink sink;         // function called for each process
+    void *data;             // user data passed to `sink`
+    SamplerStats *stats;    // statistics
+    int proc;               // `/proc` directory
+    PidMap index;           // task TID to dense slot
+    SampleTask *task;       // state of each task
+    int capacity;           // task array capacity
+    int files;              // files kept open
+    int burstNo;            // next CPU burst no.
+    long long base;         // time of the first sample
+    long long now;          // time of the present sample
+    long long prev;         // time of the previous sample
+    char dirs[DIR_BUFFER];  // listing of `/proc`
+    char tasks[DIR_BUFFER]; // listing of `/proc/<pid>/task`
+    char buffer[FILE_BUFFER];// file read buffer
+
+} Sampler;
+
+// CLOCK_MONOTONIC in nanosecond
+static long long monotonic_ns(void) {
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+// directory name is a PID (digits only)
+static int dir_pid(const char *name) {
+
+    int pid = 0;
+    for(const char *c = name; *c; c++) {
+        if(*c < '0' || *c > '9')
+            return 0;
+        pid = pid * 10 + (*c - '0');
+    }
+    return pid;
+}
+
+/**
+ * @brief   give one process to the sink
+ *
+ * @param s         pointer for sampling run
+ * @param pid       process no.
+ * @param arrival   arrival (nanosecond)
+ * @param run       run time (nanosecond)
+ * @param prio      priority
+ */
+static void emit(Sampler *s, int pid, long long arrival, long long run, int prio) {
+
+    Process p;
+    Time burst = (run + s->opt.unit / 2) / s->opt.unit;
+
+    init_process(&p, pid, (arrival - s->base) / s->opt.unit, burst > 0 ? burst : 1, prio);
+    s->sink(s->data, &p);
+    s->stats->processes++;
+}
+
+// finish the CPU burst of the task
+static void close_burst(Sampler *s, SampleTask *t) {
+
+    if(t->burst > 0) {
+        if(!s->opt.perTask)
+            emit(s, s->burstNo++, t->arrival, t->burst, t->prio);
+        else {
+            if(t->first < 0)
+                t->first = t->arrival;
+            t->total += t->burst;
+        }
+    }
+    t->open  = false;
+    t->burst = 0;
+}
+
+// close the files kept open for the task
+static void close_files(Sampler *s, SampleTask *t) {
+
+    for(int i = 0; i < 2; i++)
+        if(t->fd[i] >= 0) {
+            close(t->fd[i]);
+            t->fd[i] = -1;
+            s->files--;
+        }
+}
+
+// task exited: the CPU burst ends with the run time seen so far
+static void task_gone(Sampler *s, SampleTask *t) {
+
+    if(t->open)
+        close_burst(s, t);
+    close_files(s, t);
+    t->alive = false;
+}
+
+/**
+ * @brief   read `schedstat` or `stat` of the task into the file read buffer
+ *
+ * @param s     pointer for sampling run
+ * @param t     pointer for task state
+ * @param which FILE_SCHEDSTAT or FILE_STAT
+ * @return  bool (false if the task is gone)
+ */
+static bool read_task(Sampler *s, SampleTask *t, int which) {
+
+    ssize_t r;
+
+    if(t->fd[which] >= 0)
+        r = pread(t->fd[which], s->buffer, FILE_BUFFER - 1, 0);
+    else {
+        char path[64];
+        snprintf(path, sizeof(path), "%d/task/%d/%s", t->tgid, t->tid, which == FILE_STAT ? "stat" : "schedstat");
+        int fd = openat(s->proc, path, O_RDONLY | O_CLOEXEC);
+        if(fd < 0)
+            return false;
+        r = read(fd, s->buffer, FILE_BUFFER - 1);
+        // keep the file open for the next samples while under the limit
+        if(s->files < s->opt.files) {
+            t->fd[which] = fd;
+            s->files++;
+        }
+        else
+            close(fd);
+    }
+    s->stats->reads++;
+
+    if(r <= 0)
+        return false;
+    s->buffer[r] = '\0';
+    return true;
+}
+
+/**
+ * @brief   sample one task: state, priority and run time growth since the last sample
+ *
+ * @param s     pointer for sampling run
+ * @param tgid  process PID
+ * @param tid   task TID
+ */
+static void sample_task(Sampler *s, int tgid, int tid) {
+
+    bool added = false;
+    int slot   = pidmap_insert(&s->index, tid, &added);
+
+    if(slot >= s->capacity) {
+        s->capacity = s->capacity ? s->capacity * 2 : 1024;
+        s->task     = realloc(s->task, sizeof(SampleTask) * s->capacity);
+    }
+    SampleTask *t = &s->task[slot];
+    if(added)
+        *t = (SampleTask) { .tid = tid, .fd = { -1, -1 }, .first = -1 };
+    if(t->alive && t->tgid != tgid)
+        task_gone(s, t);
+    t->tgid = tgid;
+    t->seen = s->stats->samples;
+
+    // stat: `pid (comm) state ...`, field 18 is priority (nice + 20), field 22 is start time
+    if(!read_task(s, t, FILE_STAT)) {
+        if(t->alive)
+            task_gone(s, t);
+        return;
+    }
+    const char *c = strrchr(s->buffer, ')');
+    if(c == NULL || c[1] != ' ')
+        return;
+    char state = c[2];
+    long long prio = 20;
+    unsigned long long born = 0;
+    c += 2;
+    for(int field = 3; field <= 22 && c != NULL; field++) {
+        if(field == 18)
+            prio = strtoll(c, NULL, 10);
+        else if(field == 22)
+            born = strtoull(c, NULL, 10);
+        c = strchr(c, ' ');
+        if(c != NULL)
+            c++;
+    }
+
+    // schedstat: `<run ns> <wait ns> <time slices>`
+    if(!read_task(s, t, FILE_SCHEDSTAT)) {
+        if(t->alive)
+            task_gone(s, t);
+        return;
+    }
+    char *end;
+    long long run  = strtoll(s->buffer, &end, 10);
+    long long wait = strtoll(end, NULL, 10);
+
+    // new task (or TID reused): CPU time before the first sample is not counted
+    if(!t->alive || t->born != born) {
+        if(t->alive)
+            task_gone(s, t);
+        bool before = s->stats->samples == 0;
+        t->alive = true;
+        t->born  = born;
+        t->run   = before ? run : 0;
+        t->wait  = before ? wait : 0;
+        s->stats->tasks++;
+    }
+    t->prio = (int) prio + 100;
+
+    long long dRun  = run - t->run;
+    long long dWait = wait - t->wait;
+    t->run  = run;
+    t->wait = wait;
+    if(s->stats->samples == 0)
+        return;
+
+    // run time growth or runnable: CPU burst arrived within the interval
+    if(!t->open && (dRun > 0 || state == 'R')) {
+        long long arrival = s->now - dRun - dWait;
+        t->open    = true;
+        t->arrival = arrival > s->prev ? arrival : s->prev;
+        t->burst   = 0;
+    }
+    if(t->open)
+        t->burst += dRun;
+
+    // sleeping (or stopped) task finished the CPU burst
+    if(t->open && state != 'R')
+        close_burst(s, t);
+}
+
+/**
+ * @brief   list the tasks of the process and sample each one
+ *
+ * @param s     pointer for sampling run
+ * @param tgid  process PID
+ */
+static void sample_process(Sampler *s, int tgid) {
+
+    char path[32];
+    snprintf(path, sizeof(path), "%d/task", tgid);
+    int fd = openat(s->proc, path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if(fd < 0)
+        return;
+
+    long len;
+    while((len = syscall(SYS_getdents64, fd, s->tasks, DIR_BUFFER)) > 0)
+        for(long off = 0; off < len; ) {
+            DirEntry *d = (DirEntry*) (s->tasks + off);
+            int tid     = dir_pid(d->name);
+            if(tid > 0)
+                sample_task(s, tgid, tid);
+            off += d->reclen;
+        }
+
+    close(fd);
+}
+
+// take one sample of every task (or the tasks of `opt.pid`)
+static void sample(Sampler *s) {
+
+    s->now = monotonic_ns();
+
+    if(s->opt.pid > 0)
+        sample_process(s, s->opt.pid);
+    else {
+        long len;
+        lseek(s->proc, 0, SEEK_SET);
+        while((len = syscall(SYS_getdents64, s->proc, s->dirs, DIR_BUFFER)) > 0)
+            for(long off = 0; off < len; ) {
+                DirEntry *d = (DirEntry*) (s->dirs + off);
+                int pid     = dir_pid(d->name);
+                if(pid > 0)
+                    sample_process(s, pid);
+                off += d->reclen;
+            }
+    }
+
+    // tasks not listed in this sample exited
+    for(int i = 0; i < s->index.count; i++)
+        if(s->task[i].alive && s->task[i].seen != s->stats->samples)
+            task_gone(s, &s->task[i]);
+
+    s->prev = s->now;
+    s->stats->samples++;
+}
+
+bool sample_proc(const SamplerOptions *opt, TraceSink sink, void *data, SamplerStats *stats, volatile sig_atomic_t *stop) {
+
+    SamplerStats dummy;
+    Sampler *s = calloc(1, sizeof(Sampler));
+    s->opt   = opt ? *opt : (SamplerOptions) { 0 };
+    s->sink  = sink;
+    s->data  = data;
+    s->stats = stats ? stats : &dummy;
+    *s->stats = (SamplerStats) { 0 };
+
+    // options with defaults
+    if(s->opt.interval <= 0)
+        s->opt.interval = SAMPLER_INTERVAL;
+    if(s->opt.unit <= 0)
+        s->opt.unit = TRACE_UNIT;
+    if(s->opt.files <= 0)
+        s->opt.files = SAMPLER_FILES;
+
+    s->proc = open("/proc", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if(s->proc < 0) {
+        fprintf(stderr, "WARNING: SAMPLER: failed to open /proc\n");
+        free(s);
+        return false;
+    }
+    pidmap_init(&s->index, 1024);
+
+    long long interval = s->opt.interval * 1000;
+    long long next     = monotonic_ns();
+    s->base = s->prev = next;
+
+    while(true) {
+        sample(s);
+        if(stop != NULL && *stop)
+            break;
+        if(s->opt.duration > 0 && s->now - s->base >= s->opt.duration * 1000)
+            break;
+
+        // next interval, intervals already passed are skipped
+        next += interval;
+        long long now = monotonic_ns();
+        for(; next <= now; next += interval)
+            s->stats->overruns++;
+
+        struct timespec ts = { .tv_sec = next / 1000000000LL, .tv_nsec = next % 1000000000LL };
+        while(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+            if(stop != NULL && *stop)
+                break;
+    }
+
+    // end of sampling: CPU bursts in progress end with the run time seen so far
+    for(int i = 0; i < s->index.count; i++) {
+        SampleTask *t = &s->task[i];
+        if(t->open)
+            close_burst(s, t);
+        close_files(s, t);
+        if(s->opt.perTask && t->total > 0)
+            emit(s, t->tid, t->first, t->total, t->prio);
+    }
+
+    // memory allocate disable
+    close(s->proc);
+    free(s->task);
+    pidmap_free(&s->index);
+    free(s);
+
+    return true;
+}
+
+#else
+
+bool sample_proc(const SamplerOptions *opt, TraceSink sink, void *data, SamplerStats *stats, volatile sig_atomic_t *stop) {
+
+    (void) opt, (void) sink, (void) data, (void) stats, (void) stop;
+    fprintf(stderr, "WARNING: SAMPLER: /proc sampling is only supported on Linux\n");
+    return false;
+}
+
+#endif
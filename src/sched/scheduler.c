@@ -0,0 +1,85 @@
+/**
+ * @file    scheduler.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   CPU scheduling algorithm package (libcpusched)
+ *          - run algorithm by index of `algoName` array
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// standard library
+#include <stdio.h>
+#include <string.h>
+
+// user define library
+#include "process.h"
+#include "scheduler.h"
+
+// algorithm name string array
+const char *algoName[ALGO_COUNT] = {
+    "FCFS", "SJF", "HRN", "NPP", "PP", "RR", "SRT"
+};
+
+// built-in scheduling policy array (same order as `algoName`)
+const Policy *builtinPolicy[ALGO_COUNT] = {
+    &policyFCFS, &policySJF, &policyHRN, &policyNPP, &policyPP, &policyRR, &policySRT
+};
+
+int find_algorithm(const char *algo) {
+
+    for(int i = 0; i < ALGO_COUNT; i++)
+        if(strcmp(algoName[i], algo) == 0)
+            return i;
+    return -1;
+}
+
+bool run_algorithm(int algo, Process *p, int n, Time t, Schedule *s) {
+
+    // enforce algorithms that fit `algo` variable
+    switch(algo) {
+    case 0:
+        // First Come First Served
+        FCFS(p, n, t, s);
+        break;
+
+    case 1:
+        // Shortest Job First
+        SJF(p, n, t, s);
+        break;
+
+    case 2:
+        // Highest Responese Ratio Next
+        HRN(p, n, t, s);
+        break;
+
+    case 3:
+        // Non-Preemption Prioity
+        NPP(p, n, t, s);
+        break;
+
+    case 4:
+        // Preemption Prioity
+        PP(p, n, t, s);
+        break;
+
+    case 5:
+        // Round-Robin
+        RR(p, n, t, QAUNTUM, s);
+        break;
+
+    case 6:
+        // Shortest Remaining Time
+        SRT(p, n, t, s);
+        break;
+
+    default:
+        // if system can't get `algo` answer
+        fprintf(stderr, "WARNING: unknown variable `algo`\n");
+        return false;
+    }
+
+    return true;
+}
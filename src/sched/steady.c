@@ -0,0 +1,246 @@
+/**
+ * @file    steady.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   steady-state estimation of libcpusched open-system runs
+ *          - MSER: truncation point `d` minimizing the variance of the mean of the rest,
+ *            Σ(Z - mean)² / (k - d)² over stored batch means Z, `d` up to half of the run
+ *          - suffix sums give every `d` in one pass over the stored means
+ *          - t quantile: inverse normal (Acklam) and Cornish-Fisher expansion, exact for df 1 and 2
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// standard library
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// user define library
+#include "steady.h"
+
+/**
+ * @brief steady.c variable info
+ *
+ *  type            name        pointer     info
+ *  SteadyRun       run         y           state of `run_steady()` passed to the stream callbacks
+ *  double          s1          n           suffix sum of the stored means (MSER)
+ *  double          s2          n           suffix sum of the squared stored means (MSER)
+ *  long long       next        n           observation count of the next check
+ *
+ */
+
+/**
+ * @brief structure for state of `run_steady()`
+ *
+ */
+typedef struct SteadyRun {
+
+    SteadyState ss;             // observations
+    SteadyEstimate est;         // last estimate
+    const SteadyOptions *opt;   // stopping rule and streaming options of the caller
+    long long next;             // observation count of the next check
+    bool reached;               // target precision reached
+
+} SteadyRun;
+
+bool steady_init(SteadyState *ss) {
+
+    *ss = (SteadyState) { .mean = malloc(sizeof(double) * STEADY_KEPT), .size = STEADY_BATCH };
+    return ss->mean != NULL;
+}
+
+void steady_add(SteadyState *ss, double x) {
+
+    ss->total++;
+    ss->sum += x;
+    if(++ss->pending < ss->size)
+        return;
+
+    ss->mean[ss->count++] = ss->sum / ss->size;
+    ss->sum     = 0;
+    ss->pending = 0;
+
+    // fixed memory: merge neighbours, batch size doubles
+    if(ss->count == STEADY_KEPT) {
+        for(int i = 0; i < STEADY_KEPT / 2; i++)
+            ss->mean[i] = (ss->mean[2 * i] + ss->mean[2 * i + 1]) / 2;
+        ss->count /= 2;
+        ss->size  *= 2;
+    }
+}
+
+void steady_free(SteadyState *ss) {
+
+    free(ss->mean);
+    *ss = (SteadyState) { 0 };
+}
+
+/**
+ * @brief   quantile of standard normal distribution (Acklam, relative error under 1.2e-9)
+ *
+ * @param p probability (0.0 < p < 1.0)
+ * @return  double
+ */
+static double normal_quantile(double p) {
+
+    static const double a[] = { -3.969683028665376e+01, 2.209460984245205e+02, -2.759285104469687e+02,
+                                 1.383577518672690e+02, -3.066479806614716e+01, 2.506628277459239e+00 };
+    static const double b[] = { -5.447609879822406e+01, 1.615858368580409e+02, -1.556989798598866e+02,
+                                 6.680131188771972e+01, -1.328068155288572e+01 };
+    static const double c[] = { -7.784894002430293e-03, -3.223964580411365e-01, -2.400758277161838e+00,
+                                -2.549732539343734e+00, 4.374664141464968e+00, 2.938163982698783e+00 };
+    static const double d[] = { 7.784695709041462e-03, 3.224671290700398e-01, 2.445134137142996e+00,
+                                3.754408661907416e+00 };
+    const double low = 0.02425;
+
+    if(p < low || p > 1 - low) {
+        double q = sqrt(-2 * log(p < low ? p : 1 - p));
+        double x = (((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5])
+                 / ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1);
+        return p < low ? x : -x;
+    }
+
+    double q = p - 0.5, r = q * q;
+    return (((((a[0] * r + a[1]) * r + a[2]) * r + a[3]) * r + a[4]) * r + a[5]) * q
+         / (((((b[0] * r + b[1]) * r + b[2]) * r + b[3]) * r + b[4]) * r + 1);
+}
+
+double t_quantile(int df, double confidence) {
+
+    double p = 1 - (1 - confidence) / 2;
+
+    if(df < 1)
+        return INFINITY;
+    if(df == 1)
+        return tan(M_PI * (p - 0.5));
+    if(df == 2)
+        return (2 * p - 1) / sqrt(2 * p * (1 - p));
+
+    // Cornish-Fisher expansion around the normal quantile
+    double z = normal_quantile(p), z2 = z * z, v = df;
+    double g1 = (z2 + 1) * z / 4;
+    double g2 = ((5 * z2 + 16) * z2 + 3) * z / 96;
+    double g3 = (((3 * z2 + 19) * z2 + 17) * z2 - 15) * z / 384;
+    double g4 = ((((79 * z2 + 776) * z2 + 1482) * z2 - 1920) * z2 - 945) * z / 92160;
+    return z + g1 / v + g2 / (v * v) + g3 / (v * v * v) + g4 / (v * v * v * v);
+}
+
+bool steady_estimate(const SteadyState *ss, double confidence, SteadyEstimate *est) {
+
+    int k = ss->count;
+
+    *est = (SteadyEstimate) { .observations = ss->total, .confidence = confidence };
+    if(k < 2 * STEADY_BATCHES)
+        return false;
+
+    // MSER: every truncation point from the end, suffix sums of the stored means
+    double s1 = 0, s2 = 0, best = INFINITY;
+    int cut = 0;
+    for(int d = k - 1; d >= 0; d--) {
+        s1 += ss->mean[d];
+        s2 += ss->mean[d] * ss->mean[d];
+        if(d > k / 2)
+            continue;
+        double m   = k - d;
+        double var = s2 / m - (s1 / m) * (s1 / m);
+        double mser = (var > 0 ? var : 0) / m;
+        if(mser <= best) {
+            best = mser;
+            cut  = d;
+        }
+    }
+
+    // batches of the same size after the warm-up, the remainder is dropped from the front
+    int group = (k - cut) / STEADY_BATCHES;
+    cut = k - group * STEADY_BATCHES;
+
+    double y[STEADY_BATCHES], sum = 0, dev = 0;
+    for(int j = 0; j < STEADY_BATCHES; j++) {
+        y[j] = 0;
+        for(int i = 0; i < group; i++)
+            y[j] += ss->mean[cut + j * group + i];
+        y[j] /= group;
+        sum  += y[j];
+    }
+    est->mean = sum / STEADY_BATCHES;
+    for(int j = 0; j < STEADY_BATCHES; j++)
+        dev += (y[j] - est->mean) * (y[j] - est->mean);
+
+    est->valid     = true;
+    est->truncated = (long long) cut * ss->size;
+    est->batchSize = (long long) group * ss->size;
+    est->halfWidth = t_quantile(STEADY_BATCHES - 1, confidence) * sqrt(dev / (STEADY_BATCHES - 1) / STEADY_BATCHES);
+
+    return true;
+}
+
+// each termination: observation, then the callback of the caller
+static void steady_complete(void *data, const Process *p, Time completion) {
+
+    SteadyRun *run = data;
+    Time turnaround = completion - p->arrival;
+
+    steady_add(&run->ss, (double) (run->opt->metric == STEADY_WAITING ? turnaround - p->burst : turnaround));
+    if(run->opt->stream.on_complete)
+        run->opt->stream.on_complete(run->opt->stream.data, p, completion);
+}
+
+// stopping rule: check the estimate each time the observations grow by 10%
+static bool steady_stop(void *data, Time time) {
+
+    SteadyRun *run = data;
+    const SteadyOptions *opt = run->opt;
+
+    if(opt->stream.should_stop && opt->stream.should_stop(opt->stream.data, time))
+        return true;
+    if(run->ss.total < run->next)
+        return false;
+
+    run->next = run->ss.total + run->ss.total / 10;
+    if(steady_estimate(&run->ss, opt->confidence > 0 ? opt->confidence : 0.95, &run->est)
+        && run->est.halfWidth <= (opt->precision > 0 ? opt->precision : 0.05) * fabs(run->est.mean))
+        run->reached = true;
+
+    return run->reached;
+}
+
+// each slice end: the callback of the caller
+static void steady_window(void *data, const StreamWindow *w) {
+
+    SteadyRun *run = data;
+    run->opt->stream.on_window(run->opt->stream.data, w);
+}
+
+bool run_steady(const Policy *pol, ArrivalSource src, void *srcData, const SteadyOptions *opt, StreamStats *st, SteadyEstimate *est) {
+
+    SteadyRun run = { .opt = opt, .next = opt->minimum > 0 ? opt->minimum : STEADY_MINIMUM };
+    StreamOptions so = opt->stream;
+
+    so.data        = &run;
+    so.on_complete = steady_complete;
+    so.should_stop = steady_stop;
+    so.on_window   = opt->stream.on_window ? steady_window : NULL;
+
+    if(!steady_init(&run.ss)) {
+        fprintf(stderr, "WARNING: STEADY: not enough memory for the observations\n");
+        memset(st, 0, sizeof(*st));
+        memset(est, 0, sizeof(*est));
+        st->failed = true;
+        return false;
+    }
+    run_stream(pol, src, srcData, &so, st);
+
+    // the estimate of every observation at the end (stream or time limit ended the run)
+    if(!run.reached)
+        steady_estimate(&run.ss, opt->confidence > 0 ? opt->confidence : 0.95, &run.est);
+    *est = run.est;
+
+    // memory allocate disable
+    steady_free(&run.ss);
+
+    return run.reached;
+}
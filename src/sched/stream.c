@@ -0,0 +1,527 @@
+/**
+ * @file    stream.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   open-system streaming simulation of libcpusched
+ *          - the ready queue of the engine (`engine.h`) over process slots: a terminated process
+ *            gives its slot back to the free list, the slot arrays grow only with the live set
+ *          - one arrival is read ahead: idle CPU jumps to it, the stream ends when it is none
+ *          - the sliding window is a ring of `STREAM_SLICES` slices, each with its own histogram
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// standard library
+#include <limits.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// user define library
+#include "engine.h"
+#include "stream.h"
+#include "workload.h"
+
+/**
+ * @brief stream.c variable info
+ *
+ *  type        name        pointer     info
+ *  #define     SEQ_LIMIT   n           enqueue order is renumbered from 0 past this value
+ *  Slice       slice       y           one slice of the sliding window
+ *  Window      w           y           sliding window (ring of slices)
+ *  Slots       s           y           process slots of the live set and the ready queue over them
+ *  Process     ahead       n           next arrival of the stream (read ahead)
+ *  int         cur         n           slot of the running process (-1 if none)
+ *
+ */
+
+#define SEQ_LIMIT   (1 << 30)   // enqueue order is renumbered from 0 past this value
+
+/**
+ * @brief structure for one slice of the sliding window
+ *
+ */
+typedef struct Slice {
+
+    long long arrived;      // arrivals in the slice
+    long long completed;    // terminations in the slice
+    Time busy;              // busy time units
+    Time turnaround;        // the sum of turnaround of the terminations
+    Histogram h;            // turnaround of the terminations
+
+} Slice;
+
+/**
+ * @brief structure for sliding window (ring of slices)
+ *
+ */
+typedef struct Window {
+
+    Slice slice[STREAM_SLICES]; // slices, `head` is the present one
+    Histogram merged;           // histogram of the whole window (report)
+    int head;                   // present slice
+    int filled;                 // slices since the start (up to `STREAM_SLICES`)
+    Time length;                // time units of a slice
+    Time end;                   // end time of the present slice
+
+} Window;
+
+/**
+ * @brief structure for process slots of the live set
+ *
+ */
+typedef struct Slots {
+
+    Ready r;                // ready queue, `r.proc` is the slot array
+    char *response;         // response time checked (slot)
+    int *free;              // free slot stack
+    int freeCount;          // free slot count
+    int capacity;           // slot count
+
+} Slots;
+
+// bucket of the value: exact under 2^HIST_SUB_BITS, then 2^HIST_SUB_BITS buckets for each power of 2
+static int hist_bucket(Time v) {
+
+    unsigned long long u = (unsigned long long) v;
+    if(u < (1ULL << HIST_SUB_BITS))
+        return (int) u;
+    int e = 63 - __builtin_clzll(u);
+    return ((e - HIST_SUB_BITS + 1) << HIST_SUB_BITS) + (int) ((u >> (e - HIST_SUB_BITS)) & ((1ULL << HIST_SUB_BITS) - 1));
+}
+
+// middle value of the bucket
+static Time hist_value(int b) {
+
+    if(b < (1 << HIST_SUB_BITS))
+        return b;
+    int e = (b >> HIST_SUB_BITS) + HIST_SUB_BITS - 1;
+    unsigned long long low = (1ULL << e) + ((unsigned long long) (b & ((1 << HIST_SUB_BITS) - 1)) << (e - HIST_SUB_BITS));
+    return (Time) (low + ((1ULL << (e - HIST_SUB_BITS)) >> 1));
+}
+
+void hist_add(Histogram *h, Time v) {
+
+    if(v < 0)
+        v = 0;
+    if(h->count == 0 || v < h->min)
+        h->min = v;
+    if(h->count == 0 || v > h->max)
+        h->max = v;
+    h->count++;
+    h->bucket[hist_bucket(v)]++;
+}
+
+void hist_merge(Histogram *h, const Histogram *from) {
+
+    if(from->count == 0)
+        return;
+    if(h->count == 0 || from->min < h->min)
+        h->min = from->min;
+    if(h->count == 0 || from->max > h->max)
+        h->max = from->max;
+    h->count += from->count;
+    for(int b = 0; b < HIST_BUCKETS; b++)
+        h->bucket[b] += from->bucket[b];
+}
+
+Time hist_percentile(const Histogram *h, double q) {
+
+    if(h->count == 0)
+        return 0;
+
+    // rank of the value (1 ~ count)
+    long long rank = (long long) ceil(q * h->count);
+    if(rank < 1)
+        rank = 1;
+    if(rank > h->count)
+        rank = h->count;
+
+    long long seen = 0;
+    for(int b = 0; b < HIST_BUCKETS; b++) {
+        if((seen += h->bucket[b]) >= rank) {
+            Time v = hist_value(b);
+            return v < h->min ? h->min : v > h->max ? h->max : v;
+        }
+    }
+    return h->max;
+}
+
+/**
+ * @brief   xorshift64* random number
+ *
+ * @param g pointer for arrival generator
+ * @return  double (0.0 < x <= 1.0)
+ */
+static double next_uniform(ArrivalGen *g) {
+
+    g->state ^= g->state >> 12;
+    g->state ^= g->state << 25;
+    g->state ^= g->state >> 27;
+    return (double) (((g->state * 2685821657736338717ULL) >> 11) + 1) * (1.0 / 9007199254740992.0);
+}
+
+// exponential random number of the mean
+static double next_exponential(ArrivalGen *g, double mean) { return -log(next_uniform(g)) * mean; }
+
+void init_generator(ArrivalGen *g, double rate, double meanBurst, double cv, int priorities, long long limit, unsigned long long seed) {
+
+    *g = (ArrivalGen) {
+        .rate       = rate,
+        .meanBurst  = meanBurst,
+        .cv         = cv > 0 ? cv : 0,
+        .priorities = priorities > 0 ? priorities : 1,
+        .limit      = limit,
+        .state      = seed * 0x9e3779b97f4a7c15ULL + 1
+    };
+}
+
+bool generator_source(void *data, Process *p) {
+
+    ArrivalGen *g = data;
+    if((g->limit > 0 && g->count >= g->limit) || g->rate <= 0)
+        return false;
+
+    // Poisson arrivals: exponential gap
+    g->clock += next_exponential(g, 1.0 / g->rate);
+
+    // burst: deterministic, Erlang (k phases), exponential, or balanced two-phase hyperexponential
+    double x, cv2 = g->cv * g->cv;
+    if(g->cv == 0)
+        x = g->meanBurst;
+    else if(cv2 < 1) {
+        int k = (int) (1.0 / cv2 + 0.5);
+        x = 0;
+        for(int i = 0; i < k; i++)
+            x += next_exponential(g, g->meanBurst / k);
+    }
+    else if(cv2 == 1)
+        x = next_exponential(g, g->meanBurst);
+    else {
+        double p1 = 0.5 * (1 + sqrt((cv2 - 1) / (cv2 + 1)));
+        x = next_uniform(g) <= p1 ? next_exponential(g, g->meanBurst / (2 * p1)) : next_exponential(g, g->meanBurst / (2 * (1 - p1)));
+    }
+    Time burst   = x < 1.5 ? 1 : (Time) llround(x);
+    int priority = 1 + (int) (next_uniform(g) * g->priorities - 1e-9);
+
+    init_process(p, (int) (g->count++ & 0x7fffffff), (Time) g->clock, burst, priority);
+    return true;
+}
+
+bool workload_source(void *data, Process *p) {
+
+    return read_process(data, p);
+}
+
+/**
+ * @brief   take a free slot, the slot arrays are doubled if there is none
+ *
+ * @param s pointer for process slots
+ * @return  int (slot, -1 if not enough memory)
+ */
+static int slot_alloc(Slots *s) {
+
+    if(s->freeCount == 0) {
+        if(s->capacity > INT_MAX / 2 - 1)
+            return -1;
+
+        // a failed array keeps its block: the slot count grows only if every array did
+        int capacity            = s->capacity ? s->capacity * 2 : 64;
+        Process *proc           = realloc(s->r.proc, sizeof(Process) * capacity);
+        ReadyItem *item         = realloc(s->r.item, sizeof(ReadyItem) * (capacity + 1));
+        char *response          = realloc(s->response, capacity);
+        int *freeSlot           = realloc(s->free, sizeof(int) * capacity);
+        const Process **handle  = s->r.handle ? realloc(s->r.handle, sizeof(Process*) * (capacity + 1)) : NULL;
+        bool grown              = proc && item && response && freeSlot && (handle || !s->r.handle);
+
+        if(proc)
+            s->r.proc = proc;
+        if(item)
+            s->r.item = item;
+        if(response)
+            s->response = response;
+        if(freeSlot)
+            s->free = freeSlot;
+        if(handle)
+            s->r.handle = handle;
+        if(s->r.handle) {
+            // handles point into the moved slot array
+            for(int i = 0; i < s->r.count; i++)
+                s->r.handle[i] = &s->r.proc[s->r.item[i].idx];
+        }
+        if(!grown)
+            return -1;
+
+        for(int i = capacity - 1; i >= s->capacity; i--)
+            s->free[s->freeCount++] = i;
+        s->capacity = capacity;
+    }
+
+    int slot = s->free[--s->freeCount];
+    s->response[slot] = 0;
+    return slot;
+}
+
+/**
+ * @brief   renumber enqueue order from 0 (same order), an unbounded stream overflows `int` otherwise
+ *
+ * @param r pointer for ready queue
+ */
+static void renumber_seq(Ready *r) {
+
+    int min = r->seq;
+    for(int i = 0; i < r->count; i++)
+        if(r->item[i].seq < min)
+            min = r->item[i].seq;
+    for(int i = 0; i < r->count; i++)
+        r->item[i].seq -= min;
+    r->seq -= min;
+}
+
+/**
+ * @brief   close the present slice, report the window and start the next slice
+ *
+ * @param w     pointer for sliding window
+ * @param opt   pointer for streaming options
+ * @param end   end time of the present slice (earlier than `w->end` for the last part)
+ * @param live  processes in the system
+ */
+static void close_slice(Window *w, const StreamOptions *opt, Time end, int live) {
+
+    if(w->filled < STREAM_SLICES)
+        w->filled++;
+
+    if(opt->on_window) {
+        StreamWindow sw = { .start = w->end - w->length * w->filled, .end = end, .live = live };
+        Time busy = 0, turnaround = 0;
+
+        w->merged.count = 0;
+        memset(w->merged.bucket, 0, sizeof(w->merged.bucket));
+        for(int i = 0; i < w->filled; i++) {
+            const Slice *sl = &w->slice[(w->head - i + STREAM_SLICES) % STREAM_SLICES];
+            sw.arrived   += sl->arrived;
+            sw.completed += sl->completed;
+            busy         += sl->busy;
+            turnaround   += sl->turnaround;
+            hist_merge(&w->merged, &sl->h);
+        }
+
+        sw.throughput     = (double) sw.completed / (sw.end - sw.start);
+        sw.utilization    = (double) busy / (sw.end - sw.start);
+        sw.avg_turnaround = sw.completed ? (double) turnaround / sw.completed : 0;
+        sw.p50            = hist_percentile(&w->merged, 0.50);
+        sw.p90            = hist_percentile(&w->merged, 0.90);
+        sw.p99            = hist_percentile(&w->merged, 0.99);
+        sw.max            = w->merged.count ? w->merged.max : 0;
+        opt->on_window(opt->data, &sw);
+    }
+
+    // the oldest slice becomes the present one
+    w->head = (w->head + 1) % STREAM_SLICES;
+    Slice *next = &w->slice[w->head];
+    next->arrived = next->completed = 0;
+    next->busy = next->turnaround = 0;
+    if(next->h.count) {
+        next->h.count = 0;
+        memset(next->h.bucket, 0, sizeof(next->h.bucket));
+    }
+    w->end += w->length;
+}
+
+/**
+ * @brief   next valid arrival of the stream (late arrival moved to the previous arrival)
+ *          an arrival or priority out of range of the priority key (`priority_key()`) ends the stream
+ *
+ * @param src       next arrival of the stream
+ * @param srcData   user data of the source
+ * @param p         pointer for process structure
+ * @param last      arrival of the previous process
+ * @param warned    a late arrival was reported
+ * @param failed    an arrival out of range ended the stream
+ * @return  bool (false at the end of the stream)
+ */
+static bool next_arrival(ArrivalSource src, void *srcData, Process *p, Time last, bool *warned, bool *failed) {
+
+    while(src(srcData, p)) {
+        if(p->burst <= 0)
+            continue;
+        if(p->arrival < last) {
+            if(!*warned)
+                fprintf(stderr, "WARNING: STREAM: arrival %lld of process %d is before the previous arrival, moved to %lld\n", p->arrival, p->processID, last);
+            *warned = true;
+            p->arrival = p->timeout = last;
+        }
+        if(p->arrival < 0 || p->arrival >= ARRIVAL_LIMIT || p->priority < -PRIORITY_LIMIT || p->priority >= PRIORITY_LIMIT) {
+            fprintf(stderr, "WARNING: STREAM: arrival %lld or priority %d of process %d is out of range, the stream ends\n", p->arrival, p->priority, p->processID);
+            *failed = true;
+            return false;
+        }
+        return true;
+    }
+    return false;
+}
+
+void run_stream(const Policy *pol, ArrivalSource src, void *srcData, const StreamOptions *opt, StreamStats *st) {
+
+    StreamOptions none = { 0 };
+    if(opt == NULL)
+        opt = &none;
+
+    Window *w = calloc(1, sizeof(Window));
+    Slots s   = { .r = { .handle = pol->pick_next ? malloc(sizeof(Process*)) : NULL } };
+    int q     = pol->quantum;
+    int cur   = -1;
+    Time time = 0;
+    Time until = opt->until > 0 ? opt->until : TIME_MAX;
+    bool warned = false;
+    Process ahead;
+
+    memset(st, 0, sizeof(*st));
+    if(w == NULL || (pol->pick_next && s.r.handle == NULL)) {
+        fprintf(stderr, "WARNING: STREAM: not enough memory to start the stream\n");
+        st->failed = true;
+        free(s.r.handle);
+        free(w);
+        return;
+    }
+    w->length = (opt->window > 0 ? opt->window : STREAM_WINDOW) / STREAM_SLICES;
+    if(w->length < 1)
+        w->length = 1;
+    w->end = w->length;
+
+    bool more = next_arrival(src, srcData, &ahead, 0, &warned, &st->failed);
+
+    while(time < until) {
+
+        // report every slice passed, a long idle gap skips the slices after the window is empty
+        while(time >= w->end) {
+            close_slice(w, opt, w->end, st->live);
+            if(cur < 0 && s.r.count == 0 && time >= w->end + w->length * STREAM_SLICES) {
+                for(int i = 0; i < STREAM_SLICES; i++)
+                    close_slice(w, opt, w->end, st->live);
+                w->end += (time - w->end) / w->length * w->length;
+            }
+        }
+
+        // every process arriving until this time unit enters the ready queue
+        while(more && ahead.arrival <= time) {
+            int slot = slot_alloc(&s);
+            if(slot < 0) {
+                fprintf(stderr, "WARNING: STREAM: not enough memory for %d processes in the system, the stream ends\n", st->live + 1);
+                st->failed = true;
+                more = false;
+                break;
+            }
+            s.r.proc[slot] = ahead;
+            ready_push(pol, &s.r, slot);
+            if(s.r.seq >= SEQ_LIMIT)
+                renumber_seq(&s.r);
+            w->slice[w->head].arrived++;
+            st->arrived++;
+            if(++st->live > st->peak)
+                st->peak = st->live;
+            more = next_arrival(src, srcData, &ahead, ahead.arrival, &warned, &st->failed);
+        }
+
+        // idle CPU: jump to the next arrival, or the stream is over
+        if(cur < 0 && s.r.count == 0) {
+            if(!more)
+                break;
+            time = ahead.arrival < until ? ahead.arrival : until;
+            continue;
+        }
+
+        // dispatch new PCB: if the previous task terminated
+        if(cur < 0) {
+            cur = ready_remove(pol, &s.r, ready_first(pol, &s.r, NULL, time));
+            s.r.proc[cur].waiting  = time - s.r.proc[cur].timeout;
+            st->total_waiting     += s.r.proc[cur].waiting;
+            s.r.proc[cur].execute  = 0;
+        }
+
+        // timeout & dispatch new PCB: preemption or time quantum expiration (same as `engine_step()`)
+        bool timeout = false;
+        int first    = 0;
+        if(pol->pick_next) {
+            if(s.r.changed && s.r.count > 0)
+                timeout = (first = ready_first(pol, &s.r, &s.r.proc[cur], time)) >= 0;
+        }
+        else if(pol->should_preempt && s.r.count > 0) {
+            first   = ready_first(pol, &s.r, &s.r.proc[cur], time);
+            timeout = pol->should_preempt(pol->data, &s.r.proc[s.r.item[first].idx], &s.r.proc[cur]);
+        }
+        if(!timeout && (pol->on_tick_expire ? pol->on_tick_expire(pol->data, &s.r.proc[cur], q)
+                                            : q > 0 && s.r.proc[cur].execute >= q)) {
+            timeout = true;
+            first   = -1;
+        }
+        if(timeout) {
+            s.r.proc[cur].timeout  = time;
+            st->total_turnaround  += s.r.proc[cur].execute + s.r.proc[cur].waiting;
+
+            int prev = cur;
+            if(first >= 0)
+                cur = ready_remove(pol, &s.r, first);
+            ready_push(pol, &s.r, prev);
+            if(first < 0)
+                cur = ready_remove(pol, &s.r, ready_first(pol, &s.r, NULL, time));
+
+            s.r.proc[cur].waiting  = time - s.r.proc[cur].timeout;
+            st->total_waiting     += s.r.proc[cur].waiting;
+            s.r.proc[cur].execute  = 0;
+        }
+
+        // check the response time of the process
+        if(s.response[cur] == 0) {
+            s.response[cur] = 1;
+            st->total_response += time - s.r.proc[cur].arrival;
+        }
+
+        // run one time unit
+        time++;
+        st->busy++;
+        w->slice[w->head].busy++;
+        s.r.proc[cur].remain--;
+        s.r.proc[cur].execute++;
+
+        // terminate present PCB: fold into the metrics, the slot is free again
+        if(s.r.proc[cur].remain == 0) {
+            Process *p      = &s.r.proc[cur];
+            Time turnaround = time - p->arrival;
+            Slice *sl       = &w->slice[w->head];
+
+            st->total_turnaround += p->execute + p->waiting;
+            st->completed++;
+            st->live--;
+            hist_add(&st->turnaround, turnaround);
+            sl->completed++;
+            sl->turnaround += turnaround;
+            hist_add(&sl->h, turnaround);
+            if(opt->on_complete)
+                opt->on_complete(opt->data, p, time);
+
+            s.free[s.freeCount++] = cur;
+            cur = -1;
+
+            // stopping rule of the caller (e.g. confidence interval reached)
+            if(opt->should_stop && opt->should_stop(opt->data, time))
+                break;
+        }
+    }
+
+    // report the last part of the present slice
+    if(time > w->end - w->length)
+        close_slice(w, opt, time, st->live);
+    st->time = time;
+
+    // memory allocate disable
+    free(s.r.proc);
+    free(s.r.item);
+    free(s.r.handle);
+    free(s.response);
+    free(s.free);
+    free(w);
+}
@@ -0,0 +1,294 @@
+/**
+ * @file    sweep.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   load sweep of libcpusched: latency versus utilization of every policy
+ *          - a run is one task of the worker threads (`pool.h`), tasks in order of expected cost
+ *          - a run keeps waiting and burst of each termination, the warm-up is cut by MSER-5
+ *            on the turnaround (`steady.h`), p99 by selection (no sort of the whole run)
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// standard library
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// user define library
+#include "analytic.h"
+#include "pool.h"
+#include "scheduler.h"
+#include "steady.h"
+#include "stream.h"
+#include "sweep.h"
+
+/**
+ * @brief sweep.c variable info
+ *
+ *  type            name        pointer     info
+ *  Record          rec         y           waiting and burst of each termination of a run
+ *  SweepTask       task        y           run index and expected cost of each task (heaviest first)
+ *  SweepRun        run         y           runs of the sweep and their order
+ *
+ */
+
+/**
+ * @brief structure for waiting and burst of each termination of a run
+ *
+ */
+typedef struct Record {
+
+    double *waiting;    // waiting in termination order
+    double *burst;      // burst in termination order
+    long long count;    // termination count
+    long long limit;    // terminations to collect
+
+} Record;
+
+/**
+ * @brief structure for run index and expected cost of each task
+ *
+ */
+typedef struct SweepTask {
+
+    double cost;        // expected cost of the run
+    int index;          // run index (`pt` array)
+    bool failed;        // not enough memory or the stream ended early
+
+} SweepTask;
+
+/**
+ * @brief structure for runs of the sweep and their order
+ *
+ */
+typedef struct SweepRun {
+
+    const Policy *const *pol;   // policy array
+    const SweepOptions *opt;    // options
+    SweepPoint *pt;             // result array
+    int points;                 // load count
+    long long count;            // terminations of a run at load 0
+    double mean;                // mean burst (rounded distribution)
+    SweepTask *task;            // tasks in order of expected cost
+
+} SweepRun;
+
+// each termination: waiting and burst into the buffers
+static void record_add(void *data, const Process *p, Time completion) {
+
+    Record *rec = data;
+    if(rec->count < rec->limit) {
+        rec->waiting[rec->count] = (double) (completion - p->arrival - p->burst);
+        rec->burst[rec->count++] = (double) p->burst;
+    }
+}
+
+// stop once the buffers are full
+static bool record_full(void *data, Time time) {
+
+    (void) time;
+    return ((Record*) data)->count >= ((Record*) data)->limit;
+}
+
+/**
+ * @brief   k-th smallest value (the array is reordered)
+ *
+ * @param v pointer for values
+ * @param n value count
+ * @param k rank (0 ~ n - 1)
+ * @return  double
+ */
+static double select_rank(double *v, long long n, long long k) {
+
+    long long lo = 0, hi = n - 1;
+
+    while(lo < hi) {
+        // median of three as pivot
+        double a = v[lo], b = v[lo + (hi - lo) / 2], c = v[hi];
+        double pivot = a < b ? (b < c ? b : a < c ? c : a) : (a < c ? a : b < c ? c : b);
+        long long i = lo, j = hi;
+        while(i <= j) {
+            while(v[i] < pivot) i++;
+            while(v[j] > pivot) j--;
+            if(i <= j) {
+                double t = v[i];
+                v[i++] = v[j];
+                v[j--] = t;
+            }
+        }
+        if(k <= j)
+            hi = j;
+        else if(k >= i)
+            lo = i;
+        else
+            break;
+    }
+
+    return v[k];
+}
+
+// terminations of a run at the load
+static long long run_length(const SweepRun *run, double load) {
+
+    double n = run->count / (1 - load);
+    return n < (double) run->count * SWEEP_SCALE ? (long long) n : run->count * SWEEP_SCALE;
+}
+
+// heavier run first
+static int compare_cost(const void *a, const void *b) {
+
+    const SweepTask *x = a, *y = b;
+    return x->cost > y->cost ? -1 : x->cost < y->cost ? 1 : x->index - y->index;
+}
+
+/**
+ * @brief   one run of the sweep: simulation, warm-up cut, means and p99
+ *
+ * @param data  pointer for runs of the sweep (`SweepRun`)
+ * @param task  task index
+ */
+static void sweep_task(void *data, int task) {
+
+    SweepRun *run = data;
+    int index = run->task[task].index;
+    SweepPoint *pt = &run->pt[index];
+    const SweepOptions *opt = run->opt;
+
+    long long limit = run_length(run, pt->load);
+    Record rec = {
+        .waiting = malloc(sizeof(double) * limit),
+        .burst   = malloc(sizeof(double) * limit),
+        .limit   = limit
+    };
+    double *scratch = malloc(sizeof(double) * limit);
+    StreamStats *st = malloc(sizeof(StreamStats));
+    StreamOptions so = { .data = &rec, .on_complete = record_add, .should_stop = record_full };
+    ArrivalGen gen;
+    SteadyState ss = { 0 };
+    SteadyEstimate est;
+    struct timespec start, end;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    bool failed = rec.waiting == NULL || rec.burst == NULL || scratch == NULL || st == NULL || !steady_init(&ss);
+    if(!failed) {
+        init_generator(&gen, pt->rate, opt->meanBurst, opt->cv, opt->priorities, 0, opt->seed);
+        run_stream(run->pol[index / run->points], generator_source, &gen, &so, st);
+        failed = st->failed;
+    }
+    run->task[task].failed = failed;
+    if(failed) {
+        steady_free(&ss);
+        free(rec.waiting);
+        free(rec.burst);
+        free(scratch);
+        free(st);
+        return;
+    }
+
+    // warm-up: MSER-5 on the turnaround in termination order
+    for(long long k = 0; k < rec.count; k++)
+        steady_add(&ss, rec.waiting[k] + rec.burst[k]);
+    long long cut = steady_estimate(&ss, 0.95, &est) ? est.truncated : 0;
+    steady_free(&ss);
+
+    double *w = rec.waiting + cut, *b = rec.burst + cut;
+    long long n = rec.count - cut;
+    pt->truncated    = cut;
+    pt->observations = n;
+    if(n > 0) {
+        double sum[SWEEP_METRICS] = { 0 };
+        long long rank = (long long) ceil(0.99 * n) - 1;
+        for(long long k = 0; k < n; k++) {
+            sum[SWEEP_WAITING]    += w[k];
+            sum[SWEEP_TURNAROUND] += w[k] + b[k];
+            sum[SWEEP_SLOWDOWN]   += (w[k] + b[k]) / b[k];
+        }
+        for(int m = 0; m < SWEEP_METRICS; m++)
+            pt->mean[m] = sum[m] / n;
+
+        // the waiting is reordered by its selection: turnaround and slowdown first
+        for(long long k = 0; k < n; k++)
+            scratch[k] = w[k] + b[k];
+        pt->p99[SWEEP_TURNAROUND] = select_rank(scratch, n, rank);
+        for(long long k = 0; k < n; k++)
+            scratch[k] = (w[k] + b[k]) / b[k];
+        pt->p99[SWEEP_SLOWDOWN] = select_rank(scratch, n, rank);
+        pt->p99[SWEEP_WAITING]  = select_rank(w, n, rank);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    pt->seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) * 1e-9;
+
+    // memory allocate disable
+    free(rec.waiting);
+    free(rec.burst);
+    free(scratch);
+    free(st);
+}
+
+double sweep_load(const SweepOptions *opt, int i) {
+
+    double low  = opt->low > 0 ? opt->low : 0.10;
+    double high = opt->high > 0 ? opt->high : 0.99;
+    int points  = opt->points > 0 ? opt->points : SWEEP_POINTS;
+
+    if(points == 1)
+        return low;
+    return 1 - (1 - low) * pow((1 - high) / (1 - low), (double) i / (points - 1));
+}
+
+bool run_sweep(const Policy *const *pol, int count, const SweepOptions *opt, SweepPoint *pt) {
+
+    double low  = opt->low > 0 ? opt->low : 0.10;
+    double high = opt->high > 0 ? opt->high : 0.99;
+    if(count < 1 || opt->meanBurst < 1 || low >= 1 || high >= 1 || low > high)
+        return false;
+
+    // mean of the rounded burst distribution: rate of each load
+    ArrivalGen spec;
+    AnalyticResult ar;
+    init_generator(&spec, 1, opt->meanBurst, opt->cv, opt->priorities, 0, opt->seed);
+    analytic_estimate(find_algorithm("FCFS"), &spec, &ar);
+
+    SweepRun run = {
+        .pol    = pol,
+        .opt    = opt,
+        .pt     = pt,
+        .points = opt->points > 0 ? opt->points : SWEEP_POINTS,
+        .count  = opt->count > 0 ? opt->count : SWEEP_COUNT,
+        .mean   = ar.mean_burst > 0 ? ar.mean_burst : opt->meanBurst
+    };
+    int runs  = count * run.points;
+    run.task  = malloc(sizeof(SweepTask) * runs);
+    if(run.task == NULL) {
+        fprintf(stderr, "WARNING: SWEEP: not enough memory for %d runs\n", runs);
+        return false;
+    }
+
+    // expected cost: terminations * log of the mean queue length (ready queue operations)
+    for(int k = 0; k < runs; k++) {
+        double load = sweep_load(opt, k % run.points);
+        pt[k]       = (SweepPoint) { .load = load, .rate = load / run.mean };
+        run.task[k] = (SweepTask) { run_length(&run, load) * log2(2 + load / (1 - load)), k, false };
+    }
+    qsort(run.task, runs, sizeof(SweepTask), compare_cost);
+
+    run_pool(sweep_task, &run, runs, opt->jobs);
+
+    bool failed = false;
+    for(int k = 0; k < runs; k++) {
+        if(run.task[k].failed) {
+            int index = run.task[k].index;
+            fprintf(stderr, "WARNING: SWEEP: [%s] run at load %.4f failed\n", pol[index / run.points]->name, pt[index].load);
+            failed = true;
+        }
+    }
+
+    // memory allocate disable
+    free(run.task);
+
+    return !failed;
+}
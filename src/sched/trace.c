@@ -0,0 +1,696 @@
+/**
+ * @file    trace.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   Linux scheduler trace to workload (perf sched script, ftrace sched_switch/sched_wakeup)
+ *          - read: one window of the trace, cut at the last complete line
+ *          - parse: window is split into chunks at line boundaries, one thread for each chunk,
+ *            every line of interest becomes a small `TraceEvent`
+ *          - apply: events of the chunks are applied in file order to the task states,
+ *            finished CPU bursts are given to the sink right away
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// standard library
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef __EMSCRIPTEN__
+    #include <pthread.h>
+    #include <unistd.h>
+#endif
+
+// user define library
+#include "pidmap.h"
+#include "process.h"
+#include "radix.h"
+#include "trace.h"
+#include "workload.h"
+
+/**
+ * @brief trace.c variable info
+ *
+ *  type        name        pointer     info
+ *  TraceEvent  event       y           parsed sched_switch or sched_wakeup event
+ *  TraceChunk  chunk       y           part of the window parsed by one thread
+ *  TaskState   task        y           state of each task (index: dense slot of `index`)
+ *  Trace       tr          y           state of one trace conversion
+ *  char        line        y           one line of the trace (NUL terminated in the window)
+ *  long long   ts          n           timestamp of the event (nanosecond)
+ *
+ */
+
+enum { EVENT_WAKEUP = 1, EVENT_SWITCH = 2 };
+
+/**
+ * @brief structure for parsed event
+ *
+ */
+typedef struct TraceEvent {
+
+    long long ts;       // timestamp (nanosecond)
+    int type;           // EVENT_WAKEUP or EVENT_SWITCH
+    int pid;            // woken task, or previous task of the switch
+    int prio;           // priority of `pid`
+    int next;           // next task of the switch
+    int nextPrio;       // priority of `next`
+    int runnable;       // previous task is still runnable (preempted, `R` or `R+`)
+
+} TraceEvent;
+
+/**
+ * @brief structure for part of the window parsed by one thread
+ *
+ */
+typedef struct TraceChunk {
+
+    char *begin, *end;      // chunk range in the window
+    TraceEvent *event;      // parsed events (reused for every window)
+    size_t count;           // parsed event count
+    size_t capacity;        // event array capacity
+    long long lines;        // lines in the chunk
+    long long skipped;      // sched lines not understood
+    bool failed;            // not enough memory for the events
+
+} TraceChunk;
+
+/**
+ * @brief structure for state of each task
+ *
+ */
+typedef struct TaskState {
+
+    int pid;            // task PID
+    int prio;           // latest priority
+    bool open;          // CPU burst in progress (woken or runnable)
+    bool running;       // on a CPU now
+    long long arrival;  // start of the present CPU burst (nanosecond)
+    long long run;      // run time of the present CPU burst (nanosecond)
+    long long start;    // last switch in (nanosecond)
+    long long first;    // start of the first CPU burst (task mode)
+    long long total;    // run time of every CPU burst (task mode)
+
+} TaskState;
+
+/**
+ * @brief structure for state of one trace conversion
+ *
+ */
+typedef struct Trace {
+
+    const char *fileName;   // trace file path
+    TraceOptions opt;   // options with defaults applied
+    TraceSink sink;     // function called for each process
+    void *data;         // user data passed to `sink`
+    TraceStats *stats;  // statistics
+    PidMap index;       // task PID to dense slot
+    TaskState *task;    // state of each task
+    int capacity;       // task array capacity
+    bool based;         // `base` is set
+    long long base;     // timestamp of the first event
+    long long last;     // timestamp of the latest event
+    long long burst;    // next CPU burst no. (process no. up to INT_MAX)
+    bool failed;        // not enough memory or too many CPU bursts (conversion stopped)
+
+} Trace;
+
+/**
+ * @brief   find `key=` at the start of a word
+ *
+ * @param s     string to be searched
+ * @param key   key with `=` (e.g. "prev_pid=")
+ * @return  const char* (value, NULL if not found)
+ */
+static const char* find_key(const char *s, const char *key) {
+
+    size_t len = strlen(key);
+    for(const char *c = strstr(s, key); c != NULL; c = strstr(c + 1, key))
+        if(c == s || c[-1] == ' ')
+            return c + len;
+
+    return NULL;
+}
+
+/**
+ * @brief   parse `<sec>.<fraction>:` right before the event name
+ *
+ * @param line  start of the line
+ * @param name  start of the event name word (e.g. "sched:sched_switch:")
+ * @param ts    pointer for timestamp (nanosecond)
+ * @return  bool (false if no timestamp)
+ */
+static bool parse_timestamp(const char *line, const char *name, long long *ts) {
+
+    const char *end = name;
+    while(end > line && end[-1] == ' ') end--;
+    if(end == line || end[-1] != ':')
+        return false;
+
+    const char *s = --end;
+    while(s > line && ((s[-1] >= '0' && s[-1] <= '9') || s[-1] == '.')) s--;
+    if(s == end)
+        return false;
+
+    long long sec = 0, frac = 0;
+    int digits = 0;
+    bool dot   = false;
+    for(const char *c = s; c < end; c++) {
+        if(*c == '.') {
+            if(dot) return false;
+            dot = true;
+        }
+        else if(!dot)
+            sec = sec * 10 + (*c - '0');
+        else if(digits < 9)
+            frac = frac * 10 + (*c - '0'), digits++;
+    }
+    for(; digits < 9; digits++)
+        frac *= 10;
+
+    *ts = sec * 1000000000LL + frac;
+    return true;
+}
+
+/**
+ * @brief   parse `<comm>:<pid> [<prio>]` of perf sched script, the last one in [s, e)
+ *
+ * @param s     start of the text
+ * @param e     end of the text
+ * @param pid   pointer for task PID
+ * @param prio  pointer for task priority
+ * @return  const char* (after `]`, NULL if not found)
+ */
+static const char* parse_task(const char *s, const char *e, int *pid, int *prio) {
+
+    for(const char *b = e - 1; b > s; b--) {
+        if(b[0] != '[' || b[-1] != ' ')
+            continue;
+
+        // [prio]
+        const char *c = b + 1;
+        int value = 0;
+        if(c >= e || *c < '0' || *c > '9')
+            continue;
+        while(c < e && *c >= '0' && *c <= '9')
+            value = value * 10 + (*c++ - '0');
+        if(c >= e || *c != ']')
+            continue;
+
+        // comm:pid
+        const char *d = b - 1;
+        while(d > s && d[-1] >= '0' && d[-1] <= '9') d--;
+        if(d == b - 1 || d == s || d[-1] != ':')
+            continue;
+
+        *pid  = atoi(d);
+        *prio = value;
+        return c + 1;
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief   parse one line into event
+ *
+ * @param line  NUL terminated line
+ * @param ev    pointer for event
+ * @return  int (1: event, 0: not a sched line, -1: sched line not understood)
+ */
+static int parse_line(const char *line, TraceEvent *ev) {
+
+    const char *name = strstr(line, "sched_");
+    if(name == NULL)
+        return 0;
+
+    const char *args;
+    if(strncmp(name, "sched_switch:", 13) == 0) {
+        ev->type = EVENT_SWITCH;
+        args     = name + 13;
+    }
+    else if(strncmp(name, "sched_wakeup:", 13) == 0) {
+        ev->type = EVENT_WAKEUP;
+        args     = name + 13;
+    }
+    else if(strncmp(name, "sched_wakeup_new:", 17) == 0) {
+        ev->type = EVENT_WAKEUP;
+        args     = name + 17;
+    }
+    else
+        return 0;
+
+    // event name word may have a prefix (perf: `sched:sched_switch:`)
+    while(name > line && name[-1] != ' ') name--;
+    if(!parse_timestamp(line, name, &ev->ts))
+        return -1;
+
+    const char *v;
+    if(ev->type == EVENT_WAKEUP) {
+        // key=value, or `<comm>:<pid> [<prio>]`
+        if((v = find_key(args, "pid=")) != NULL) {
+            ev->pid  = atoi(v);
+            ev->prio = (v = find_key(args, "prio=")) ? atoi(v) : 120;
+            return 1;
+        }
+        return parse_task(args, args + strlen(args), &ev->pid, &ev->prio) ? 1 : -1;
+    }
+
+    // key=value
+    if((v = find_key(args, "prev_pid=")) != NULL) {
+        const char *state = find_key(args, "prev_state=");
+        const char *next  = find_key(args, "next_pid=");
+        if(state == NULL || next == NULL)
+            return -1;
+        ev->pid      = atoi(v);
+        ev->prio     = (v = find_key(args, "prev_prio=")) ? atoi(v) : 120;
+        ev->runnable = state[0] == 'R';
+        ev->next     = atoi(next);
+        ev->nextPrio = (v = find_key(args, "next_prio=")) ? atoi(v) : 120;
+        return 1;
+    }
+
+    // `<comm>:<pid> [<prio>] <state> ==> <comm>:<pid> [<prio>]`
+    const char *arrow = strstr(args, " ==> ");
+    if(arrow == NULL)
+        return -1;
+    const char *state = parse_task(args, arrow, &ev->pid, &ev->prio);
+    if(state == NULL || !parse_task(arrow + 5, arrow + 5 + strlen(arrow + 5), &ev->next, &ev->nextPrio))
+        return -1;
+    while(*state == ' ') state++;
+    ev->runnable = state[0] == 'R';
+
+    return 1;
+}
+
+// parse every line of the chunk (worker thread)
+static void* parse_chunk(void *arg) {
+
+    TraceChunk *chunk = arg;
+
+    chunk->count = 0;
+    for(char *line = chunk->begin; line < chunk->end; ) {
+        // every chunk ends with a line end (see `parse_trace()`), nothing is written at `end`
+        char *eol = memchr(line, '\n', chunk->end - line);
+        if(eol == NULL)
+            break;
+        *eol = '\0';
+        if(eol > line && eol[-1] == '\r')
+            eol[-1] = '\0';
+
+        if(chunk->count == chunk->capacity) {
+            size_t capacity   = chunk->capacity ? chunk->capacity * 2 : 4096;
+            TraceEvent *grown = realloc(chunk->event, sizeof(TraceEvent) * capacity);
+            if(grown == NULL) {
+                chunk->failed = true;
+                break;
+            }
+            chunk->capacity = capacity;
+            chunk->event    = grown;
+        }
+
+        int r = parse_line(line, &chunk->event[chunk->count]);
+        if(r > 0)
+            chunk->count++;
+        else if(r < 0)
+            chunk->skipped++;
+        chunk->lines++;
+
+        line = eol + 1;
+    }
+
+    return NULL;
+}
+
+// parse every chunk, the calling thread takes the first chunk
+static void parse_chunks(TraceChunk *chunk, int threads) {
+
+#ifndef __EMSCRIPTEN__
+    pthread_t thread[TRACE_THREADS];
+    int started = 1;
+
+    for(; started < threads; started++)
+        if(pthread_create(&thread[started], NULL, parse_chunk, &chunk[started]) != 0)
+            break;
+    parse_chunk(&chunk[0]);
+    for(int i = 1; i < started; i++)
+        pthread_join(thread[i], NULL);
+    // parse the rest in the calling thread if a thread could not be created
+    for(int i = started; i < threads; i++)
+        parse_chunk(&chunk[i]);
+#else
+    for(int i = 0; i < threads; i++)
+        parse_chunk(&chunk[i]);
+#endif
+}
+
+/**
+ * @brief   state of the task, created at the first event of the task
+ *
+ * @param tr    pointer for trace conversion
+ * @param pid   task PID
+ * @return  TaskState* (NULL if not enough memory, the conversion is stopped)
+ */
+static TaskState* task_of(Trace *tr, int pid) {
+
+    bool added = false;
+    int slot   = pidmap_insert(&tr->index, pid, &added);
+
+    if(slot >= tr->capacity) {
+        int capacity     = tr->capacity ? tr->capacity * 2 : 1024;
+        TaskState *grown = realloc(tr->task, sizeof(TaskState) * capacity);
+        if(grown == NULL) {
+            fprintf(stderr, "WARNING: TRACE: [%s] not enough memory for %d tasks\n", tr->fileName, capacity);
+            tr->failed = true;
+            return NULL;
+        }
+        tr->capacity = capacity;
+        tr->task     = grown;
+    }
+    if(added) {
+        tr->task[slot] = (TaskState) { .pid = pid, .prio = 120, .first = -1 };
+        tr->stats->tasks++;
+    }
+
+    return &tr->task[slot];
+}
+
+/**
+ * @brief   give one process to the sink
+ *
+ * @param tr        pointer for trace conversion
+ * @param pid       process no.
+ * @param arrival   arrival (nanosecond timestamp)
+ * @param run       run time (nanosecond)
+ * @param prio      priority
+ */
+static void emit(Trace *tr, int pid, long long arrival, long long run, int prio) {
+
+    Process p;
+    Time burst = (run + tr->opt.unit / 2) / tr->opt.unit;
+
+    init_process(&p, pid, (arrival - tr->base) / tr->opt.unit, burst > 0 ? burst : 1, prio);
+    tr->sink(tr->data, &p);
+    tr->stats->processes++;
+}
+
+/**
+ * @brief   finish the CPU burst of the task
+ *
+ * @param tr    pointer for trace conversion
+ * @param t     pointer for task state
+ */
+static void close_burst(Trace *tr, TaskState *t) {
+
+    if(t->run > 0) {
+        // process no. is an int: stopped instead of wrapping to a process no. already given
+        if(!tr->opt.perTask && tr->burst > INT_MAX) {
+            if(!tr->failed)
+                fprintf(stderr, "WARNING: TRACE: [%s] more than %lld CPU bursts, process no. out of range\n", tr->fileName, (long long) INT_MAX + 1);
+            tr->failed = true;
+        }
+        else if(!tr->opt.perTask)
+            emit(tr, (int) tr->burst++, t->arrival, t->run, t->prio);
+        else {
+            if(t->first < 0)
+                t->first = t->arrival;
+            t->total += t->run;
+        }
+    }
+    t->open = false;
+    t->run  = 0;
+}
+
+/**
+ * @brief   apply one event to the task states in file order
+ *
+ * @param tr    pointer for trace conversion
+ * @param ev    pointer for event
+ */
+static void apply_event(Trace *tr, const TraceEvent *ev) {
+
+    if(!tr->based) {
+        tr->based = true;
+        tr->base  = ev->ts;
+    }
+    long long ts = ev->ts > tr->base ? ev->ts : tr->base;
+    if(ts > tr->last)
+        tr->last = ts;
+    tr->stats->events++;
+
+    // wakeup: a new CPU burst arrives, unless the task is already runnable
+    if(ev->type == EVENT_WAKEUP) {
+        if(ev->pid == 0)
+            return;
+        TaskState *t = task_of(tr, ev->pid);
+        if(t == NULL)
+            return;
+        t->prio = ev->prio;
+        if(!t->open) {
+            t->open    = true;
+            t->arrival = ts;
+            t->run     = 0;
+        }
+        return;
+    }
+
+    // switch out: preempted task stays in the same CPU burst, sleeping task finishes it
+    if(ev->pid != 0) {
+        TaskState *t = task_of(tr, ev->pid);
+        if(t == NULL)
+            return;
+        if(t->running) {
+            t->run    += ts - t->start;
+            t->running = false;
+        }
+        if(!ev->runnable && t->open)
+            close_burst(tr, t);
+        else if(ev->runnable && !t->open) {
+            t->open    = true;
+            t->arrival = ts;
+            t->run     = 0;
+        }
+    }
+
+    // switch in: first switch in without wakeup starts a CPU burst too
+    if(ev->next != 0) {
+        TaskState *t = task_of(tr, ev->next);
+        if(t == NULL)
+            return;
+        t->prio = ev->nextPrio;
+        if(!t->open) {
+            t->open    = true;
+            t->arrival = ts;
+            t->run     = 0;
+        }
+        t->running = true;
+        t->start   = ts;
+    }
+}
+
+bool parse_trace(const char *fileName, const TraceOptions *opt, TraceSink sink, void *data, TraceStats *stats) {
+
+    TraceStats dummy;
+    Trace tr = { .fileName = fileName, .opt = opt ? *opt : (TraceOptions) { 0 }, .sink = sink, .data = data, .stats = stats ? stats : &dummy };
+    *tr.stats = (TraceStats) { 0 };
+
+    // options with defaults
+    if(tr.opt.unit <= 0)
+        tr.opt.unit = TRACE_UNIT;
+    if(tr.opt.window < 4096)
+        tr.opt.window = tr.opt.window ? 4096 : TRACE_WINDOW;
+    if(tr.opt.threads <= 0) {
+        tr.opt.threads = 1;
+#if defined(_SC_NPROCESSORS_ONLN) && !defined(__EMSCRIPTEN__)
+        tr.opt.threads = (int) sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    }
+    if(tr.opt.threads < 1) tr.opt.threads = 1;
+    if(tr.opt.threads > TRACE_THREADS) tr.opt.threads = TRACE_THREADS;
+
+    FILE *fp = fopen(fileName, "rb");
+    if(fp == NULL) {
+        fprintf(stderr, "WARNING: TRACE: [%s] failed to open file\n", fileName);
+        return false;
+    }
+
+    int threads        = tr.opt.threads;
+    char *window       = malloc(tr.opt.window);
+    TraceChunk *chunk  = calloc(threads, sizeof(TraceChunk));
+    size_t carry       = 0;
+    bool skipping      = false;     // in a line longer than the window
+    pidmap_init(&tr.index, 1024);
+
+    if(window == NULL || chunk == NULL) {
+        fprintf(stderr, "WARNING: TRACE: [%s] not enough memory for the read window\n", fileName);
+        tr.failed = true;
+    }
+
+    while(!tr.failed) {
+
+        // read: window ends at the last complete line
+        size_t got  = fread(window + carry, 1, tr.opt.window - carry, fp);
+        size_t len  = carry + got;
+        bool   eof  = got < tr.opt.window - carry;
+        size_t used = len;
+        tr.stats->bytes += got;
+
+        // rest of a line longer than the window: dropped until its line end
+        if(skipping) {
+            char *eol   = memchr(window, '\n', len);
+            size_t drop = eol != NULL ? (size_t) (eol - window) + 1 : len;
+            skipping    = eol == NULL;
+            carry       = len - drop;
+            memmove(window, window + drop, carry);
+            if(eof && carry == 0)
+                break;
+            continue;
+        }
+
+        if(len == 0)
+            break;
+        if(!eof) {
+            char *eol = window + len - 1;
+            while(eol > window && *eol != '\n') eol--;
+            if(*eol != '\n') {
+                fprintf(stderr, "WARNING: TRACE: [%s] line longer than the read window (%zu bytes) skipped\n", fileName, tr.opt.window);
+                tr.stats->lines++;
+                tr.stats->skipped++;
+                skipping = true;
+                carry    = 0;
+                continue;
+            }
+            used = eol - window + 1;
+        }
+        else if(window[len - 1] != '\n') {
+            // last line without line end: the window is not full at the end of file
+            window[len++] = '\n';
+            used          = len;
+        }
+
+        // parse: chunks split at line boundaries
+        for(int i = 0; i < threads; i++) {
+            char *b = i > 0 ? chunk[i - 1].end : window;
+            char *e = window + used * (i + 1) / threads;
+            if(e < b)
+                e = b;
+            while(e > window && e < window + used && e[-1] != '\n') e++;
+            chunk[i].begin = b;
+            chunk[i].end   = e;
+        }
+        parse_chunks(chunk, threads);
+        for(int i = 0; i < threads && !tr.failed; i++) {
+            if(chunk[i].failed) {
+                fprintf(stderr, "WARNING: TRACE: [%s] not enough memory for the events\n", fileName);
+                tr.failed = true;
+            }
+        }
+
+        // apply: file order
+        for(int i = 0; i < threads && !tr.failed; i++) {
+            for(size_t k = 0; k < chunk[i].count; k++)
+                apply_event(&tr, &chunk[i].event[k]);
+            tr.stats->lines   += chunk[i].lines;
+            tr.stats->skipped += chunk[i].skipped;
+            chunk[i].lines = chunk[i].skipped = 0;
+        }
+
+        carry = len - used;
+        memmove(window, window + used, carry);
+        if(eof && carry == 0)
+            break;
+    }
+    fclose(fp);
+
+    // end of trace: running and runnable tasks finish their CPU burst
+    for(int i = 0; i < tr.index.count && !tr.failed; i++) {
+        TaskState *t = &tr.task[i];
+        if(t->running) {
+            t->run    += tr.last - t->start;
+            t->running = false;
+        }
+        if(t->open)
+            close_burst(&tr, t);
+        if(tr.opt.perTask && t->total > 0)
+            emit(&tr, t->pid, t->first, t->total, t->prio);
+    }
+
+    // memory allocate disable
+    for(int i = 0; i < threads && chunk != NULL; i++)
+        free(chunk[i].event);
+    free(chunk);
+    free(window);
+    free(tr.task);
+    pidmap_free(&tr.index);
+
+    return !tr.failed;
+}
+
+/**
+ * @brief structure for processes collected by `load_trace()`
+ *
+ */
+typedef struct TraceLoad {
+
+    Process *p;     // process data
+    int n;          // process count
+    int capacity;   // process array capacity
+    Time t;         // total burst time
+    bool failed;    // not enough memory or too many processes (later processes dropped)
+
+} TraceLoad;
+
+// sink of `load_trace()`: append process
+static void load_sink(void *data, const Process *p) {
+
+    TraceLoad *load = data;
+
+    if(load->failed)
+        return;
+    if(load->n == load->capacity) {
+        Process *grown = load->capacity <= INT_MAX / 2 ? realloc(load->p, sizeof(Process) * (load->capacity ? load->capacity * 2 : 1024)) : NULL;
+        if(grown == NULL) {
+            load->failed = true;
+            return;
+        }
+        load->capacity = load->capacity ? load->capacity * 2 : 1024;
+        load->p        = grown;
+    }
+    load->p[load->n++] = *p;
+    load->t           += p->burst;
+}
+
+Process* load_trace(const char *fileName, const TraceOptions *opt, int *n, Time *t) {
+
+    TraceLoad load = { 0 };
+
+    if(!parse_trace(fileName, opt, load_sink, &load, NULL)) {
+        free(load.p);
+        return NULL;
+    }
+    if(load.failed) {
+        fprintf(stderr, "WARNING: TRACE: [%s] not enough memory for %d processes\n", fileName, load.n);
+        free(load.p);
+        return NULL;
+    }
+    if(load.n == 0) {
+        fprintf(stderr, "WARNING: TRACE: [%s] no CPU burst found\n", fileName);
+        free(load.p);
+        return NULL;
+    }
+
+    // sort by arrival once for every algorithm run on this workload
+    if(!sort_by_arrival(load.p, load.n, 0)) {
+        fprintf(stderr, "WARNING: TRACE: [%s] not enough memory to sort %d processes\n", fileName, load.n);
+        free(load.p);
+        return NULL;
+    }
+
+    *n = load.n;
+    *t = load.t;
+    return load.p;
+}
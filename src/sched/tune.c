@@ -0,0 +1,410 @@
+/**
+ * @file    tune.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   parameter tuning of libcpusched policies (successive halving)
+ *          - MLFQ keeps the level of each process in its hook data (`pidmap.h` slot), the present time
+ *            of the running process is timeout + waiting + execute (set by the engine at dispatch)
+ *          - MLFQ follows the ready queue of the engine (`on_arrival` at every enqueue, the process
+ *            selected by `pick_next` is removed) to scan levels without a lookup per process
+ *          - a short run is the first processes in arrival order, the same prefix for every candidate
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// standard library
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// user define library
+#include "pidmap.h"
+#include "policy.h"
+#include "pool.h"
+#include "radix.h"
+#include "scheduler.h"
+#include "tune.h"
+
+/**
+ * @brief tune.c variable info
+ *
+ *  type            name        pointer     info
+ *  Level           lv          y           MLFQ state of a process
+ *  Queued          queue       y           ready queue of the engine in the same order (MLFQ)
+ *  Tuned           t           y           parameters and process state of a run (hook data)
+ *  Candidate       c           y           parameters and metric of a candidate
+ *  TuneRun         run         y           candidates of the present round
+ *
+ */
+
+// family name (`TuneFamily` order)
+const char *tuneFamilyName[TUNE_FAMILIES] = { "RR", "MLFQ", "AGING" };
+
+// metric name (`TuneMetric` order)
+const char *tuneMetricName[TUNE_METRICS] = { "waiting", "turnaround", "response" };
+
+/**
+ * @brief structure for MLFQ state of a process
+ *
+ */
+typedef struct Level {
+
+    int level;      // queue level (0 is the highest)
+    Time used;      // time run at this level
+    Time seen;      // `execute` already counted in `used` (the present dispatch)
+    Time epoch;     // priority boost count when the level was set
+
+} Level;
+
+/**
+ * @brief structure for a process in the ready queue (MLFQ)
+ *
+ */
+typedef struct Queued {
+
+    int slot;       // state slot of the process
+    int level;      // queue level of the process
+
+} Queued;
+
+/**
+ * @brief structure for parameters and process state of a run (hook data)
+ *
+ */
+typedef struct Tuned {
+
+    TuneParams prm;     // parameters
+    PidMap map;         // process no. to state slot
+    Level *state;       // MLFQ state of each slot
+    int cap;            // state array size
+    Queued *queue;      // ready queue of the engine in the same order (MLFQ)
+    int count;          // ready process count
+    int *size;          // ready process count of each level
+    Time epoch;         // priority boost count of the ready queue
+
+} Tuned;
+
+/**
+ * @brief structure for parameters and metric of a candidate
+ *
+ */
+typedef struct Candidate {
+
+    TuneParams prm;     // parameters
+    double value;       // target metric of the present round
+    int index;          // draw order (tie breaker)
+
+} Candidate;
+
+/**
+ * @brief structure for candidates of the present round
+ *
+ */
+typedef struct TuneRun {
+
+    const TuneOptions *opt;     // options
+    Process *p;                 // workload in arrival order
+    int horizon;                // processes of the round
+    Candidate *c;               // candidates of the round
+
+} TuneRun;
+
+// state of the process, level 0 when first seen
+static Level* tuned_state(Tuned *t, const Process *p) {
+
+    bool added;
+    int slot = pidmap_insert(&t->map, p->processID, &added);
+
+    if(slot >= t->cap) {
+        t->cap   = t->cap * 2 > slot + 1 ? t->cap * 2 : slot + 1;
+        t->state = realloc(t->state, sizeof(Level) * t->cap);
+    }
+    if(added)
+        t->state[slot] = (Level) { 0 };
+
+    return &t->state[slot];
+}
+
+// priority boost: back to level 0 once for each boost interval passed, `executed` is not counted
+static void mlfq_boost(const Tuned *t, Level *lv, Time now, Time executed) {
+
+    if(t->prm.boost > 0 && now / t->prm.boost > lv->epoch) {
+        lv->epoch = now / t->prm.boost;
+        lv->level = 0;
+        lv->used  = 0;
+        lv->seen  = executed;
+    }
+}
+
+// a process enters the ready queue: `timeout` is the present time (arrival or preemption)
+static long long MLFQ_arrival(void *data, const Process *p) {
+
+    Tuned *t  = data;
+    Level *lv = tuned_state(t, p);
+
+    mlfq_boost(t, lv, p->timeout, 0);
+    t->queue[t->count++] = (Queued) { (int) (lv - t->state), lv->level };
+    t->size[lv->level]++;
+
+    return 0;
+}
+
+// highest level first, enqueue order in the same level: a higher level preempts the running process
+static int MLFQ_pick(void *data, const Process *const *ready, int count, const Process *cur, Time time) {
+
+    Tuned *t = data;
+    int best = 0, bestLevel = 0;
+
+    (void) ready;
+    (void) count;
+
+    // priority boost of every ready process at once
+    if(t->prm.boost > 0 && time / t->prm.boost > t->epoch) {
+        t->epoch = time / t->prm.boost;
+        for(int i = 0; i < t->count; i++) {
+            Level *lv = &t->state[t->queue[i].slot];
+            mlfq_boost(t, lv, time, 0);
+            t->size[t->queue[i].level]--;
+            t->size[t->queue[i].level = lv->level]++;
+        }
+    }
+
+    while(t->size[bestLevel] == 0)
+        bestLevel++;
+    while(t->queue[best].level != bestLevel)
+        best++;
+
+    if(cur != NULL) {
+        Level *lv = tuned_state(t, cur);
+        mlfq_boost(t, lv, time, cur->execute);
+        if(bestLevel >= lv->level)
+            return -1;
+
+        // preempted: keeps the time run at its level
+        lv->used += cur->execute - lv->seen;
+        lv->seen  = 0;
+    }
+
+    // the engine removes the selected process from its ready queue
+    t->state[t->queue[best].slot].seen = 0;
+    t->size[bestLevel]--;
+    t->count--;
+    memmove(t->queue + best, t->queue + best + 1, sizeof(Queued) * (t->count - best));
+
+    return best;
+}
+
+// quantum of the level used up: one level down and back to the ready queue
+static bool MLFQ_expire(void *data, const Process *cur, int q) {
+
+    Tuned *t  = data;
+    Level *lv = tuned_state(t, cur);
+
+    (void) q;
+    mlfq_boost(t, lv, cur->timeout + cur->waiting + cur->execute, cur->execute);
+    lv->used += cur->execute - lv->seen;
+    lv->seen  = cur->execute;
+    if(lv->used < (Time) t->prm.quantum << lv->level)
+        return false;
+
+    if(lv->level < t->prm.levels - 1)
+        lv->level++;
+    lv->used = 0;
+
+    return true;
+}
+
+// smallest priority - aging * waiting, earlier enqueue on a tie, non-preemptive
+static int AGING_pick(void *data, const Process *const *ready, int count, const Process *cur, Time time) {
+
+    const Tuned *t = data;
+    int best = 0;
+    double bestKey = 0;
+
+    if(cur != NULL)
+        return -1;
+    for(int i = 0; i < count; i++) {
+        double key = ready[i]->priority - t->prm.aging * (time - ready[i]->timeout);
+        if(i == 0 || key < bestKey)
+            best = i, bestKey = key;
+    }
+
+    return best;
+}
+
+TuneParams tune_default(TuneFamily family) {
+
+    switch(family) {
+    case TUNE_MLFQ:
+        return (TuneParams) { .quantum = QAUNTUM, .levels = 3 };
+    case TUNE_AGING:
+        return (TuneParams) { .aging = 0 };
+    default:
+        return (TuneParams) { .quantum = QAUNTUM };
+    }
+}
+
+void run_tuned(TuneFamily family, const TuneParams *prm, Process *p, int n, Schedule *s) {
+
+    Tuned t = { .prm = *prm };
+    Policy pol = { .name = tuneFamilyName[family], .data = &t };
+
+    switch(family) {
+    case TUNE_MLFQ:
+        pidmap_init(&t.map, n);
+        t.cap              = n > 0 ? n : 1;
+        t.state            = malloc(sizeof(Level) * t.cap);
+        t.queue            = malloc(sizeof(Queued) * (n + 1));
+        t.prm.quantum      = prm->quantum > 0 ? prm->quantum : 1;
+        t.prm.levels       = prm->levels > 0 ? prm->levels : 1;
+        t.size             = calloc(t.prm.levels, sizeof(int));
+        pol.on_arrival     = MLFQ_arrival;
+        pol.pick_next      = MLFQ_pick;
+        pol.on_tick_expire = MLFQ_expire;
+        break;
+    case TUNE_AGING:
+        pol.pick_next = AGING_pick;
+        break;
+    default:
+        pol.quantum = prm->quantum > 0 ? prm->quantum : 1;
+        break;
+    }
+
+    run_policy(&pol, p, n, 0, s);
+
+    // memory allocate disable
+    if(family == TUNE_MLFQ) {
+        pidmap_free(&t.map);
+        free(t.state);
+        free(t.queue);
+        free(t.size);
+    }
+}
+
+// splitmix64: random numbers of the candidates
+static double next_uniform(unsigned long long *state) {
+
+    unsigned long long z = (*state += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return ((z ^ (z >> 31)) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+// draw candidate parameters on a log scale
+static TuneParams draw_params(TuneFamily family, unsigned long long *state) {
+
+    TuneParams prm = tune_default(family);
+
+    switch(family) {
+    case TUNE_MLFQ:
+        prm.levels  = 1 + (int) (next_uniform(state) * TUNE_MAX_LEVELS);
+        prm.quantum = (int) lround(exp(next_uniform(state) * log(TUNE_MAX_QUANTUM)));
+        prm.boost   = next_uniform(state) < 0.25 ? 0 : (Time) llround(exp(log(10) + next_uniform(state) * (log(TUNE_MAX_BOOST) - log(10))));
+        break;
+    case TUNE_AGING:
+        prm.aging   = next_uniform(state) < 0.125 ? 0 : pow(10, -4 + 4 * next_uniform(state));
+        break;
+    default:
+        prm.quantum = (int) lround(exp(next_uniform(state) * log(TUNE_MAX_QUANTUM)));
+        break;
+    }
+
+    return prm;
+}
+
+static double metric_value(const Schedule *s, TuneMetric metric) {
+
+    Metrics m = get_metrics(s);
+    return metric == TUNE_TURNAROUND ? m.avg_turnaround : metric == TUNE_RESPONSE ? m.avg_response : m.avg_waiting;
+}
+
+/**
+ * @brief   run one candidate on the horizon of the round
+ *
+ * @param data  pointer for candidates of the round (`TuneRun`)
+ * @param i     candidate index
+ */
+static void tune_task(void *data, int i) {
+
+    TuneRun *run = data;
+    Schedule s   = { 0 };
+
+    run_tuned(run->opt->family, &run->c[i].prm, run->p, run->horizon, &s);
+    run->c[i].value = metric_value(&s, run->opt->metric);
+    free_schedule(&s);
+}
+
+static int compare_candidate(const void *a, const void *b) {
+
+    const Candidate *x = a, *y = b;
+    if(x->value != y->value)
+        return x->value < y->value ? -1 : 1;
+    return x->index - y->index;
+}
+
+bool tune_policy(const Process *p, int n, const TuneOptions *opt, TuneResult *res) {
+
+    int count = opt->candidates > 0 ? opt->candidates : TUNE_CANDIDATES;
+    int eta   = opt->eta > 0 ? opt->eta : TUNE_ETA;
+    if(n < 1 || eta < 2 || opt->family < 0 || opt->family >= TUNE_FAMILIES)
+        return false;
+
+    // rounds until one candidate is left: the last one runs the whole workload
+    int rounds = 1;
+    for(int k = count; k > 1; k = (k + eta - 1) / eta)
+        rounds++;
+
+    TuneRun run = { .opt = opt, .p = malloc(sizeof(Process) * n), .c = malloc(sizeof(Candidate) * count) };
+    if(run.p != NULL)
+        memcpy(run.p, p, sizeof(Process) * n);
+    if(run.p == NULL || run.c == NULL || !sort_by_arrival(run.p, n, 0)) {
+        free(run.p);
+        free(run.c);
+        return false;
+    }
+
+    // candidate 0 is the default of the family
+    unsigned long long state = opt->seed;
+    for(int i = 0; i < count; i++)
+        run.c[i] = (Candidate) { i == 0 ? tune_default(opt->family) : draw_params(opt->family, &state), 0, i };
+
+    *res = (TuneResult) { .base = tune_default(opt->family), .rounds = rounds };
+    for(int round = 0; round < rounds; round++) {
+        // horizon grows `eta` times each round
+        double horizon = n;
+        for(int k = round; k < rounds - 1; k++)
+            horizon /= eta;
+        run.horizon = horizon > TUNE_MIN_HORIZON ? (int) horizon : (n < TUNE_MIN_HORIZON ? n : TUNE_MIN_HORIZON);
+
+        run_pool(tune_task, &run, count, opt->jobs);
+        res->evaluations += count;
+        res->simulated   += (long long) count * run.horizon;
+
+        qsort(run.c, count, sizeof(Candidate), compare_candidate);
+        count = (count + eta - 1) / eta;
+    }
+    res->best  = run.c[0].prm;
+    res->value = run.c[0].value;
+
+    // default parameters on the whole workload for comparison
+    run.c[0]    = (Candidate) { res->base, 0, 0 };
+    run.horizon = n;
+    tune_task(&run, 0);
+    res->baseValue    = run.c[0].value;
+    res->evaluations += 1;
+    res->simulated   += n;
+
+    // the default can be dropped by a short horizon of an early round: never report a regression
+    if(res->baseValue <= res->value) {
+        res->best  = res->base;
+        res->value = res->baseValue;
+    }
+
+    // memory allocate disable
+    free(run.p);
+    free(run.c);
+
+    return true;
+}
@@ -0,0 +1,420 @@
+/**
+ * @file    workload.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   workload loader for CPU scheduler simulator
+ *          - built-in default process data (`pInfo`)
+ *          - text workload file, one process per line
+ *          - binary workload file, varint encoded (detected by `WORKLOAD_MAGIC`)
+ *          - loaded process data is sorted by arrival (stable, file order for the same arrival)
+ *          - `read_process()` reads one process at a time for streams (file order)
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// standard library
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// user define library
+#include "pidmap.h"
+#include "process.h"
+#include "radix.h"
+#include "workload.h"
+
+// process default data to be used by the simulator
+int pInfo[P_COUNT][P_PARAM] = {
+    {0, 0, 10, 3}, // process 0, arrival 0, burst 10, priority 3
+    {1, 1, 28, 2}, // process 1, arrival 1, burst 28, priority 2
+    {2, 2,  6, 4}, // process 2, arrival 2, burst  6, priority 4
+    {3, 3,  4, 1}, // process 3, arrival 3, burst  4, priority 1
+    {4, 4, 14, 2}  // process 4, arrival 4, burst 14, priority 2
+};
+
+void init_process(Process *p, int pid, Time arrival, Time burst, int priority) {
+
+    p->processID = pid;
+    p->arrival   = arrival;
+    p->burst     = burst;
+    p->priority  = priority;
+    p->remain    = burst;
+    p->timeout   = arrival;
+    p->waiting   = 0;
+    p->execute   = 0;
+}
+
+Process* default_workload(int *n, Time *t) {
+
+    Process *p = malloc(sizeof(Process) * P_COUNT);
+
+    *n = P_COUNT;
+    *t = 0;
+    for(int i = 0; i < P_COUNT; i++) {
+        init_process(&p[i], pInfo[i][0], pInfo[i][1], pInfo[i][2], pInfo[i][3]);
+        *t += p[i].burst;
+    }
+
+    return p;
+}
+
+/**
+ * @brief   write unsigned varint (7 bits for each byte, lower bits first)
+ *
+ * @param fp    file pointer
+ * @param v     value
+ */
+static void write_varint(FILE *fp, unsigned long long v) {
+
+    while(v >= 0x80) {
+        fputc((int) (v & 0x7f) | 0x80, fp);
+        v >>= 7;
+    }
+    fputc((int) v, fp);
+}
+
+/**
+ * @brief   read unsigned varint
+ *
+ * @param fp    file pointer
+ * @param v     pointer for value
+ * @return  bool (false at the end of file or invalid varint)
+ */
+static bool read_varint(FILE *fp, unsigned long long *v) {
+
+    *v = 0;
+    for(int shift = 0; shift < 64; shift += 7) {
+        int c = fgetc(fp);
+        if(c == EOF)
+            return false;
+        *v |= (unsigned long long) (c & 0x7f) << shift;
+        if(!(c & 0x80))
+            return true;
+    }
+
+    return false;
+}
+
+// zigzag encoding: small negative value takes a few bytes too
+static unsigned long long zigzag(long long v)           { return ((unsigned long long) v << 1) ^ (unsigned long long) (v >> 63); }
+static long long          unzigzag(unsigned long long v) { return (long long) (v >> 1) ^ -(long long) (v & 1); }
+
+/**
+ * @brief   load process data from binary workload file (after the magic)
+ *
+ * @param fp        file pointer
+ * @param fileName  workload file path
+ * @param n         pointer for total process count
+ * @param t         pointer for total burst time
+ * @return  Process* (NULL if the file is invalid)
+ */
+static Process* load_binary_workload(FILE *fp, const char *fileName, int *n, Time *t) {
+
+    unsigned long long count, v[4];
+    long long arrival = 0, pid = 0;
+
+    if(fgetc(fp) != WORKLOAD_VERSION || !read_varint(fp, &count) || count > 0x7fffffff) {
+        fprintf(stderr, "WARNING: WORKLOAD: [%s] unsupported binary workload\n", fileName);
+        return NULL;
+    }
+
+    // the count of the header is not trusted: the array grows with the records read
+    int capacity = P_COUNT;
+    Process *p   = malloc(sizeof(Process) * capacity);
+    if(p == NULL) {
+        fprintf(stderr, "WARNING: WORKLOAD: [%s] not enough memory\n", fileName);
+        return NULL;
+    }
+
+    *n = 0;
+    *t = 0;
+    for(int i = 0; i < (int) count; i++) {
+        long long delta = 0, step = 0;
+        bool valid = read_varint(fp, &v[0]) && read_varint(fp, &v[1]) && read_varint(fp, &v[2]) && read_varint(fp, &v[3]);
+        if(valid) {
+            delta = unzigzag(v[0]);
+            step  = unzigzag(v[2]);
+        }
+        // process no. stays in int range (`pid` is always in it, no overflow)
+        valid = valid && delta <= TIME_MAX - arrival && (arrival += delta) >= 0 && arrival < ARRIVAL_LIMIT
+             && v[1] != 0 && v[1] <= (unsigned long long) (TIME_MAX - *t)
+             && unzigzag(v[3]) >= -PRIORITY_LIMIT && unzigzag(v[3]) < PRIORITY_LIMIT
+             && step >= INT_MIN - pid && step <= INT_MAX - pid;
+        if(valid && i == capacity) {
+            Process *grown = realloc(p, sizeof(Process) * (capacity *= 2));
+            valid = grown != NULL;
+            if(valid)
+                p = grown;
+        }
+        if(!valid) {
+            fprintf(stderr, "WARNING: WORKLOAD: [%s] invalid process at record %d\n", fileName, i + 1);
+            free(p);
+            return NULL;
+        }
+        pid += step;
+        init_process(&p[(*n)++], (int) pid, arrival, (Time) v[1], (int) unzigzag(v[3]));
+        *t += p[i].burst;
+    }
+
+    return p;
+}
+
+/**
+ * @brief   load process data from text workload file
+ *
+ * @param fp        file pointer
+ * @param fileName  workload file path
+ * @param n         pointer for total process count
+ * @param t         pointer for total burst time
+ * @return  Process* (NULL if the file is invalid)
+ */
+static Process* load_text_workload(FILE *fp, const char *fileName, int *n, Time *t) {
+
+    char line[LINE_MAX_W];
+    int capacity = P_COUNT;
+    Process *p   = malloc(sizeof(Process) * capacity);
+    if(p == NULL) {
+        fprintf(stderr, "WARNING: WORKLOAD: [%s] not enough memory\n", fileName);
+        return NULL;
+    }
+
+    *n = 0;
+    *t = 0;
+    for(int no = 1; fgets(line, sizeof(line), fp) != NULL; no++) {
+
+        int pid, priority;
+        Time arrival, burst;
+        char *c = line;
+
+        // skip blank line and comment
+        while(*c == ' ' || *c == '\t') c++;
+        if(*c == '#' || *c == '\r' || *c == '\n' || *c == '\0')
+            continue;
+
+        if(sscanf(c, "%d %lld %lld %d", &pid, &arrival, &burst, &priority) != 4 || arrival < 0 || arrival >= ARRIVAL_LIMIT
+            || burst <= 0 || burst > TIME_MAX - *t || priority < -PRIORITY_LIMIT || priority >= PRIORITY_LIMIT) {
+            fprintf(stderr, "WARNING: WORKLOAD: [%s] invalid process at line %d\n", fileName, no);
+            free(p);
+            return NULL;
+        }
+
+        if(*n == capacity) {
+            Process *grown = capacity <= INT_MAX / 2 ? realloc(p, sizeof(Process) * capacity * 2) : NULL;
+            if(grown == NULL) {
+                fprintf(stderr, "WARNING: WORKLOAD: [%s] not enough memory at line %d\n", fileName, no);
+                free(p);
+                return NULL;
+            }
+            capacity *= 2;
+            p         = grown;
+        }
+        init_process(&p[(*n)++], pid, arrival, burst, priority);
+        *t += burst;
+    }
+
+    return p;
+}
+
+Process* load_workload(const char *fileName, int *n, Time *t) {
+
+    FILE *fp = fopen(fileName, "rb");
+    if(fp == NULL) {
+        fprintf(stderr, "WARNING: WORKLOAD: [%s] failed to open file\n", fileName);
+        return NULL;
+    }
+
+    // binary workload starts with the magic, text workload otherwise
+    char magic[4] = { 0 };
+    Process *p;
+    if(fread(magic, 1, 4, fp) == 4 && memcmp(magic, WORKLOAD_MAGIC, 4) == 0)
+        p = load_binary_workload(fp, fileName, n, t);
+    else {
+        rewind(fp);
+        p = load_text_workload(fp, fileName, n, t);
+    }
+    fclose(fp);
+
+    if(p == NULL)
+        return NULL;
+
+    if(*n == 0) {
+        fprintf(stderr, "WARNING: WORKLOAD: [%s] no process found\n", fileName);
+        free(p);
+        return NULL;
+    }
+
+    // process no. can be sparse (trace PID), but must be unique and not negative
+    PidMap index;
+    pidmap_init(&index, *n);
+    for(int i = 0; i < *n; i++) {
+        bool added = false;
+        if(p[i].processID >= 0)
+            pidmap_insert(&index, p[i].processID, &added);
+        if(!added) {
+            fprintf(stderr, "WARNING: WORKLOAD: [%s] process no. %d is negative or duplicated\n", fileName, p[i].processID);
+            pidmap_free(&index);
+            free(p);
+            return NULL;
+        }
+    }
+    pidmap_free(&index);
+
+    // sort by arrival once for every algorithm run on this workload
+    if(!sort_by_arrival(p, *n, 0)) {
+        fprintf(stderr, "WARNING: WORKLOAD: [%s] not enough memory to sort %d processes\n", fileName, *n);
+        free(p);
+        return NULL;
+    }
+
+    // the gantt chart ends by the last arrival plus the total burst time at the latest
+    if(p[*n - 1].arrival > TIME_MAX - *t) {
+        fprintf(stderr, "WARNING: WORKLOAD: [%s] last arrival %lld plus total burst %lld is out of time range\n", fileName, p[*n - 1].arrival, *t);
+        free(p);
+        return NULL;
+    }
+
+    return p;
+}
+
+bool begin_workload(WorkloadWriter *w, const char *fileName, bool binary) {
+
+    *w = (WorkloadWriter) { .fileName = fileName, .binary = binary };
+    w->fp = fopen(fileName, binary ? "wb" : "w");
+    if(w->fp == NULL) {
+        fprintf(stderr, "WARNING: WORKLOAD: [%s] failed to open file\n", fileName);
+        return false;
+    }
+
+    // process count is unknown until the end: fixed size varint, written again by `end_workload()`
+    if(binary) {
+        fwrite(WORKLOAD_MAGIC, 1, 4, w->fp);
+        fputc(WORKLOAD_VERSION, w->fp);
+        w->countPos = ftell(w->fp);
+        for(int i = 0; i < WORKLOAD_COUNT_W; i++)
+            fputc(i + 1 < WORKLOAD_COUNT_W ? 0x80 : 0x00, w->fp);
+    }
+
+    return true;
+}
+
+void write_process(WorkloadWriter *w, const Process *p) {
+
+    if(w->binary) {
+        write_varint(w->fp, zigzag(p->arrival - w->arrival));
+        write_varint(w->fp, (unsigned long long) p->burst);
+        write_varint(w->fp, zigzag(p->processID - w->pid));
+        write_varint(w->fp, zigzag(p->priority));
+        w->arrival = p->arrival;
+        w->pid     = p->processID;
+    }
+    else
+        fprintf(w->fp, "%d %lld %lld %d\n", p->processID, p->arrival, p->burst, p->priority);
+
+    w->count++;
+}
+
+bool end_workload(WorkloadWriter *w) {
+
+    bool ok = !ferror(w->fp);
+
+    if(w->binary && ok) {
+        unsigned long long v = (unsigned long long) w->count;
+        ok = fseek(w->fp, w->countPos, SEEK_SET) == 0;
+        for(int i = 0; i < WORKLOAD_COUNT_W && ok; i++, v >>= 7)
+            fputc((int) (v & 0x7f) | (i + 1 < WORKLOAD_COUNT_W ? 0x80 : 0x00), w->fp);
+    }
+    if(fclose(w->fp) != 0)
+        ok = false;
+    if(!ok)
+        fprintf(stderr, "WARNING: WORKLOAD: [%s] failed to write file\n", w->fileName);
+
+    w->fp = NULL;
+    return ok;
+}
+
+bool begin_read_workload(WorkloadReader *rd, FILE *fp, const char *fileName) {
+
+    *rd = (WorkloadReader) { .fp = fp, .fileName = fileName, .count = -1 };
+
+    // binary workload starts with the magic, a text line never starts with its first byte
+    int c = fgetc(fp);
+    if(c != WORKLOAD_MAGIC[0]) {
+        if(c != EOF)
+            ungetc(c, fp);
+        return true;
+    }
+
+    unsigned long long count;
+    char magic[3];
+    if(fread(magic, 1, 3, fp) != 3 || memcmp(magic, WORKLOAD_MAGIC + 1, 3) != 0
+        || fgetc(fp) != WORKLOAD_VERSION || !read_varint(fp, &count)) {
+        fprintf(stderr, "WARNING: WORKLOAD: [%s] unsupported binary workload\n", fileName);
+        return false;
+    }
+    rd->binary = true;
+    rd->count  = count > 0 ? (long long) (count & 0x7fffffffffffffffULL) : -1;
+
+    return true;
+}
+
+bool read_process(WorkloadReader *rd, Process *p) {
+
+    if(rd->binary) {
+        unsigned long long v[4];
+        if(rd->read == rd->count)
+            return false;
+        if(!read_varint(rd->fp, &v[0]))
+            return false;
+        if(!read_varint(rd->fp, &v[1]) || !read_varint(rd->fp, &v[2]) || !read_varint(rd->fp, &v[3])
+            || unzigzag(v[0]) > TIME_MAX - rd->arrival || (rd->arrival += unzigzag(v[0])) < 0 || rd->arrival >= ARRIVAL_LIMIT
+            || v[1] == 0 || v[1] > 0x7fffffffffffffffULL || unzigzag(v[3]) < -PRIORITY_LIMIT || unzigzag(v[3]) >= PRIORITY_LIMIT
+            || unzigzag(v[2]) < INT_MIN - rd->pid || unzigzag(v[2]) > INT_MAX - rd->pid) {
+            fprintf(stderr, "WARNING: WORKLOAD: [%s] invalid process at record %lld\n", rd->fileName, rd->read + 1);
+            return false;
+        }
+        rd->pid += unzigzag(v[2]);
+        init_process(p, (int) rd->pid, rd->arrival, (Time) v[1], (int) unzigzag(v[3]));
+        rd->read++;
+        return true;
+    }
+
+    char line[LINE_MAX_W];
+    while(fgets(line, sizeof(line), rd->fp) != NULL) {
+
+        int pid, priority;
+        Time arrival, burst;
+        char *c = line;
+
+        // skip blank line and comment
+        rd->line++;
+        while(*c == ' ' || *c == '\t') c++;
+        if(*c == '#' || *c == '\r' || *c == '\n' || *c == '\0')
+            continue;
+
+        if(sscanf(c, "%d %lld %lld %d", &pid, &arrival, &burst, &priority) != 4 || arrival < 0 || arrival >= ARRIVAL_LIMIT
+            || burst <= 0 || priority < -PRIORITY_LIMIT || priority >= PRIORITY_LIMIT) {
+            fprintf(stderr, "WARNING: WORKLOAD: [%s] invalid process at line %lld\n", rd->fileName, rd->line);
+            return false;
+        }
+        init_process(p, pid, arrival, burst, priority);
+        rd->read++;
+        return true;
+    }
+
+    return false;
+}
+
+bool save_workload(const char *fileName, const Process *p, int n, bool binary) {
+
+    WorkloadWriter w;
+    if(!begin_workload(&w, fileName, binary))
+        return false;
+
+    for(int i = 0; i < n; i++)
+        write_process(&w, &p[i]);
+
+    return end_workload(&w);
+}
@@ -0,0 +1,246 @@
+/**
+ * @file    test_checkpoint.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   test of the checkpoint and resume of libcpusched (no raylib)
+ *          - `run_checkpointed()` (sync and fork) gives the same schedule as `run_policy()`
+ *          - resume from a snapshot in the middle of the run gives the same totals and gantt chart
+ *          - a truncated or corrupted segment log or snapshot file is rejected (run from the beginning)
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// standard library
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// user define library
+#include "checkpoint.h"
+#include "process.h"
+#include "scheduler.h"
+#include "workload.h"
+
+/**
+ * @brief test_checkpoint.c variable info
+ *
+ *  type        name        pointer     info
+ *  #define     SNAP_FILE   n           snapshot file of the test (removed at the end)
+ *  #define     SEG_FILE    n           segment log of the snapshot file
+ *  #define     TEST_N      n           process count of the test workload
+ *  uint64_t    state       n           random number generator state
+ *  Process     base        y           test workload (idle gaps and simultaneous arrivals)
+ *  Schedule    ref         y           result of `run_policy()`
+ *  Schedule    s           y           result of `run_checkpointed()`
+ *
+ */
+
+#define SNAP_FILE   "test_checkpoint.snap"      // snapshot file of the test (removed at the end)
+#define SEG_FILE    "test_checkpoint.snap.seg"  // segment log of the snapshot file
+#define TEST_N      300                         // process count of the test workload
+
+uint64_t state = 7;     // random number generator state
+
+// xorshift64* random number
+static uint64_t next_random(void) {
+
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    return state * 2685821657736338717ULL;
+}
+
+// read the whole file (NULL if it does not exist)
+static unsigned char* read_file(const char *fileName, long *size) {
+
+    FILE *fp = fopen(fileName, "rb");
+    if(fp == NULL)
+        return NULL;
+
+    fseek(fp, 0, SEEK_END);
+    *size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    unsigned char *data = malloc(*size > 0 ? (size_t) *size : 1);
+    if(data != NULL && fread(data, 1, (size_t) *size, fp) != (size_t) *size) {
+        free(data);
+        data = NULL;
+    }
+    fclose(fp);
+    return data;
+}
+
+// replace the whole file
+static void write_file(const char *fileName, const unsigned char *data, long size) {
+
+    FILE *fp = fopen(fileName, "wb");
+    if(fp == NULL)
+        return;
+    fwrite(data, 1, (size_t) size, fp);
+    fclose(fp);
+}
+
+/**
+ * @brief   compare totals, gantt chart segments and termination order of two schedules
+ *
+ * @param s     pointer for schedule to check
+ * @param ref   pointer for reference schedule
+ * @param label test name
+ * @return  int (failure count)
+ */
+static int compare_schedule(const Schedule *s, const Schedule *ref, const char *label) {
+
+    if(s->n != ref->n || s->t != ref->t || s->segments != ref->segments || s->total_turnaround != ref->total_turnaround
+        || s->total_waiting != ref->total_waiting || s->total_response != ref->total_response) {
+        fprintf(stderr, "FAIL: %s [%s]: n %d t %lld segments %lld totals %lld/%lld/%lld, expected n %d t %lld segments %lld totals %lld/%lld/%lld\n",
+            label, ref->algo, s->n, s->t, s->segments, s->total_turnaround, s->total_waiting, s->total_response,
+            ref->n, ref->t, ref->segments, ref->total_turnaround, ref->total_waiting, ref->total_response);
+        return 1;
+    }
+
+    for(long long k = 0; k < ref->segments; k++) {
+        if(s->gantt[k].start != ref->gantt[k].start || s->gantt[k].processID != ref->gantt[k].processID) {
+            fprintf(stderr, "FAIL: %s [%s]: segment %lld is P%d at %lld, expected P%d at %lld\n",
+                label, ref->algo, k, s->gantt[k].processID, s->gantt[k].start, ref->gantt[k].processID, ref->gantt[k].start);
+            return 1;
+        }
+    }
+
+    for(int i = 0; i < ref->n; i++) {
+        if(s->result[i].processID != ref->result[i].processID || s->result[i].waiting != ref->result[i].waiting) {
+            fprintf(stderr, "FAIL: %s [%s]: terminated process %d is P%d, expected P%d\n",
+                label, ref->algo, i, s->result[i].processID, ref->result[i].processID);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief   run with snapshots and compare with the reference schedule
+ *
+ * @param pol       pointer for scheduling policy
+ * @param base      pointer for test workload (copied, not changed)
+ * @param ref       pointer for reference schedule
+ * @param opt       checkpoint options
+ * @param resumed   expected resume time (-1: from the beginning)
+ * @param label     test name
+ * @return  int (failure count)
+ */
+static int check_run(const Policy *pol, const Process *base, const Schedule *ref, const CheckpointOptions *opt, Time resumed, const char *label) {
+
+    Process p[TEST_N];
+    CheckpointStats stats;
+    Schedule s = { 0 };
+    int failed = 0;
+
+    memcpy(p, base, sizeof(p));
+    if(!run_checkpointed(pol, p, TEST_N, &s, opt, &stats)) {
+        fprintf(stderr, "FAIL: %s [%s]: options rejected\n", label, pol->name);
+        return 1;
+    }
+
+    failed += compare_schedule(&s, ref, label);
+    if(stats.resumed != resumed) {
+        fprintf(stderr, "FAIL: %s [%s]: resumed at %lld, expected %lld\n", label, pol->name, stats.resumed, resumed);
+        failed++;
+    }
+    if(stats.failed != 0) {
+        fprintf(stderr, "FAIL: %s [%s]: %lld snapshots failed\n", label, pol->name, stats.failed);
+        failed++;
+    }
+
+    free_schedule(&s);
+    return failed;
+}
+
+int main(void) {
+
+    Process base[TEST_N], p[TEST_N];
+    Time t = 0, arrival = 0;
+    int failed = 0;
+
+    // idle gaps (arrival step above the burst) and simultaneous arrivals (step 0)
+    for(int i = 0; i < TEST_N; i++) {
+        Time burst = 1 + (Time) (next_random() % 12);
+        arrival += (Time) (next_random() % 4 == 0 ? 0 : next_random() % 24);
+        init_process(&base[i], i, arrival, burst, (int) (next_random() % 6));
+        t += burst;
+    }
+
+    for(int algo = 0; algo < ALGO_COUNT; algo++) {
+        const Policy *pol = builtinPolicy[algo];
+        Schedule ref = { 0 };
+
+        memcpy(p, base, sizeof(p));
+        run_policy(pol, p, TEST_N, t, &ref);
+
+        // uninterrupted runs with a few snapshots, in the calling thread and in a forked child
+        CheckpointOptions opt = { .fileName = SNAP_FILE, .interval = ref.t / 5, .sync = true };
+        failed += check_run(pol, base, &ref, &opt, -1, "sync run");
+        opt.sync = false;
+        failed += check_run(pol, base, &ref, &opt, -1, "fork run");
+
+        // one snapshot in the middle of the run, then resume from it
+        remove(SNAP_FILE);
+        remove(SEG_FILE);
+        opt = (CheckpointOptions) { .fileName = SNAP_FILE, .interval = ref.t / 2 + 1, .sync = true };
+        failed += check_run(pol, base, &ref, &opt, -1, "run to the middle snapshot");
+        opt.resume = true;
+        opt.interval = ref.t * 2;
+        failed += check_run(pol, base, &ref, &opt, ref.t / 2 + 1, "resume from the middle snapshot");
+
+        long segSize = 0, snapSize = 0;
+        unsigned char *seg  = read_file(SEG_FILE, &segSize);
+        unsigned char *snap = read_file(SNAP_FILE, &snapSize);
+        if(seg == NULL || snap == NULL || segSize < 24) {
+            fprintf(stderr, "FAIL: middle snapshot [%s]: snapshot file or segment log missing\n", pol->name);
+            failed++;
+        }
+        else {
+            // truncated segment log: shorter than the segment count of the snapshot
+            write_file(SEG_FILE, seg, segSize - 12);
+            failed += check_run(pol, base, &ref, &opt, -1, "truncated segment log");
+
+            // corrupted segment log: last segment differs from the one in the snapshot file
+            write_file(SEG_FILE, seg, segSize);
+            unsigned char *bad = malloc((size_t) segSize);
+            memcpy(bad, seg, (size_t) segSize);
+            bad[segSize - 4] ^= 0x5a;
+            write_file(SEG_FILE, bad, segSize);
+            failed += check_run(pol, base, &ref, &opt, -1, "corrupted segment log");
+
+            // segments out of time order
+            memcpy(bad, seg, (size_t) segSize);
+            memcpy(bad + 12, seg, 8);
+            write_file(SEG_FILE, bad, segSize);
+            failed += check_run(pol, base, &ref, &opt, -1, "segment log out of order");
+            free(bad);
+
+            // corrupted snapshot file: checksum mismatch
+            write_file(SEG_FILE, seg, segSize);
+            snap[snapSize / 2] ^= 0x01;
+            write_file(SNAP_FILE, snap, snapSize);
+            failed += check_run(pol, base, &ref, &opt, -1, "corrupted snapshot file");
+
+            // restored files resume again
+            snap[snapSize / 2] ^= 0x01;
+            write_file(SNAP_FILE, snap, snapSize);
+            failed += check_run(pol, base, &ref, &opt, ref.t / 2 + 1, "restored snapshot");
+        }
+
+        free(seg);
+        free(snap);
+        free_schedule(&ref);
+    }
+
+    remove(SNAP_FILE);
+    remove(SEG_FILE);
+
+    if(failed == 0)
+        printf("checkpoint: all passed\n");
+    return failed > 0;
+}
@@ -0,0 +1,421 @@
+/**
+ * @file    test_engine.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   test of the scheduling engine of libcpusched (no raylib)
+ *          - expected totals, gantt chart and termination order of every built-in algorithm on `pInfo`
+ *            and on a workload with simultaneous arrivals and idle gaps
+ *          - the corpus of `make corpus` (same generator as tools/genload.c) and random workloads with
+ *            idle gaps are compared with a time unit by time unit reference scheduler
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// standard library
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// user define library
+#include "process.h"
+#include "scheduler.h"
+#include "workload.h"
+
+/**
+ * @brief test_engine.c variable info
+ *
+ *  type        name        pointer     info
+ *  #define     MAX_SEGMENTS n          maximum segments of an expected gantt chart
+ *  #define     ROUNDS      n           random workloads with idle gaps
+ *  Expected    expect      y           expected result of an algorithm on a fixed workload
+ *  RefProcess  rp          y           process of the reference scheduler
+ *  uint64_t    state       n           random number generator state
+ *  int         corpus      y           `count:seed:max gap:max burst:heavy %:max priority` of `make corpus`
+ *  int         gapInfo     y           workload with simultaneous arrivals and idle gaps
+ *
+ */
+
+#define MAX_SEGMENTS    32      // maximum segments of an expected gantt chart
+#define ROUNDS          100     // random workloads with idle gaps
+
+/**
+ * @brief structure for expected result of an algorithm on a fixed workload
+ *
+ */
+typedef struct Expected {
+
+    const char *algo;               // algorithm name
+    Time t;                         // total gantt chart length
+    Time total_turnaround;          // the sum of turnaround
+    Time total_waiting;             // the sum of waiting
+    Time total_response;            // the sum of response
+    int order[8];                   // process no. in order of termination
+    Segment gantt[MAX_SEGMENTS];    // gantt chart segments (start 0 ends the list after the first one)
+
+} Expected;
+
+/**
+ * @brief structure for process of the reference scheduler
+ *
+ */
+typedef struct RefProcess {
+
+    Process p;      // process data
+    bool ready;     // in the ready queue
+    int seq;        // enqueue order
+    long long key;  // ready queue key at enqueue
+    bool responded; // first run done
+
+} RefProcess;
+
+uint64_t state;     // random number generator state
+
+// `make corpus` specs (Makefile CORPUS_SPECS)
+const int corpus[][6] = {
+    {  5,  1,  1,  10,  0,  5 }, { 10,  2,  0,   5,  0,  3 }, { 20,  3,  3,  20, 10,  5 },
+    { 30,  4,  8,  40,  0, 10 }, { 50,  5,  2,  30, 20, 10 }, { 60,  6,  0,   8, 50,  4 },
+    { 90,  7,  1,  15,  0,  3 }, { 90,  8,  5,  50, 30, 20 }, { 90,  9, 20, 100,  5,  8 },
+    { 95, 10,  2,   6, 10,  2 }
+};
+
+// pid, arrival, burst, priority: three arrivals at 0, idle 9 ~ 12, two arrivals at 12, idle 15 ~ 20
+const int gapInfo[][4] = {
+    {0, 0, 3, 2}, {1, 0, 2, 1}, {2, 0, 4, 3}, {3, 12, 2, 1}, {4, 12, 1, 0}, {5, 20, 3, 2}, {6, 21, 1, 1}
+};
+
+// `pInfo`: no idle time, one arrival in each time unit
+const Expected expectInfo[ALGO_COUNT] = {
+    { "FCFS", 62, 192, 130, 130, { 0, 1, 2, 3, 4 }, { {0, 0}, {10, 1}, {38, 2}, {44, 3}, {48, 4} } },
+    { "SJF",  62, 130,  68,  68, { 0, 3, 2, 4, 1 }, { {0, 0}, {10, 3}, {14, 2}, {20, 4}, {34, 1} } },
+    { "HRN",  62, 192, 130, 130, { 0, 1, 2, 3, 4 }, { {0, 0}, {10, 1}, {38, 2}, {44, 3}, {48, 4} } },
+    { "NPP",  62, 174, 112, 112, { 0, 3, 1, 4, 2 }, { {0, 0}, {10, 3}, {14, 1}, {42, 4}, {56, 2} } },
+    { "PP",   62, 195, 133,  83, { 3, 1, 4, 0, 2 }, { {0, 0}, {1, 1}, {3, 3}, {7, 1}, {33, 4}, {47, 0}, {56, 2} } },
+    { "RR",   62, 180, 118,  14, { 3, 2, 0, 4, 1 }, { {0, 0}, {2, 1}, {4, 2}, {6, 0}, {8, 3}, {10, 4}, {12, 1}, {14, 2},
+        {16, 0}, {18, 3}, {20, 4}, {22, 1}, {24, 2}, {26, 0}, {28, 4}, {30, 1}, {32, 0}, {34, 4}, {36, 1}, {38, 4},
+        {40, 1}, {42, 4}, {44, 1}, {46, 4}, {48, 1} } },
+    { "SRT",  62, 125,  63,  49, { 3, 2, 0, 4, 1 }, { {0, 0}, {2, 2}, {3, 3}, {7, 2}, {12, 0}, {20, 4}, {34, 1} } }
+};
+
+// `gapInfo`: ties go to the arrival order, each idle gap is one `IDLE_PID` segment
+const Expected expectGap[ALGO_COUNT] = {
+    { "FCFS", 24, 28, 12, 12, { 0, 1, 2, 3, 4, 5, 6 },
+        { {0, 0}, {3, 1}, {5, 2}, {9, IDLE_PID}, {12, 3}, {14, 4}, {15, IDLE_PID}, {20, 5}, {23, 6} } },
+    { "SJF",  24, 26, 10, 10, { 1, 0, 2, 4, 3, 5, 6 },
+        { {0, 1}, {2, 0}, {5, 2}, {9, IDLE_PID}, {12, 4}, {13, 3}, {15, IDLE_PID}, {20, 5}, {23, 6} } },
+    { "HRN",  24, 28, 12, 12, { 0, 1, 2, 3, 4, 5, 6 },
+        { {0, 0}, {3, 1}, {5, 2}, {9, IDLE_PID}, {12, 3}, {14, 4}, {15, IDLE_PID}, {20, 5}, {23, 6} } },
+    { "NPP",  24, 26, 10, 10, { 1, 0, 2, 4, 3, 5, 6 },
+        { {0, 1}, {2, 0}, {5, 2}, {9, IDLE_PID}, {12, 4}, {13, 3}, {15, IDLE_PID}, {20, 5}, {23, 6} } },
+    { "PP",   24, 25,  9,  8, { 1, 0, 2, 4, 3, 6, 5 },
+        { {0, 1}, {2, 0}, {5, 2}, {9, IDLE_PID}, {12, 4}, {13, 3}, {15, IDLE_PID}, {20, 5}, {21, 6}, {22, 5} } },
+    { "RR",   24, 31, 15,  9, { 1, 0, 2, 3, 4, 6, 5 },
+        { {0, 0}, {2, 1}, {4, 2}, {6, 0}, {7, 2}, {9, IDLE_PID}, {12, 3}, {14, 4}, {15, IDLE_PID}, {20, 5}, {22, 6}, {23, 5} } },
+    { "SRT",  24, 25,  9,  8, { 1, 0, 2, 4, 3, 6, 5 },
+        { {0, 1}, {2, 0}, {5, 2}, {9, IDLE_PID}, {12, 4}, {13, 3}, {15, IDLE_PID}, {20, 5}, {21, 6}, {22, 5} } }
+};
+
+// xorshift64* random number (0 ~ max - 1), same as tools/genload.c
+static int next_random(int max) {
+
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    return (int) ((state * 2685821657736338717ULL) >> 33) % max;
+}
+
+/**
+ * @brief   check the schedule against the expected result
+ *
+ * @param s     pointer for schedule result
+ * @param e     pointer for expected result
+ * @param n     total process count
+ * @param label workload name
+ * @return  int (failure count)
+ */
+static int check_expected(const Schedule *s, const Expected *e, int n, const char *label) {
+
+    long long segments = 1;
+    while(segments < MAX_SEGMENTS && e->gantt[segments].start > 0)
+        segments++;
+
+    if(strcmp(s->algo, e->algo) != 0 || s->n != n || s->t != e->t || s->total_turnaround != e->total_turnaround
+        || s->total_waiting != e->total_waiting || s->total_response != e->total_response) {
+        fprintf(stderr, "FAIL: %s [%s]: t %lld totals %lld/%lld/%lld, expected [%s] t %lld totals %lld/%lld/%lld\n",
+            label, s->algo, s->t, s->total_turnaround, s->total_waiting, s->total_response,
+            e->algo, e->t, e->total_turnaround, e->total_waiting, e->total_response);
+        return 1;
+    }
+
+    if(s->segments != segments) {
+        fprintf(stderr, "FAIL: %s [%s]: %lld segments, expected %lld\n", label, s->algo, s->segments, segments);
+        return 1;
+    }
+    for(long long k = 0; k < segments; k++) {
+        if(s->gantt[k].start != e->gantt[k].start || s->gantt[k].processID != e->gantt[k].processID) {
+            fprintf(stderr, "FAIL: %s [%s]: segment %lld is P%d at %lld, expected P%d at %lld\n",
+                label, s->algo, k, s->gantt[k].processID, s->gantt[k].start, e->gantt[k].processID, e->gantt[k].start);
+            return 1;
+        }
+    }
+
+    for(int i = 0; i < n; i++) {
+        if(s->result[i].processID != e->order[i]) {
+            fprintf(stderr, "FAIL: %s [%s]: terminated process %d is P%d, expected P%d\n",
+                label, s->algo, i, s->result[i].processID, e->order[i]);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+// ready queue key of the reference scheduler (same order as the built-in policies)
+static long long reference_key(int algo, const Process *p) {
+
+    switch(algo) {
+    case 1:  return p->burst;
+    case 2:  return (p->waiting + p->burst) / p->burst;
+    case 3:  return p->priority;
+    case 4:  return (long long) p->priority * ARRIVAL_LIMIT + p->arrival;
+    case 6:  return p->remain;
+    default: return 0;
+    }
+}
+
+// first process of the ready queue: smallest key, then enqueue order (-1 if empty)
+static int reference_first(const RefProcess *rp, int n) {
+
+    int best = -1;
+    for(int i = 0; i < n; i++)
+        if(rp[i].ready && (best < 0 || rp[i].key < rp[best].key || (rp[i].key == rp[best].key && rp[i].seq < rp[best].seq)))
+            best = i;
+    return best;
+}
+
+// append the segment (a segment starting at the same time replaces the previous one)
+static void reference_segment(Schedule *s, Time start, int pid) {
+
+    if(s->segments > 0 && s->gantt[s->segments - 1].start == start)
+        s->segments--;
+    if(s->segments > 0 && s->gantt[s->segments - 1].processID == pid)
+        return;
+    s->gantt[s->segments++] = (Segment) { .start = start, .processID = pid };
+}
+
+/**
+ * @brief   reference scheduler: one time unit for each step, linear scan of the ready queue
+ *          same event order as the engine: arrival, dispatch, preemption or time quantum expiration, run
+ *
+ * @param algo  algorithm index (same as `algoName` array)
+ * @param p     pointer for process structure (sorted by arrival)
+ * @param n     total process count
+ * @param s     pointer for schedule result save (`gantt` and `result` have room for the run)
+ */
+static void reference_run(int algo, const Process *p, int n, Schedule *s) {
+
+    RefProcess *rp = calloc((size_t) n, sizeof(RefProcess));
+    int next = 0, cur = -1, seq = 0, terminate = 0;
+    Time time = 0;
+
+    for(int i = 0; i < n; i++)
+        rp[i].p = p[i];
+
+    while(terminate < n) {
+        for(; next < n && rp[next].p.arrival <= time; next++)
+            rp[next] = (RefProcess) { .p = rp[next].p, .ready = true, .seq = seq++, .key = reference_key(algo, &rp[next].p) };
+
+        if(cur < 0 && reference_first(rp, n) < 0) {
+            reference_segment(s, time, IDLE_PID);
+            time = rp[next].p.arrival;
+            continue;
+        }
+
+        if(cur < 0) {
+            cur = reference_first(rp, n);
+            rp[cur].ready      = false;
+            rp[cur].p.waiting  = time - rp[cur].p.timeout;
+            s->total_waiting  += rp[cur].p.waiting;
+            rp[cur].p.execute  = 0;
+            reference_segment(s, time, rp[cur].p.processID);
+        }
+
+        int first = reference_first(rp, n);
+        bool timeout = false;
+        if(first >= 0 && algo == 4)
+            timeout = rp[first].p.priority < rp[cur].p.priority;
+        if(first >= 0 && algo == 6)
+            timeout = rp[first].p.remain < rp[cur].p.remain;
+        if(!timeout && algo == 5 && rp[cur].p.execute == QAUNTUM) {
+            timeout = true;
+            first   = -1;
+        }
+        if(timeout) {
+            rp[cur].p.timeout    = time;
+            s->total_turnaround += rp[cur].p.execute + rp[cur].p.waiting;
+            rp[cur].ready        = true;
+            rp[cur].seq          = seq++;
+            rp[cur].key          = reference_key(algo, &rp[cur].p);
+            cur = first >= 0 ? first : reference_first(rp, n);
+            rp[cur].ready      = false;
+            rp[cur].p.waiting  = time - rp[cur].p.timeout;
+            s->total_waiting  += rp[cur].p.waiting;
+            rp[cur].p.execute  = 0;
+            reference_segment(s, time, rp[cur].p.processID);
+        }
+
+        if(!rp[cur].responded) {
+            rp[cur].responded  = true;
+            s->total_response += time - rp[cur].p.arrival;
+        }
+
+        time++;
+        rp[cur].p.remain--;
+        rp[cur].p.execute++;
+        if(rp[cur].p.remain == 0) {
+            s->total_turnaround  += rp[cur].p.execute + rp[cur].p.waiting;
+            s->result[terminate++] = rp[cur].p;
+            cur = -1;
+        }
+    }
+
+    s->n = n;
+    s->t = time;
+    free(rp);
+}
+
+/**
+ * @brief   compare every built-in algorithm with the reference scheduler
+ *
+ * @param p     pointer for process structure (sorted by arrival)
+ * @param n     total process count
+ * @param t     total burst time
+ * @param label workload name
+ * @return  int (failure count)
+ */
+static int check_reference(const Process *p, int n, Time t, const char *label) {
+
+    int failed = 0;
+    Process *work = malloc(sizeof(Process) * n);
+
+    for(int algo = 0; algo < ALGO_COUNT && failed == 0; algo++) {
+        Schedule s = { 0 };
+        Schedule ref = { .algo = algoName[algo], .result = malloc(sizeof(Process) * n), .gantt = malloc(sizeof(Segment) * (2 * (size_t) n + 2 + (size_t) t)) };
+
+        memcpy(work, p, sizeof(Process) * n);
+        run_algorithm(algo, work, n, t, &s);
+        reference_run(algo, p, n, &ref);
+
+        if(s.n != ref.n || s.t != ref.t || s.segments != ref.segments || s.total_turnaround != ref.total_turnaround
+            || s.total_waiting != ref.total_waiting || s.total_response != ref.total_response) {
+            fprintf(stderr, "FAIL: %s [%s]: t %lld segments %lld totals %lld/%lld/%lld, reference t %lld segments %lld totals %lld/%lld/%lld\n",
+                label, algoName[algo], s.t, s.segments, s.total_turnaround, s.total_waiting, s.total_response,
+                ref.t, ref.segments, ref.total_turnaround, ref.total_waiting, ref.total_response);
+            failed++;
+        }
+        for(long long k = 0; k < ref.segments && failed == 0; k++) {
+            if(s.gantt[k].start != ref.gantt[k].start || s.gantt[k].processID != ref.gantt[k].processID) {
+                fprintf(stderr, "FAIL: %s [%s]: segment %lld is P%d at %lld, reference P%d at %lld\n",
+                    label, algoName[algo], k, s.gantt[k].processID, s.gantt[k].start, ref.gantt[k].processID, ref.gantt[k].start);
+                failed++;
+            }
+        }
+        for(int i = 0; i < n && failed == 0; i++) {
+            if(s.result[i].processID != ref.result[i].processID || s.result[i].waiting != ref.result[i].waiting) {
+                fprintf(stderr, "FAIL: %s [%s]: terminated process %d is P%d, reference P%d\n",
+                    label, algoName[algo], i, s.result[i].processID, ref.result[i].processID);
+                failed++;
+            }
+        }
+
+        free_schedule(&s);
+        free(ref.result);
+        free(ref.gantt);
+    }
+
+    free(work);
+    return failed;
+}
+
+// run every built-in algorithm on the fixed workload and check the expected results
+static int check_fixed(const int (*info)[4], int n, const Expected *expect, const char *label) {
+
+    Process p[8];
+    Time t = 0;
+    int failed = 0;
+
+    for(int algo = 0; algo < ALGO_COUNT; algo++) {
+        Schedule s = { 0 };
+        for(int i = 0; i < n; i++)
+            init_process(&p[i], info[i][0], info[i][1], info[i][2], info[i][3]);
+        t = 0;
+        for(int i = 0; i < n; i++)
+            t += p[i].burst;
+        run_algorithm(algo, p, n, t, &s);
+        failed += check_expected(&s, &expect[algo], n, label);
+        free_schedule(&s);
+    }
+
+    for(int i = 0; i < n; i++)
+        init_process(&p[i], info[i][0], info[i][1], info[i][2], info[i][3]);
+    return failed + check_reference(p, n, t, label);
+}
+
+int main(void) {
+
+    int failed = 0;
+    char label[64];
+
+    failed += check_fixed((const int (*)[4]) pInfo, P_COUNT, expectInfo, "pInfo");
+    failed += check_fixed(gapInfo, sizeof(gapInfo) / sizeof(gapInfo[0]), expectGap, "simultaneous arrivals and idle gaps");
+
+    // corpus of `make corpus`: distinct arrivals, the CPU never idles
+    for(size_t c = 0; c < sizeof(corpus) / sizeof(corpus[0]); c++) {
+        const int *spec = corpus[c];
+        Process *p = malloc(sizeof(Process) * spec[0]);
+        Time t = 0;
+
+        state = (uint64_t) spec[1] * 0x9e3779b97f4a7c15ULL + 1;
+        for(int i = 0, arrival = 0, busy = 0; i < spec[0]; i++) {
+            int b = 1 + next_random(spec[3]);
+            if(next_random(100) < spec[4])
+                b *= 10;
+            init_process(&p[i], i, arrival, b, 1 + next_random(spec[5]));
+            busy += b;
+            t    += b;
+            arrival += 1 + next_random(spec[2] + 1);
+            if(arrival > busy)
+                arrival = busy;
+        }
+
+        snprintf(label, sizeof(label), "corpus %d:%d:%d:%d:%d:%d", spec[0], spec[1], spec[2], spec[3], spec[4], spec[5]);
+        failed += check_reference(p, spec[0], t, label);
+        free(p);
+    }
+
+    // random workloads: simultaneous arrivals, idle gaps, equal bursts and priorities
+    state = 12345;
+    for(int round = 0; round < ROUNDS; round++) {
+        int n = 1 + next_random(60);
+        Process *p = malloc(sizeof(Process) * n);
+        Time t = 0, arrival = 0;
+
+        for(int i = 0; i < n; i++) {
+            Time burst = 1 + next_random(round % 2 ? 4 : 20);
+            if(next_random(3) > 0)
+                arrival += next_random(round % 3 == 0 ? 40 : 8);
+            init_process(&p[i], i, arrival, burst, next_random(4));
+            t += burst;
+        }
+
+        snprintf(label, sizeof(label), "random workload %d", round);
+        failed += check_reference(p, n, t, label);
+        free(p);
+    }
+
+    if(failed == 0)
+        printf("engine: all passed\n");
+    return failed > 0;
+}
@@ -0,0 +1,127 @@
+/**
+ * @file    test_radix.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   test of the radix sort of libcpusched (no raylib)
+ *          - arrivals above 2^32 (every digit of the 64-bit arrival), negative arrivals and ties
+ *          - result of `sort_by_arrival()` with 1 ~ 4 threads is compared with a stable reference sort
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// standard library
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// user define library
+#include "process.h"
+#include "radix.h"
+#include "workload.h"
+
+/**
+ * @brief test_radix.c variable info
+ *
+ *  type        name        pointer     info
+ *  #define     ROUNDS      n           random workloads of each size
+ *  uint64_t    state       n           random number generator state
+ *  Process     p           y           workload sorted by `sort_by_arrival()`
+ *  Process     ref         y           same workload sorted by the reference sort
+ *
+ */
+
+#define ROUNDS  200     // random workloads of each size
+
+uint64_t state = 1;     // random number generator state
+
+// xorshift64* random number
+static uint64_t next_random(void) {
+
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    return state * 2685821657736338717ULL;
+}
+
+// stable reference: arrival, then process no. (input order of the test workloads)
+static int compare_reference(const void *a, const void *b) {
+
+    const Process *x = a, *y = b;
+    if(x->arrival != y->arrival)
+        return x->arrival < y->arrival ? -1 : 1;
+    return x->processID - y->processID;
+}
+
+/**
+ * @brief   sort the workload with each thread count and compare with the reference
+ *
+ * @param p     pointer for process structure (process no. is the input order)
+ * @param n     total process count
+ * @param label test name
+ * @return  int (failure count)
+ */
+static int check_sort(const Process *p, int n, const char *label) {
+
+    Process *ref  = malloc(sizeof(Process) * n);
+    Process *work = malloc(sizeof(Process) * n);
+    int failed    = 0;
+
+    memcpy(ref, p, sizeof(Process) * n);
+    qsort(ref, n, sizeof(Process), compare_reference);
+
+    for(int threads = 1; threads <= 4; threads++) {
+        memcpy(work, p, sizeof(Process) * n);
+        sort_by_arrival(work, n, threads);
+        for(int i = 0; i < n; i++) {
+            if(work[i].processID != ref[i].processID || work[i].arrival != ref[i].arrival) {
+                fprintf(stderr, "FAIL: %s (%d threads): index %d is P%d (arrival %lld), expected P%d (arrival %lld)\n",
+                    label, threads, i, work[i].processID, work[i].arrival, ref[i].processID, ref[i].arrival);
+                failed++;
+                break;
+            }
+        }
+    }
+
+    free(ref);
+    free(work);
+    return failed;
+}
+
+int main(void) {
+
+    int failed = 0;
+
+    // arrivals above 2^32: a 32-bit key put 4294967296 before 5
+    Time big[] = { 4294967296LL, 5, 3, 8589934592LL, 4294967295LL, 3, 0x7fffffffffffffffLL, 0, 4294967296LL };
+    int n = sizeof(big) / sizeof(big[0]);
+    Process fixed[sizeof(big) / sizeof(big[0])];
+    for(int i = 0; i < n; i++)
+        init_process(&fixed[i], i, big[i], 1, 0);
+    failed += check_sort(fixed, n, "arrivals above 2^32");
+
+    // random arrivals on every digit, a few distinct values for ties, negative values
+    const int size[] = { 2, 17, 1000, 5000 };
+    for(int s = 0; s < 4; s++) {
+        Process *p = malloc(sizeof(Process) * size[s]);
+        for(int round = 0; round < ROUNDS / (s + 1); round++) {
+            int bits = 1 + (int) (next_random() % 63);
+            for(int i = 0; i < size[s]; i++) {
+                Time arrival = (Time) (next_random() >> (64 - bits));
+                if(round % 4 == 1)
+                    arrival = (Time) (next_random() % 4) << 33;
+                if(round % 4 == 2)
+                    arrival = (Time) next_random();
+                init_process(&p[i], i, arrival, 1, 0);
+            }
+            failed += check_sort(p, size[s], "random arrivals");
+        }
+        free(p);
+    }
+
+    if(failed == 0)
+        printf("radix: all passed\n");
+    return failed > 0;
+}
@@ -0,0 +1,327 @@
+/**
+ * @file    test_results.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   test of the results file codec of libcpusched (no raylib)
+ *          - `save_results()` then `open_results()` / `load_results()` gives the same schedule
+ *          - block delta varint columns, segment blocks and the time index across block boundaries
+ *          - truncated files and bad headers are rejected
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// standard library
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// user define library
+#include "process.h"
+#include "results.h"
+#include "scheduler.h"
+#include "workload.h"
+
+/**
+ * @brief test_results.c variable info
+ *
+ *  type        name        pointer     info
+ *  #define     RESULTS_FILE n          results file of the test (removed at the end)
+ *  #define     TEST_N      n           process count of the test workload
+ *  uint64_t    state       n           random number generator state
+ *  Schedule    s           y           schedule written to the results file
+ *  long long   expect      y           expected values of a column
+ *
+ */
+
+#define RESULTS_FILE    "test_results.cpsr"    // results file of the test (removed at the end)
+#define TEST_N          5000                    // process count of the test workload
+
+uint64_t state = 3;     // random number generator state
+
+// xorshift64* random number
+static uint64_t next_random(void) {
+
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    return state * 2685821657736338717ULL;
+}
+
+// read the whole file (NULL if it does not exist)
+static unsigned char* read_file(const char *fileName, long *size) {
+
+    FILE *fp = fopen(fileName, "rb");
+    if(fp == NULL)
+        return NULL;
+
+    fseek(fp, 0, SEEK_END);
+    *size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    unsigned char *data = malloc(*size > 0 ? (size_t) *size : 1);
+    if(data != NULL && fread(data, 1, (size_t) *size, fp) != (size_t) *size) {
+        free(data);
+        data = NULL;
+    }
+    fclose(fp);
+    return data;
+}
+
+// replace the whole file
+static void write_file(const char *fileName, const unsigned char *data, long size) {
+
+    FILE *fp = fopen(fileName, "wb");
+    if(fp == NULL)
+        return;
+    fwrite(data, 1, (size_t) size, fp);
+    fclose(fp);
+}
+
+/**
+ * @brief   expected values of the column, computed from the schedule
+ *
+ * @param s         pointer for schedule structure
+ * @param column    column no.
+ * @param out       array for values (row count of the column)
+ */
+static void expected_column(const Schedule *s, int column, long long *out) {
+
+    if(column >= RESULTS_SEG_START) {
+        for(long long k = 0; k < s->segments; k++)
+            out[k] = column == RESULTS_SEG_START ? s->gantt[k].start : s->gantt[k].processID;
+        return;
+    }
+
+    for(int i = 0; i < s->n; i++) {
+        const Process *p = &s->result[i];
+        long long first = -1, last = 0;
+        for(long long k = 0; k < s->segments; k++) {
+            if(s->gantt[k].processID != p->processID)
+                continue;
+            if(first < 0)
+                first = s->gantt[k].start;
+            last = segment_end(s, k);
+        }
+        switch(column) {
+        case RESULTS_PID:        out[i] = p->processID;        break;
+        case RESULTS_PRIORITY:   out[i] = p->priority;         break;
+        case RESULTS_ARRIVAL:    out[i] = p->arrival;          break;
+        case RESULTS_BURST:      out[i] = p->burst;            break;
+        case RESULTS_WAITING:    out[i] = p->waiting;          break;
+        case RESULTS_TIMEOUT:    out[i] = p->timeout;          break;
+        case RESULTS_EXECUTE:    out[i] = p->execute;          break;
+        case RESULTS_COMPLETION: out[i] = last;                break;
+        case RESULTS_RESPONSE:   out[i] = first - p->arrival;  break;
+        }
+    }
+}
+
+/**
+ * @brief   save the schedule, read it back through every reader and compare
+ *
+ * @param s     pointer for schedule structure
+ * @return  int (failure count)
+ */
+static int check_round_trip(const Schedule *s) {
+
+    ResultsFile r;
+    int failed = 0;
+
+    if(!save_results(RESULTS_FILE, s) || !open_results(RESULTS_FILE, &r)) {
+        fprintf(stderr, "FAIL: [%s] results file not written or not opened\n", s->algo);
+        return 1;
+    }
+
+    if(strcmp(r.algo, s->algo) != 0 || r.n != s->n || r.t != s->t || r.segments != s->segments
+        || r.total_turnaround != s->total_turnaround || r.total_waiting != s->total_waiting || r.total_response != s->total_response) {
+        fprintf(stderr, "FAIL: [%s] header: %s n %d t %lld segments %lld totals %lld/%lld/%lld\n",
+            s->algo, r.algo, r.n, r.t, r.segments, r.total_turnaround, r.total_waiting, r.total_response);
+        close_results(&r);
+        return 1;
+    }
+
+    // every column: whole column, range and a window across the first block boundary
+    long long *expect = malloc(sizeof(long long) * ((size_t) (s->segments > s->n ? s->segments : s->n) + 1));
+    long long *got    = malloc(sizeof(long long) * ((size_t) (s->segments > s->n ? s->segments : s->n) + 1));
+    for(int c = 0; c < RESULTS_COLUMNS && failed == 0; c++) {
+        long long rows = c < RESULTS_SEG_START ? s->n : s->segments;
+        long long min = 0, max = 0, lo = 0, hi = 0;
+
+        expected_column(s, c, expect);
+        if(read_column(&r, c, 0, rows, got) != rows || memcmp(got, expect, sizeof(long long) * rows) != 0) {
+            fprintf(stderr, "FAIL: [%s] column %s differs\n", s->algo, resultsColumn[c]);
+            failed++;
+        }
+
+        for(long long i = 0; i < rows; i++) {
+            lo = i == 0 || expect[i] < lo ? expect[i] : lo;
+            hi = i == 0 || expect[i] > hi ? expect[i] : hi;
+        }
+        if(column_range(&r, c, &min, &max) != rows || (rows > 0 && (min != lo || max != hi))) {
+            fprintf(stderr, "FAIL: [%s] column %s range %lld ~ %lld, expected %lld ~ %lld\n", s->algo, resultsColumn[c], min, max, lo, hi);
+            failed++;
+        }
+
+        long long first = RESULTS_BLOCK - 7, count = 300;
+        if(rows > first + count && (read_column(&r, c, first, count, got) != count || memcmp(got, expect + first, sizeof(long long) * count) != 0)) {
+            fprintf(stderr, "FAIL: [%s] column %s rows %lld ~ %lld across the block boundary differ\n", s->algo, resultsColumn[c], first, first + count);
+            failed++;
+        }
+    }
+
+    // time index: every time unit of a few segments on each side of each block boundary
+    for(long long k = 0; k < s->segments && failed == 0; k++) {
+        if(k % RESULTS_BLOCK > 2 && k % RESULTS_BLOCK < RESULTS_BLOCK - 3 && k % 97 != 0)
+            continue;
+        for(Time time = s->gantt[k].start; time < segment_end(s, k) && failed == 0; time++) {
+            if(find_segment(&r, time) != k) {
+                fprintf(stderr, "FAIL: [%s] time %lld found in segment %lld, expected %lld\n", s->algo, time, find_segment(&r, time), k);
+                failed++;
+            }
+        }
+    }
+    if(find_segment(&r, -1) != -1 || find_segment(&r, s->t) != -1) {
+        fprintf(stderr, "FAIL: [%s] time out of the gantt chart found\n", s->algo);
+        failed++;
+    }
+
+    // segments across the block boundary
+    if(s->segments > RESULTS_BLOCK + 10) {
+        ResultsSegment seg[20];
+        long long first = RESULTS_BLOCK - 10;
+        if(read_segments(&r, first, 20, seg) != 20)
+            failed++;
+        for(int i = 0; i < 20 && failed == 0; i++) {
+            if(seg[i].start != s->gantt[first + i].start || seg[i].pid != s->gantt[first + i].processID
+                || seg[i].length != segment_end(s, first + i) - s->gantt[first + i].start) {
+                fprintf(stderr, "FAIL: [%s] segment %lld differs\n", s->algo, first + i);
+                failed++;
+            }
+        }
+    }
+
+    free(expect);
+    free(got);
+    close_results(&r);
+
+    // whole schedule
+    Schedule back = { 0 };
+    if(!load_results(RESULTS_FILE, &back)) {
+        fprintf(stderr, "FAIL: [%s] results file not loaded\n", s->algo);
+        return failed + 1;
+    }
+    if(strcmp(back.algo, s->algo) != 0 || back.n != s->n || back.t != s->t || back.segments != s->segments
+        || back.total_turnaround != s->total_turnaround || back.total_waiting != s->total_waiting || back.total_response != s->total_response) {
+        fprintf(stderr, "FAIL: [%s] loaded schedule differs\n", s->algo);
+        failed++;
+    }
+    for(long long k = 0; k < s->segments && failed == 0; k++) {
+        if(back.gantt[k].start != s->gantt[k].start || back.gantt[k].processID != s->gantt[k].processID) {
+            fprintf(stderr, "FAIL: [%s] loaded segment %lld differs\n", s->algo, k);
+            failed++;
+        }
+    }
+    for(int i = 0; i < s->n && failed == 0; i++) {
+        const Process *a = &back.result[i], *b = &s->result[i];
+        if(a->processID != b->processID || a->priority != b->priority || a->arrival != b->arrival || a->burst != b->burst
+            || a->waiting != b->waiting || a->timeout != b->timeout || a->execute != b->execute) {
+            fprintf(stderr, "FAIL: [%s] loaded process %d differs\n", s->algo, i);
+            failed++;
+        }
+    }
+    free_schedule(&back);
+
+    return failed;
+}
+
+/**
+ * @brief   the damaged results file must be rejected by `open_results()` and `load_results()`
+ *
+ * @param data  file contents
+ * @param size  file size
+ * @param label damage name
+ * @return  int (failure count)
+ */
+static int check_rejected(const unsigned char *data, long size, const char *label) {
+
+    ResultsFile r;
+    Schedule s = { 0 };
+
+    write_file(RESULTS_FILE, data, size);
+    if(open_results(RESULTS_FILE, &r)) {
+        fprintf(stderr, "FAIL: %s: opened\n", label);
+        close_results(&r);
+        return 1;
+    }
+    if(load_results(RESULTS_FILE, &s)) {
+        fprintf(stderr, "FAIL: %s: loaded\n", label);
+        free_schedule(&s);
+        return 1;
+    }
+    return 0;
+}
+
+int main(void) {
+
+    Process *p = malloc(sizeof(Process) * TEST_N);
+    Time t = 0, arrival = 0;
+    int failed = 0;
+
+    // sparse process no., idle gaps and simultaneous arrivals, RR gives more than two segment blocks
+    for(int i = 0; i < TEST_N; i++) {
+        Time burst = 1 + (Time) (next_random() % 20);
+        arrival += (Time) (next_random() % 3 == 0 ? 0 : next_random() % 30);
+        init_process(&p[i], i * 7 + 3, arrival, burst, (int) (next_random() % 9) - 4);
+        t += burst;
+    }
+
+    for(int algo = 0; algo < ALGO_COUNT; algo++) {
+        Schedule s = { 0 };
+        run_algorithm(algo, p, TEST_N, t, &s);
+        failed += check_round_trip(&s);
+        free_schedule(&s);
+    }
+
+    // `pInfo`: one block for every column
+    int n;
+    Process *info = default_workload(&n, &t);
+    Schedule s = { 0 };
+    run_algorithm(4, info, n, t, &s);
+    failed += check_round_trip(&s);
+    free(info);
+
+    // damaged files
+    long size = 0;
+    save_results(RESULTS_FILE, &s);
+    unsigned char *data = read_file(RESULTS_FILE, &size);
+    unsigned char *bad  = malloc((size_t) size);
+    free_schedule(&s);
+
+    const long cut[] = { 0, 3, 64, 127, 128 + 56 * 5, size / 2, size - 1 };
+    for(size_t i = 0; i < sizeof(cut) / sizeof(cut[0]); i++) {
+        char label[64];
+        snprintf(label, sizeof(label), "truncated to %ld of %ld bytes", cut[i], size);
+        failed += check_rejected(data, cut[i], label);
+    }
+
+    // header: magic, version, block rows, segment count above the chart length
+    const struct { int at; unsigned char value; const char *label; } damage[] = {
+        { 0, 'X', "bad magic" }, { 4, RESULTS_VERSION + 1, "bad version" }, { 13, 0x7f, "bad block rows" }, { 39, 0x7f, "bad segment count" }
+    };
+    for(size_t i = 0; i < sizeof(damage) / sizeof(damage[0]); i++) {
+        memcpy(bad, data, (size_t) size);
+        bad[damage[i].at] = damage[i].value;
+        failed += check_rejected(bad, size, damage[i].label);
+    }
+
+    free(data);
+    free(bad);
+    free(p);
+    remove(RESULTS_FILE);
+
+    if(failed == 0)
+        printf("results: all passed\n");
+    return failed > 0;
+}
@@ -0,0 +1,213 @@
+/**
+ * @file    test_workload.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   test of the workload file codec of libcpusched (no raylib)
+ *          - `save_workload()` then `load_workload()` gives the same processes (text and binary)
+ *          - streaming `read_process()` reads the binary file in file order
+ *          - truncated binary files and bad headers are rejected
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// standard library
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// user define library
+#include "process.h"
+#include "workload.h"
+
+/**
+ * @brief test_workload.c variable info
+ *
+ *  type        name            pointer     info
+ *  #define     WORKLOAD_FILE   n           workload file of the test (removed at the end)
+ *  #define     TEST_N          n           process count of the test workload
+ *  uint64_t    state           n           random number generator state
+ *  Process     p               y           test workload (sorted by arrival)
+ *
+ */
+
+#define WORKLOAD_FILE   "test_workload.cpsw"   // workload file of the test (removed at the end)
+#define TEST_N          2000                    // process count of the test workload
+
+uint64_t state = 11;    // random number generator state
+
+// xorshift64* random number
+static uint64_t next_random(void) {
+
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    return state * 2685821657736338717ULL;
+}
+
+// read the whole file (NULL if it does not exist)
+static unsigned char* read_file(const char *fileName, long *size) {
+
+    FILE *fp = fopen(fileName, "rb");
+    if(fp == NULL)
+        return NULL;
+
+    fseek(fp, 0, SEEK_END);
+    *size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    unsigned char *data = malloc(*size > 0 ? (size_t) *size : 1);
+    if(data != NULL && fread(data, 1, (size_t) *size, fp) != (size_t) *size) {
+        free(data);
+        data = NULL;
+    }
+    fclose(fp);
+    return data;
+}
+
+// replace the whole file
+static void write_file(const char *fileName, const unsigned char *data, long size) {
+
+    FILE *fp = fopen(fileName, "wb");
+    if(fp == NULL)
+        return;
+    fwrite(data, 1, (size_t) size, fp);
+    fclose(fp);
+}
+
+// same process data (the fields of the workload file)
+static bool same_process(const Process *a, const Process *b) {
+
+    return a->processID == b->processID && a->arrival == b->arrival && a->burst == b->burst && a->priority == b->priority
+        && a->remain == b->burst && a->timeout == b->arrival && a->waiting == 0 && a->execute == 0;
+}
+
+/**
+ * @brief   save the workload, load it back and compare
+ *
+ * @param p         pointer for process structure (sorted by arrival)
+ * @param n         total process count
+ * @param binary    binary workload file instead of text
+ * @return  int (failure count)
+ */
+static int check_round_trip(const Process *p, int n, bool binary) {
+
+    const char *label = binary ? "binary" : "text";
+    Time total = 0;
+    int count  = 0;
+
+    for(int i = 0; i < n; i++)
+        total += p[i].burst;
+
+    if(!save_workload(WORKLOAD_FILE, p, n, binary)) {
+        fprintf(stderr, "FAIL: %s: workload file not written\n", label);
+        return 1;
+    }
+
+    Time t  = 0;
+    Process *back = load_workload(WORKLOAD_FILE, &count, &t);
+    if(back == NULL || count != n || t != total) {
+        fprintf(stderr, "FAIL: %s: %d processes (total burst %lld) loaded, expected %d (%lld)\n", label, back ? count : -1, t, n, total);
+        free(back);
+        return 1;
+    }
+
+    int failed = 0;
+    for(int i = 0; i < n && failed == 0; i++) {
+        if(!same_process(&back[i], &p[i])) {
+            fprintf(stderr, "FAIL: %s: process %d is P%d (arrival %lld, burst %lld, priority %d), expected P%d (%lld, %lld, %d)\n",
+                label, i, back[i].processID, back[i].arrival, back[i].burst, back[i].priority,
+                p[i].processID, p[i].arrival, p[i].burst, p[i].priority);
+            failed++;
+        }
+    }
+    free(back);
+
+    // streaming reader: file order
+    FILE *fp = fopen(WORKLOAD_FILE, "rb");
+    WorkloadReader rd;
+    Process q;
+    int read = 0;
+    if(fp == NULL || !begin_read_workload(&rd, fp, WORKLOAD_FILE)) {
+        fprintf(stderr, "FAIL: %s: streaming reader not started\n", label);
+        failed++;
+    }
+    else {
+        while(read_process(&rd, &q) && read < n && same_process(&q, &p[read]))
+            read++;
+        if(read != n) {
+            fprintf(stderr, "FAIL: %s: streaming reader stopped at process %d of %d\n", label, read, n);
+            failed++;
+        }
+    }
+    if(fp != NULL)
+        fclose(fp);
+
+    return failed;
+}
+
+// the damaged workload file must be rejected by `load_workload()`
+static int check_rejected(const unsigned char *data, long size, const char *label) {
+
+    int n;
+    Time t;
+
+    write_file(WORKLOAD_FILE, data, size);
+    Process *p = load_workload(WORKLOAD_FILE, &n, &t);
+    if(p != NULL) {
+        fprintf(stderr, "FAIL: %s: %d processes loaded\n", label, n);
+        free(p);
+        return 1;
+    }
+    return 0;
+}
+
+int main(void) {
+
+    Process p[TEST_N];
+    Time arrival = 0;
+    int failed = 0;
+
+    // sparse process no. up to `INT_MAX` (negative deltas), ties, large arrivals, priorities at both limits
+    for(int i = 0; i < TEST_N; i++) {
+        if(next_random() % 4 != 0)
+            arrival += (Time) (next_random() % (i % 50 == 0 ? 10000000000ULL : 100));
+        int pid      = i == TEST_N - 1 ? INT_MAX : (int) (next_random() % 1000000) * TEST_N + i;
+        int priority = i == 1 ? -PRIORITY_LIMIT : i == 2 ? PRIORITY_LIMIT - 1 : (int) (next_random() % 21) - 10;
+        init_process(&p[i], pid, arrival, 1 + (Time) (next_random() % 1000), priority);
+    }
+    if(p[TEST_N - 1].arrival >= ARRIVAL_LIMIT) {
+        fprintf(stderr, "FAIL: test workload arrival out of range\n");
+        return 1;
+    }
+
+    failed += check_round_trip(p, TEST_N, false);
+    failed += check_round_trip(p, TEST_N, true);
+
+    // damaged binary files
+    long size = 0;
+    save_workload(WORKLOAD_FILE, p, TEST_N, true);
+    unsigned char *data = read_file(WORKLOAD_FILE, &size);
+
+    const long cut[] = { 4, 5, 6, size / 2, size - 1 };
+    for(size_t i = 0; i < sizeof(cut) / sizeof(cut[0]); i++) {
+        char label[64];
+        snprintf(label, sizeof(label), "truncated to %ld of %ld bytes", cut[i], size);
+        failed += check_rejected(data, cut[i], label);
+    }
+
+    data[4] = 0x7f;
+    failed += check_rejected(data, size, "bad version");
+    data[4] = 1;
+    data[0] = 'X';
+    failed += check_rejected(data, size, "bad magic");
+
+    free(data);
+    remove(WORKLOAD_FILE);
+
+    if(failed == 0)
+        printf("workload: all passed\n");
+    return failed > 0;
+}
@@ -0,0 +1,192 @@
+/**
+ * @file    batchsim.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   throughput of the batched engine for libcpusched (no raylib)
+ *          - usage: batchsim [--algo NAME] [--count N] [--quantum Q] [--isa NAME] [--seed S] [workload]
+ *          - `count` workloads of the size of the given one (built-in `pInfo` if no file is given):
+ *            the first is the workload itself, each other one has random arrival 0 ~ 2 * arrival and
+ *            burst 1 ~ 2 * burst of each process
+ *          - workloads per second of the ordinary engine and of each instruction set of `run_batch()`,
+ *            the result of every workload is checked against the ordinary engine
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// standard library
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// user define library
+#include "cpusched.h"
+
+/**
+ * @brief batchsim.c variable info
+ *
+ *  type            name        pointer     info
+ *  #define         COUNT       n           default workload count
+ *  uint64_t        state       n           random number generator state
+ *  Process         w           y           every workload, one after another
+ *  BatchResult     engine      y           sums of each workload by the ordinary engine
+ *  BatchResult     out         y           sums of each workload by the batched engine
+ *  int             rr          n           index of RR (the only algorithm given the time quantum)
+ *
+ */
+
+#define COUNT   1000000 // default workload count
+
+uint64_t state; // random number generator state
+
+/**
+ * @brief   present time of monotonic clock
+ *
+ * @return  double (second)
+ */
+double now(void) {
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief   xorshift64* random number, platform independent unlike `rand()`
+ *
+ * @param max   upper bound (exclusive)
+ * @return  long long (0 ~ max - 1)
+ */
+long long next_random(long long max) {
+
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    return (long long) ((state * 2685821657736338717ULL) >> 11) % max;
+}
+
+int main(int argc, char *argv[]) {
+
+    const char *input = NULL;
+    int algo  = -1;
+    int count = COUNT;
+    int q     = QAUNTUM;
+    int isa   = -1;
+    int n     = 0;
+    Time t    = 0;
+    state     = 1;
+
+    for(int i = 1; i < argc; i++) {
+        if(strcmp(argv[i], "--algo") == 0 && i + 1 < argc) {
+            if((algo = find_algorithm(argv[++i])) < 0) {
+                fprintf(stderr, "unknown algorithm `%s`\n", argv[i]);
+                return 1;
+            }
+        }
+        else if(strcmp(argv[i], "--isa") == 0 && i + 1 < argc) {
+            for(isa = BATCH_ISAS - 1; isa >= 0 && strcmp(batchIsaName[isa], argv[i + 1]) != 0; isa--);
+            if(isa < 0) {
+                fprintf(stderr, "unknown instruction set `%s`\n", argv[i + 1]);
+                return 1;
+            }
+            i++;
+        }
+        else if(strcmp(argv[i], "--count") == 0 && i + 1 < argc)
+            count = atoi(argv[++i]);
+        else if(strcmp(argv[i], "--quantum") == 0 && i + 1 < argc)
+            q = atoi(argv[++i]);
+        else if(strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+            state = strtoull(argv[++i], NULL, 10) | 1;
+        else if(argv[i][0] == '-') {
+            fprintf(stderr, "usage: batchsim [--algo NAME] [--count N] [--quantum Q] [--isa NAME] [--seed S] [workload]\n");
+            return 1;
+        }
+        else
+            input = argv[i];
+    }
+
+    Process *p = input != NULL ? load_workload(input, &n, &t) : default_workload(&n, &t);
+    if(p == NULL)
+        return 1;
+    if(n < 1 || n > BATCH_MAX_PROCESS) {
+        fprintf(stderr, "batchsim: 1 ~ %d processes (workload has %d)\n", BATCH_MAX_PROCESS, n);
+        free(p);
+        return 1;
+    }
+    if(count < 1) count = 1;
+    if(q < 1) q = QAUNTUM;
+    if(isa == BATCH_AUTO)
+        isa = batch_lanes(BATCH_AUTO) == 16 ? BATCH_AVX512 : batch_supported(BATCH_AVX2) ? BATCH_AVX2 : BATCH_GENERIC;
+
+    // random workloads around the given one
+    Process *w = malloc(sizeof(Process) * n * count);
+    for(int k = 0; k < count; k++) {
+        for(int i = 0; i < n; i++) {
+            Time arrival = k == 0 ? p[i].arrival : next_random(2 * p[i].arrival + 1);
+            Time burst   = k == 0 ? p[i].burst : 1 + next_random(2 * p[i].burst);
+            init_process(&w[(size_t) k * n + i], p[i].processID, arrival, burst, p[i].priority);
+        }
+    }
+
+    BatchResult *engine = malloc(sizeof(BatchResult) * count);
+    BatchResult *out    = malloc(sizeof(BatchResult) * count);
+    int rr = find_algorithm("RR");
+    printf("%d workloads of %d processes, %d lanes at most\n", count, n, batch_lanes(BATCH_AUTO));
+    printf("%-5s %-8s %6s %14s %9s %10s %12s\n", "algo", "engine", "lanes", "workloads/s", "speedup", "mismatch", "avg wait");
+
+    for(int k = 0; k < ALGO_COUNT; k++) {
+        // preemptive by priority or remain time: not in the batched engine
+        if((algo >= 0 && k != algo) || !run_batch(k, w, n, 0, q, BATCH_GENERIC, out))
+            continue;
+
+        // ordinary engine: one schedule for each workload
+        double start = now();
+        for(int i = 0; i < count; i++) {
+            Schedule s = { 0 };
+            Time total = 0;
+            for(int j = 0; j < n; j++)
+                total += w[(size_t) i * n + j].burst;
+            if(k == rr)
+                RR(&w[(size_t) i * n], n, total, q, &s);
+            else
+                run_algorithm(k, &w[(size_t) i * n], n, total, &s);
+            engine[i] = (BatchResult) { s.total_turnaround, s.total_waiting, s.total_response };
+            free_schedule(&s);
+        }
+        double base = now() - start;
+
+        double waiting = 0;
+        for(int i = 0; i < count; i++)
+            waiting += (double) engine[i].total_waiting / n;
+        printf("%-5s %-8s %6d %14.0f %9s %10s %12.3f\n", algoName[k], "ordinary", 1, count / base, "1.00", "-", waiting / count);
+
+        for(int v = BATCH_AUTO + 1; v < BATCH_ISAS; v++) {
+            if((isa >= 0 && v != isa) || !batch_supported(v))
+                continue;
+
+            start = now();
+            run_batch(k, w, n, count, q, v, out);
+            double elapsed = now() - start;
+
+            int mismatch = 0;
+            waiting = 0;
+            for(int i = 0; i < count; i++) {
+                mismatch += memcmp(&out[i], &engine[i], sizeof(BatchResult)) != 0;
+                waiting  += (double) out[i].total_waiting / n;
+            }
+            printf("%-5s %-8s %6d %14.0f %9.2f %10d %12.3f\n", algoName[k], batchIsaName[v], batch_lanes(v),
+                count / elapsed, base / elapsed, mismatch, waiting / count);
+        }
+    }
+
+    // memory allocate disable
+    free(p);
+    free(w);
+    free(engine);
+    free(out);
+
+    return 0;
+}
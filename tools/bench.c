@@ -0,0 +1,137 @@
+/**
+ * @file    bench.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   benchmark for libcpusched (no raylib)
+ *          - usage: bench [--algo NAME] [--runs N] [--plugin FILE] [workload ...]
+ *          - run every algorithm `runs` times on each workload and print time per run
+ *          - time is the best of `ROUNDS` rounds to reduce noise of other tasks
+ *          - built-in process data is used if no workload is given
+ *          - `--plugin`: policy plugin loaded at runtime is measured after the built-in algorithms
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// user define library
+#include "cpusched.h"
+
+/**
+ * @brief bench.c variable info
+ *
+ *  type        name        pointer     info
+ *  #define     RUNS        n           default run count for each algorithm
+ *  #define     ROUNDS      n           round count, the fastest round is reported
+ *  Workload    w           y           loaded workload array
+ *  int         runs        n           run count for each algorithm
+ *  int         algo        n           algorithm index (-1 for every algorithm)
+ *  Plugin      plugin      y           loaded policy plugin array
+ *  int         plugins     n           loaded policy plugin count
+ *  double      elapsed     n           elapsed time of the fastest round (second)
+ *  double      total       n           elapsed time of the benchmark (second)
+ *  Schedule    s           n           scheduling result of the last run
+ *
+ */
+
+#define RUNS    1000    // default run count for each algorithm
+#define ROUNDS  5       // round count, the fastest round is reported
+
+/**
+ * @brief   present time of monotonic clock
+ *
+ * @return  double (second)
+ */
+double now(void) {
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char *argv[]) {
+
+    int runs  = RUNS;
+    int algo  = -1;
+    int count = 0;
+    int plugins = 0;
+    Workload *w = calloc(argc, sizeof(Workload));
+    Plugin *plugin = calloc(argc, sizeof(Plugin));
+
+    for(int i = 1; i < argc; i++) {
+        if(strcmp(argv[i], "--runs") == 0 && i + 1 < argc)
+            runs = atoi(argv[++i]);
+        else if(strcmp(argv[i], "--plugin") == 0 && i + 1 < argc) {
+            if(!load_plugin(argv[++i], &plugin[plugins++]))
+                return 1;
+        }
+        else if(strcmp(argv[i], "--algo") == 0 && i + 1 < argc) {
+            if((algo = find_algorithm(argv[++i])) < 0) {
+                fprintf(stderr, "unknown algorithm `%s`\n", argv[i]);
+                return 1;
+            }
+        }
+        else {
+            w[count].p = load_workload(argv[i], &w[count].n, &w[count].t);
+            if(w[count].p == NULL)
+                return 1;
+            snprintf(w[count++].label, LABEL_MAX_W, "%s", argv[i]);
+        }
+    }
+
+    if(count == 0) {
+        w[0].p = default_workload(&w[0].n, &w[0].t);
+        snprintf(w[count++].label, LABEL_MAX_W, "default");
+    }
+    if(runs < 1) runs = 1;
+
+    double total = 0;
+    printf("%-24s %-5s %8s %12s %12s %12s\n", "workload", "algo", "runs", "usec/run", "avg wait", "avg turn");
+
+    for(int i = 0; i < count; i++) {
+        for(int k = 0; k < ALGO_COUNT + plugins; k++) {
+            if(algo >= 0 && k != algo && k < ALGO_COUNT)
+                continue;
+            const Policy *pol = k < ALGO_COUNT ? NULL : plugin[k - ALGO_COUNT].policy;
+
+            Schedule s = { 0 };
+            double elapsed = 0;
+            for(int round = 0; round < ROUNDS; round++) {
+                double start = now();
+                for(int r = 0; r < runs; r++) {
+                    free_schedule(&s);
+                    if(pol)
+                        run_policy(pol, w[i].p, w[i].n, w[i].t, &s);
+                    else
+                        run_algorithm(k, w[i].p, w[i].n, w[i].t, &s);
+                }
+                // best round: one timestamp for the compare and the record
+                double took = now() - start;
+                if(round == 0 || took < elapsed)
+                    elapsed = took;
+            }
+            total += elapsed;
+
+            Metrics m = get_metrics(&s);
+            printf("%-24s %-5s %8d %12.3f %12.2f %12.2f\n", w[i].label, s.algo, runs, elapsed * 1e6 / runs, m.avg_waiting, m.avg_turnaround);
+            free_schedule(&s);
+        }
+    }
+    printf("total: %.3f sec\n", total);
+
+    // memory allocate disable
+    for(int i = 0; i < count; i++)
+        free(w[i].p);
+    free(w);
+    for(int i = 0; i < plugins; i++)
+        unload_plugin(&plugin[i]);
+    free(plugin);
+
+    return 0;
+}
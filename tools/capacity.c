@@ -0,0 +1,126 @@
+/**
+ * @file    capacity.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   capacity planning for libcpusched (no raylib)
+ *          - usage: capacity --slo Y --burst MEAN [--cv CV] [--priorities K] [--quantile Q]
+ *                            [--confidence C] [--samples N] [--tolerance L] [--seed S] [--jobs J]
+ *                            [--algo NAME]... [--plugin FILE]...
+ *          - maximum arrival rate of each policy whose `Q` quantile of waiting (0.99 by default)
+ *            stays at most `Y`, every built-in algorithm if no policy is given
+ *          - `low` / `high`: rates where the SLO is met / missed with the confidence `C`
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// user define library
+#include "cpusched.h"
+
+/**
+ * @brief capacity.c variable info
+ *
+ *  type            name        pointer     info
+ *  CapacityOptions opt         n           burst distribution, SLO and search options
+ *  CapacityResult  res         n           result of each policy
+ *  Policy          pol         y           policies to be planned
+ *  Plugin          plugin      n           loaded policy plugins
+ *  int             count       n           policy count
+ *
+ */
+
+#define MAX_POLICIES 32 // policies of one run
+
+/**
+ * @brief   present time of monotonic clock
+ *
+ * @return  double (second)
+ */
+double now(void) {
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char *argv[]) {
+
+    CapacityOptions opt = { .cv = 1, .priorities = 5, .slo = -1, .seed = 1 };
+    CapacityResult res[MAX_POLICIES];
+    const Policy *pol[MAX_POLICIES];
+    Plugin plugin[MAX_POLICIES];
+    int count = 0, plugins = 0, algo;
+
+    for(int i = 1; i < argc; i++) {
+        if(strcmp(argv[i], "--slo") == 0 && i + 1 < argc)
+            opt.slo = atof(argv[++i]);
+        else if(strcmp(argv[i], "--burst") == 0 && i + 1 < argc)
+            opt.meanBurst = atof(argv[++i]);
+        else if(strcmp(argv[i], "--cv") == 0 && i + 1 < argc)
+            opt.cv = atof(argv[++i]);
+        else if(strcmp(argv[i], "--priorities") == 0 && i + 1 < argc)
+            opt.priorities = atoi(argv[++i]);
+        else if(strcmp(argv[i], "--quantile") == 0 && i + 1 < argc)
+            opt.quantile = atof(argv[++i]);
+        else if(strcmp(argv[i], "--confidence") == 0 && i + 1 < argc)
+            opt.confidence = atof(argv[++i]);
+        else if(strcmp(argv[i], "--samples") == 0 && i + 1 < argc)
+            opt.samples = atoll(argv[++i]);
+        else if(strcmp(argv[i], "--tolerance") == 0 && i + 1 < argc)
+            opt.tolerance = atof(argv[++i]);
+        else if(strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+            opt.seed = strtoull(argv[++i], NULL, 10);
+        else if(strcmp(argv[i], "--jobs") == 0 && i + 1 < argc)
+            opt.jobs = atoi(argv[++i]);
+        else if(strcmp(argv[i], "--algo") == 0 && i + 1 < argc && count < MAX_POLICIES) {
+            if((algo = find_algorithm(argv[++i])) < 0) {
+                fprintf(stderr, "unknown algorithm `%s`\n", argv[i]);
+                return 1;
+            }
+            pol[count++] = builtinPolicy[algo];
+        }
+        else if(strcmp(argv[i], "--plugin") == 0 && i + 1 < argc && count < MAX_POLICIES) {
+            if(!load_plugin(argv[++i], &plugin[plugins]))
+                return 1;
+            pol[count++] = plugin[plugins++].policy;
+        }
+        else {
+            fprintf(stderr, "unknown option `%s`\n", argv[i]);
+            return 1;
+        }
+    }
+
+    if(opt.slo < 0 || opt.meanBurst < 1) {
+        fprintf(stderr, "usage: capacity --slo Y --burst MEAN [--cv CV] [--priorities K] [--quantile Q]\n"
+                        "                [--confidence C] [--samples N] [--tolerance L] [--seed S] [--jobs J]\n"
+                        "                [--algo NAME]... [--plugin FILE]...\n");
+        return 1;
+    }
+    if(count == 0)
+        for(; count < ALGO_COUNT; count++)
+            pol[count] = builtinPolicy[count];
+
+    double start = now();
+    if(!plan_capacity(pol, count, &opt, res))
+        return 1;
+    double elapsed = now() - start;
+
+    printf("%-8s %10s %7s %10s %10s %12s %10s %7s\n", "policy", "rate", "load", "low", "high", "waiting", "+-", "probes");
+    for(int i = 0; i < count; i++)
+        printf("%-8s %10.6f %7.4f %10.6f %10.6f %12.2f %10.2f %7d\n", pol[i]->name, res[i].rate, res[i].load,
+            res[i].low, res[i].high, res[i].value, res[i].halfWidth, res[i].probes);
+    printf("%.2f sec\n", elapsed);
+
+    // memory allocate disable
+    for(int i = 0; i < plugins; i++)
+        unload_plugin(&plugin[i]);
+
+    return 0;
+}
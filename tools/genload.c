@@ -0,0 +1,88 @@
+/**
+ * @file    genload.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   synthetic workload generator (no raylib)
+ *          - usage: genload <count> <seed> <max gap> <max burst> [heavy %] [max priority]
+ *          - write workload file format to stdout: `pid arrival burst priority` per line
+ *          - `heavy %` of processes get 10 times longer burst (bimodal burst distribution)
+ *          - arrivals are distinct and the CPU never idles (same corpus as the engine before idle time support)
+ *          - same arguments give same workload on every platform
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// standard library
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * @brief genload.c variable info
+ *
+ *  type        name        pointer     info
+ *  uint64_t    state       n           random number generator state
+ *  int         count       n           process count
+ *  int         gap         n           maximum arrival gap between two processes
+ *  int         burst       n           maximum burst time
+ *  int         heavy       n           percentage of long processes
+ *  int         priority    n           maximum priority
+ *  int         arrival     n           arrival time of the present process
+ *  int         busy        n           the sum of burst time so far
+ *
+ */
+
+uint64_t state; // random number generator state
+
+/**
+ * @brief   xorshift64* random number, platform independent unlike `rand()`
+ *
+ * @param max   upper bound (exclusive)
+ * @return  int (0 ~ max - 1)
+ */
+int next_random(int max) {
+
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    return (int) ((state * 2685821657736338717ULL) >> 33) % max;
+}
+
+int main(int argc, char *argv[]) {
+
+    if(argc < 5) {
+        fprintf(stderr, "usage: %s <count> <seed> <max gap> <max burst> [heavy %%] [max priority]\n", argv[0]);
+        return 1;
+    }
+
+    int count    = atoi(argv[1]);
+    int gap      = atoi(argv[3]);
+    int burst    = atoi(argv[4]);
+    int heavy    = argc > 5 ? atoi(argv[5]) : 0;
+    int priority = argc > 6 ? atoi(argv[6]) : 5;
+    state        = strtoull(argv[2], NULL, 10) * 0x9e3779b97f4a7c15ULL + 1;
+
+    if(count < 1 || gap < 0 || burst < 1 || priority < 1) {
+        fprintf(stderr, "genload: invalid argument\n");
+        return 1;
+    }
+
+    printf("# genload %d %s %d %d %d %d\n", count, argv[2], gap, burst, heavy, priority);
+    for(int i = 0, arrival = 0, busy = 0; i < count; i++) {
+        int b = 1 + next_random(burst);
+        if(next_random(100) < heavy)
+            b *= 10;
+
+        printf("%d %d %d %d\n", i, arrival, b, 1 + next_random(priority));
+        busy += b;
+
+        // next arrival: after the present one, before the CPU becomes idle
+        arrival += 1 + next_random(gap + 1);
+        if(arrival > busy)
+            arrival = busy;
+    }
+
+    return 0;
+}
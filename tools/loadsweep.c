@@ -0,0 +1,239 @@
+/**
+ * @file    loadsweep.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   latency versus utilization curves for libcpusched (no raylib)
+ *          - usage: loadsweep [--burst MEAN] [--cv CV] [--priorities K] [--low L] [--high H]
+ *                             [--points N] [--count N] [--seed S] [--jobs J]
+ *                             [--algo NAME]... [--plugin FILE]... [--csv FILE] [--svg FILE]
+ *          - every built-in algorithm if no policy is given, loads from 10% to 99% by default
+ *          - CSV of mean and p99 waiting, turnaround and slowdown (stdout without `--csv`)
+ *          - `--svg`: chart of the six curves (log scale), one line for each policy
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// standard library
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// user define library
+#include "cpusched.h"
+
+/**
+ * @brief loadsweep.c variable info
+ *
+ *  type            name        pointer     info
+ *  SweepOptions    opt         n           burst distribution, loads and run length
+ *  SweepPoint      pt          y           result of each policy and load
+ *  Policy          pol         y           policies to be swept
+ *  Plugin          plugin      n           loaded policy plugins
+ *  int             count       n           policy count
+ *
+ */
+
+#define MAX_POLICIES    32  // policies of one run
+#define PANEL_WIDTH     360 // chart panel width (pixel)
+#define PANEL_HEIGHT    260 // chart panel height (pixel)
+#define PANEL_MARGIN    50  // space for the axis labels (pixel)
+
+// line color of each policy
+static const char *lineColor[] = {
+    "#1f77b4", "#ff7f0e", "#2ca02c", "#d62728", "#9467bd", "#8c564b", "#e377c2", "#7f7f7f", "#bcbd22", "#17becf"
+};
+
+// name of each metric (`SweepMetric` order)
+static const char *metricName[SWEEP_METRICS] = { "waiting", "turnaround", "slowdown" };
+
+/**
+ * @brief   present time of monotonic clock
+ *
+ * @return  double (second)
+ */
+double now(void) {
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief   write the chart: a panel for mean and p99 of each metric, x load, y log scale
+ *
+ * @param fp        output file
+ * @param pol       policy array
+ * @param count     policy count
+ * @param points    load count
+ * @param pt        result array (`count` * `points`)
+ */
+void write_svg(FILE *fp, const Policy *const *pol, int count, int points, const SweepPoint *pt) {
+
+    int width  = SWEEP_METRICS * (PANEL_WIDTH + PANEL_MARGIN) + PANEL_MARGIN;
+    int height = 2 * (PANEL_HEIGHT + PANEL_MARGIN) + PANEL_MARGIN + 30;
+
+    fprintf(fp, "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"%d\" height=\"%d\" font-family=\"sans-serif\" font-size=\"11\">\n", width, height);
+    fprintf(fp, "<rect width=\"100%%\" height=\"100%%\" fill=\"white\"/>\n");
+
+    // legend
+    for(int k = 0; k < count; k++) {
+        int x = PANEL_MARGIN + k * 90;
+        fprintf(fp, "<line x1=\"%d\" y1=\"18\" x2=\"%d\" y2=\"18\" stroke=\"%s\" stroke-width=\"2\"/>", x, x + 20, lineColor[k % 10]);
+        fprintf(fp, "<text x=\"%d\" y=\"22\">%s</text>\n", x + 25, pol[k]->name);
+    }
+
+    for(int row = 0; row < 2; row++)
+        for(int m = 0; m < SWEEP_METRICS; m++) {
+            int left = PANEL_MARGIN + m * (PANEL_WIDTH + PANEL_MARGIN);
+            int top  = 30 + PANEL_MARGIN / 2 + row * (PANEL_HEIGHT + PANEL_MARGIN);
+
+            // y range: decades around the positive values
+            double lo = INFINITY, hi = 0;
+            for(int i = 0; i < count * points; i++) {
+                double v = row == 0 ? pt[i].mean[m] : pt[i].p99[m];
+                if(v > 0 && v < lo) lo = v;
+                if(v > hi) hi = v;
+            }
+            if(hi <= 0)
+                lo = hi = 1;
+            double dlo = floor(log10(lo)), dhi = ceil(log10(hi));
+            if(dhi <= dlo)
+                dhi = dlo + 1;
+
+            fprintf(fp, "<rect x=\"%d\" y=\"%d\" width=\"%d\" height=\"%d\" fill=\"none\" stroke=\"#999\"/>\n", left, top, PANEL_WIDTH, PANEL_HEIGHT);
+            fprintf(fp, "<text x=\"%d\" y=\"%d\" text-anchor=\"middle\" font-weight=\"bold\">%s %s</text>\n",
+                left + PANEL_WIDTH / 2, top - 6, row == 0 ? "mean" : "p99", metricName[m]);
+
+            // grid: decades on y, tenths of load on x
+            for(double d = dlo; d <= dhi; d++) {
+                double y = top + PANEL_HEIGHT - (d - dlo) / (dhi - dlo) * PANEL_HEIGHT;
+                fprintf(fp, "<line x1=\"%d\" y1=\"%.1f\" x2=\"%d\" y2=\"%.1f\" stroke=\"#eee\"/>", left, y, left + PANEL_WIDTH, y);
+                fprintf(fp, "<text x=\"%d\" y=\"%.1f\" text-anchor=\"end\">%g</text>\n", left - 4, y + 4, pow(10, d));
+            }
+            for(int t = 0; t <= 10; t++) {
+                double x = left + t / 10.0 * PANEL_WIDTH;
+                fprintf(fp, "<line x1=\"%.1f\" y1=\"%d\" x2=\"%.1f\" y2=\"%d\" stroke=\"#eee\"/>", x, top, x, top + PANEL_HEIGHT);
+                if(t % 2 == 0)
+                    fprintf(fp, "<text x=\"%.1f\" y=\"%d\" text-anchor=\"middle\">%.1f</text>\n", x, top + PANEL_HEIGHT + 14, t / 10.0);
+            }
+
+            // one line for each policy
+            for(int k = 0; k < count; k++) {
+                fprintf(fp, "<polyline fill=\"none\" stroke=\"%s\" stroke-width=\"1.5\" points=\"", lineColor[k % 10]);
+                for(int i = 0; i < points; i++) {
+                    const SweepPoint *p = &pt[k * points + i];
+                    double v = row == 0 ? p->mean[m] : p->p99[m];
+                    double y = (log10(v > lo ? v : lo) - dlo) / (dhi - dlo);
+                    fprintf(fp, "%.1f,%.1f ", left + p->load * PANEL_WIDTH, top + PANEL_HEIGHT - y * PANEL_HEIGHT);
+                }
+                fprintf(fp, "\"/>\n");
+            }
+        }
+
+    fprintf(fp, "<text x=\"%d\" y=\"%d\" text-anchor=\"middle\">load (utilization)</text>\n", width / 2, height - 8);
+    fprintf(fp, "</svg>\n");
+}
+
+int main(int argc, char *argv[]) {
+
+    SweepOptions opt = { .meanBurst = 10, .cv = 1, .priorities = 5, .seed = 1 };
+    const Policy *pol[MAX_POLICIES];
+    Plugin plugin[MAX_POLICIES];
+    const char *csvPath = NULL, *svgPath = NULL;
+    int count = 0, plugins = 0, algo;
+
+    for(int i = 1; i < argc; i++) {
+        if(strcmp(argv[i], "--burst") == 0 && i + 1 < argc)
+            opt.meanBurst = atof(argv[++i]);
+        else if(strcmp(argv[i], "--cv") == 0 && i + 1 < argc)
+            opt.cv = atof(argv[++i]);
+        else if(strcmp(argv[i], "--priorities") == 0 && i + 1 < argc)
+            opt.priorities = atoi(argv[++i]);
+        else if(strcmp(argv[i], "--low") == 0 && i + 1 < argc)
+            opt.low = atof(argv[++i]);
+        else if(strcmp(argv[i], "--high") == 0 && i + 1 < argc)
+            opt.high = atof(argv[++i]);
+        else if(strcmp(argv[i], "--points") == 0 && i + 1 < argc)
+            opt.points = atoi(argv[++i]);
+        else if(strcmp(argv[i], "--count") == 0 && i + 1 < argc)
+            opt.count = atoll(argv[++i]);
+        else if(strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+            opt.seed = strtoull(argv[++i], NULL, 10);
+        else if(strcmp(argv[i], "--jobs") == 0 && i + 1 < argc)
+            opt.jobs = atoi(argv[++i]);
+        else if(strcmp(argv[i], "--csv") == 0 && i + 1 < argc)
+            csvPath = argv[++i];
+        else if(strcmp(argv[i], "--svg") == 0 && i + 1 < argc)
+            svgPath = argv[++i];
+        else if(strcmp(argv[i], "--algo") == 0 && i + 1 < argc && count < MAX_POLICIES) {
+            if((algo = find_algorithm(argv[++i])) < 0) {
+                fprintf(stderr, "unknown algorithm `%s`\n", argv[i]);
+                return 1;
+            }
+            pol[count++] = builtinPolicy[algo];
+        }
+        else if(strcmp(argv[i], "--plugin") == 0 && i + 1 < argc && count < MAX_POLICIES) {
+            if(!load_plugin(argv[++i], &plugin[plugins]))
+                return 1;
+            pol[count++] = plugin[plugins++].policy;
+        }
+        else {
+            fprintf(stderr, "usage: loadsweep [--burst MEAN] [--cv CV] [--priorities K] [--low L] [--high H]\n"
+                            "                 [--points N] [--count N] [--seed S] [--jobs J]\n"
+                            "                 [--algo NAME]... [--plugin FILE]... [--csv FILE] [--svg FILE]\n");
+            return 1;
+        }
+    }
+    if(count == 0)
+        for(; count < ALGO_COUNT; count++)
+            pol[count] = builtinPolicy[count];
+
+    int points      = opt.points > 0 ? opt.points : SWEEP_POINTS;
+    SweepPoint *pt  = malloc(sizeof(SweepPoint) * count * points);
+    double start    = now();
+    if(!run_sweep(pol, count, &opt, pt)) {
+        fprintf(stderr, "sweep failed: burst at least 1, loads under 1 and low <= high\n");
+        return 1;
+    }
+    double elapsed = now() - start;
+
+    FILE *fp = csvPath != NULL ? fopen(csvPath, "w") : stdout;
+    if(fp == NULL) {
+        fprintf(stderr, "WARNING: SWEEP: [%s] failed to open file\n", csvPath);
+        return 1;
+    }
+    double longest = 0;
+    fprintf(fp, "policy,load,rate,observations,truncated,mean_waiting,p99_waiting,mean_turnaround,p99_turnaround,mean_slowdown,p99_slowdown,seconds\n");
+    for(int k = 0; k < count; k++)
+        for(int i = 0; i < points; i++) {
+            const SweepPoint *p = &pt[k * points + i];
+            fprintf(fp, "%s,%.4f,%.6f,%lld,%lld,%.3f,%.3f,%.3f,%.3f,%.4f,%.4f,%.3f\n", pol[k]->name, p->load, p->rate,
+                p->observations, p->truncated, p->mean[SWEEP_WAITING], p->p99[SWEEP_WAITING],
+                p->mean[SWEEP_TURNAROUND], p->p99[SWEEP_TURNAROUND], p->mean[SWEEP_SLOWDOWN], p->p99[SWEEP_SLOWDOWN], p->seconds);
+            if(p->seconds > longest)
+                longest = p->seconds;
+        }
+    if(fp != stdout)
+        fclose(fp);
+
+    if(svgPath != NULL) {
+        if((fp = fopen(svgPath, "w")) == NULL) {
+            fprintf(stderr, "WARNING: SWEEP: [%s] failed to open file\n", svgPath);
+            return 1;
+        }
+        write_svg(fp, pol, count, points, pt);
+        fclose(fp);
+    }
+    fprintf(stderr, "%d runs in %.2f sec (longest run %.2f sec)\n", count * points, elapsed, longest);
+
+    // memory allocate disable
+    free(pt);
+    for(int i = 0; i < plugins; i++)
+        unload_plugin(&plugin[i]);
+
+    return 0;
+}
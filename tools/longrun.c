@@ -0,0 +1,129 @@
+/**
+ * @file    longrun.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   long scheduling run with checkpoints for libcpusched (no raylib)
+ *          - usage: longrun [--algo NAME] [--plugin FILE] [--checkpoint FILE] [--every T]
+ *                           [--resume] [--sync] [--out FILE.cpsr] <workload>
+ *          - a snapshot of the engine state is written every `T` time units (`--checkpoint`)
+ *          - `--resume`: continue from the snapshot if it has the same workload and policy
+ *          - `--sync`: write snapshots in the run thread instead of a forked child
+ *          - `--out`: write the result as results file (`include/results.h`)
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// user define library
+#include "cpusched.h"
+
+/**
+ * @brief longrun.c variable info
+ *
+ *  type                name        pointer     info
+ *  CheckpointOptions   opt         n           checkpoint options
+ *  CheckpointStats     stats       n           checkpoint statistics
+ *  Plugin              plugin      n           loaded policy plugin
+ *  Policy              pol         y           policy of the run
+ *  char                out         y           results file path (NULL: not written)
+ *  double              elapsed     n           elapsed time of the run (second)
+ *
+ */
+
+/**
+ * @brief   present time of monotonic clock
+ *
+ * @return  double (second)
+ */
+double now(void) {
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char *argv[]) {
+
+    CheckpointOptions opt = { 0 };
+    CheckpointStats stats;
+    Plugin plugin = { 0 };
+    const Policy *pol = builtinPolicy[0];
+    const char *out = NULL, *input = NULL;
+    int algo = 0;
+
+    for(int i = 1; i < argc; i++) {
+        if(strcmp(argv[i], "--algo") == 0 && i + 1 < argc) {
+            if((algo = find_algorithm(argv[++i])) < 0) {
+                fprintf(stderr, "unknown algorithm `%s`\n", argv[i]);
+                return 1;
+            }
+            pol = builtinPolicy[algo];
+        }
+        else if(strcmp(argv[i], "--plugin") == 0 && i + 1 < argc) {
+            if(!load_plugin(argv[++i], &plugin))
+                return 1;
+            pol = plugin.policy;
+        }
+        else if(strcmp(argv[i], "--checkpoint") == 0 && i + 1 < argc)
+            opt.fileName = argv[++i];
+        else if(strcmp(argv[i], "--every") == 0 && i + 1 < argc)
+            opt.interval = atoll(argv[++i]);
+        else if(strcmp(argv[i], "--resume") == 0)
+            opt.resume = true;
+        else if(strcmp(argv[i], "--sync") == 0)
+            opt.sync = true;
+        else if(strcmp(argv[i], "--out") == 0 && i + 1 < argc)
+            out = argv[++i];
+        else
+            input = argv[i];
+    }
+
+    if(input == NULL) {
+        fprintf(stderr, "usage: longrun [--algo NAME] [--plugin FILE] [--checkpoint FILE] [--every T] [--resume] [--sync] [--out FILE.cpsr] <workload>\n");
+        return 1;
+    }
+
+    int n;
+    Time t;
+    Process *p = load_workload(input, &n, &t);
+    if(p == NULL)
+        return 1;
+
+    Schedule s = { 0 };
+    double start = now();
+    if(opt.fileName != NULL) {
+        if(!run_checkpointed(pol, p, n, &s, &opt, &stats)) {
+            fprintf(stderr, "invalid checkpoint options\n");
+            return 1;
+        }
+    }
+    else
+        run_policy(pol, p, n, t, &s);
+    double elapsed = now() - start;
+
+    Metrics m = get_metrics(&s);
+    printf("%-5s n=%d t=%lld avg wait %.2f avg turn %.2f avg resp %.2f (%.3f sec)\n",
+        s.algo, s.n, (long long) s.t, m.avg_waiting, m.avg_turnaround, m.avg_response, elapsed);
+    if(opt.fileName != NULL) {
+        if(stats.resumed >= 0)
+            printf("resumed at t=%lld\n", (long long) stats.resumed);
+        printf("snapshots: %lld written, %lld skipped, %lld failed\n", stats.snapshots - stats.failed, stats.skipped, stats.failed);
+    }
+
+    bool ok = out == NULL || save_results(out, &s);
+
+    // memory allocate disable
+    free_schedule(&s);
+    free(p);
+    if(plugin.handle)
+        unload_plugin(&plugin);
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,133 @@
+/**
+ * @file    mg1.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   analytic M/G/1 estimates for libcpusched (no raylib)
+ *          - usage: mg1 --rate R --burst MEAN [--cv CV] [--priorities K]
+ *                       [--simulate] [--precision P] [--seed S] [--algo NAME]
+ *          - prints the analytic mean turnaround of every supported algorithm instantly
+ *          - `--simulate`: side by side with the steady-state simulation of the same spec
+ *            (`run_steady()`, confidence interval within `P` of the mean, 0.01 by default)
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// user define library
+#include "cpusched.h"
+
+/**
+ * @brief mg1.c variable info
+ *
+ *  type            name        pointer     info
+ *  ArrivalGen      spec        n           distribution spec (and generator of the simulation)
+ *  AnalyticResult  r           n           analytic estimate
+ *  SteadyOptions   opt         n           stopping rule of the simulation
+ *  SteadyEstimate  est         n           simulated steady-state mean
+ *  bool            simulate    n           run the simulation too
+ *  int             algo        n           algorithm index (-1 for every supported algorithm)
+ *
+ */
+
+/**
+ * @brief   present time of monotonic clock
+ *
+ * @return  double (second)
+ */
+double now(void) {
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char *argv[]) {
+
+    double rate = 0, burst = 0, cv = 1;
+    int priorities = 5, algo = -1;
+    unsigned long long seed = 1;
+    bool simulate = false;
+    SteadyOptions opt = { .precision = 0.01 };
+
+    for(int i = 1; i < argc; i++) {
+        if(strcmp(argv[i], "--rate") == 0 && i + 1 < argc)
+            rate = atof(argv[++i]);
+        else if(strcmp(argv[i], "--burst") == 0 && i + 1 < argc)
+            burst = atof(argv[++i]);
+        else if(strcmp(argv[i], "--cv") == 0 && i + 1 < argc)
+            cv = atof(argv[++i]);
+        else if(strcmp(argv[i], "--priorities") == 0 && i + 1 < argc)
+            priorities = atoi(argv[++i]);
+        else if(strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+            seed = strtoull(argv[++i], NULL, 10);
+        else if(strcmp(argv[i], "--precision") == 0 && i + 1 < argc)
+            opt.precision = atof(argv[++i]);
+        else if(strcmp(argv[i], "--simulate") == 0)
+            simulate = true;
+        else if(strcmp(argv[i], "--algo") == 0 && i + 1 < argc) {
+            if((algo = find_algorithm(argv[++i])) < 0 || !analytic_supported(algo)) {
+                fprintf(stderr, "no analytic estimator for `%s`\n", argv[i]);
+                return 1;
+            }
+        }
+        else {
+            fprintf(stderr, "unknown option `%s`\n", argv[i]);
+            return 1;
+        }
+    }
+
+    if(rate <= 0 || burst < 1) {
+        fprintf(stderr, "usage: mg1 --rate R --burst MEAN [--cv CV] [--priorities K] [--simulate] [--precision P] [--seed S] [--algo NAME]\n");
+        return 1;
+    }
+
+    StreamStats *st = malloc(sizeof(StreamStats));
+    if(st == NULL) {
+        fprintf(stderr, "not enough memory\n");
+        return 1;
+    }
+    ArrivalGen spec;
+    init_generator(&spec, rate, burst, cv, priorities, 0, seed);
+
+    printf("%-5s %7s %12s %12s", "algo", "rho", "analytic", "usec");
+    if(simulate)
+        printf(" %12s %10s %8s %10s", "simulated", "+-", "error%", "msec");
+    printf("\n");
+
+    for(int k = 0; k < ALGO_COUNT; k++) {
+        if(!analytic_supported(k) || (algo >= 0 && k != algo))
+            continue;
+
+        AnalyticResult r;
+        double start = now();
+        analytic_estimate(k, &spec, &r);
+        double elapsed = now() - start;
+
+        printf("%-5s %7.4f %12.3f %12.1f", algoName[k], r.rho, r.avg_turnaround, elapsed * 1e6);
+        if(simulate && r.stable) {
+            // same spec, time limit of a billion time units for a slow convergence near rho 1
+            ArrivalGen gen;
+            SteadyEstimate est;
+            init_generator(&gen, rate, burst, cv, priorities, 0, seed);
+            opt.stream.until = 1000000000;
+            start = now();
+            bool reached = run_steady(builtinPolicy[k], generator_source, &gen, &opt, st, &est);
+            elapsed = now() - start;
+            printf(" %12.3f %10.3f %8.2f %10.1f%s", est.mean, est.halfWidth,
+                (r.avg_turnaround - est.mean) / est.mean * 100, elapsed * 1e3, st->failed ? " (failed)" : reached ? "" : " (not reached)");
+        }
+        printf("\n");
+    }
+
+    // memory allocate disable
+    free(st);
+
+    return 0;
+}
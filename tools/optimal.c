@@ -0,0 +1,101 @@
+/**
+ * @file    optimal.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   optimality gap of the built-in algorithms for libcpusched (no raylib)
+ *          - usage: optimal [--weighted] [--jobs J] [--nodes N] [workload]
+ *          - optimal non-preemptive schedule of the workload (built-in `pInfo` if no file is given),
+ *            then metrics of every built-in algorithm and its gap from the optimum
+ *          - `--weighted`: weighted completion time (weight 1 / priority) instead of average waiting
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// user define library
+#include "cpusched.h"
+
+/**
+ * @brief optimal.c variable info
+ *
+ *  type            name        pointer     info
+ *  OptimalOptions  opt         n           objective, node limit and thread count
+ *  OptimalResult   best        n           optimal order and its metrics
+ *  Schedule        s           n           schedule of each built-in algorithm
+ *  Process         p           y           workload
+ *
+ */
+
+/**
+ * @brief   present time of monotonic clock
+ *
+ * @return  double (second)
+ */
+double now(void) {
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char *argv[]) {
+
+    OptimalOptions opt = { .objective = OPTIMAL_WAITING };
+    OptimalResult best;
+    const char *input = NULL;
+    int n = 0;
+    Time t = 0;
+
+    for(int i = 1; i < argc; i++) {
+        if(strcmp(argv[i], "--weighted") == 0)
+            opt.objective = OPTIMAL_WEIGHTED;
+        else if(strcmp(argv[i], "--jobs") == 0 && i + 1 < argc)
+            opt.jobs = atoi(argv[++i]);
+        else if(strcmp(argv[i], "--nodes") == 0 && i + 1 < argc)
+            opt.nodeLimit = atoll(argv[++i]);
+        else if(argv[i][0] == '-') {
+            fprintf(stderr, "usage: optimal [--weighted] [--jobs J] [--nodes N] [workload]\n");
+            return 1;
+        }
+        else
+            input = argv[i];
+    }
+
+    Process *p = input != NULL ? load_workload(input, &n, &t) : default_workload(&n, &t);
+    if(p == NULL)
+        return 1;
+
+    double start = now();
+    if(!solve_optimal(p, n, &opt, &best)) {
+        fprintf(stderr, "optimal: 1 ~ %d processes (workload has %d)\n", OPTIMAL_MAX_PROCESS, n);
+        free(p);
+        return 1;
+    }
+    double elapsed = now() - start;
+
+    printf("%s non-preemptive schedule: cost %.3f (root bound %.3f), %lld nodes, %.3f sec\n",
+        best.optimal ? "optimal" : "best found (node limit)", best.cost, best.rootBound, best.nodes, elapsed);
+    printf("%-8s %12s %12s %14s %9s\n", "algo", "avg wait", "avg turn", "cost", "gap%");
+    printf("%-8s %12.3f %12.3f %14.3f %9s\n", "optimal", best.avg_waiting, best.avg_turnaround, best.cost, "-");
+
+    for(int k = 0; k < ALGO_COUNT; k++) {
+        Schedule s = { 0 };
+        run_algorithm(k, p, n, t, &s);
+        Metrics m = get_metrics(&s);
+        printf("%-8s %12.3f %12.3f %14.3f %9.2f\n", algoName[k], m.avg_waiting, m.avg_turnaround,
+            schedule_cost(&best, &s), optimal_gap(&best, &s) * 100);
+        free_schedule(&s);
+    }
+
+    // memory allocate disable
+    free(p);
+
+    return 0;
+}
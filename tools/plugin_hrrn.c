@@ -0,0 +1,69 @@
+/**
+ * @file    plugin_hrrn.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   example scheduling policy plugin: HRRN (Highest Response Ratio Next)
+ *          - build: make plugins (bin/plugin_hrrn.so)
+ *          - run:   ./bin/bench --plugin ./bin/plugin_hrrn.so workload.txt
+ *          - response ratio is computed at dispatch time with the present waiting time,
+ *            the built-in HRN fixes the sort key when the process enters the ready queue
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// standard library
+#include <stddef.h>
+
+// user define library
+#include "plugin.h"
+#include "policy.h"
+#include "process.h"
+
+/**
+ * @brief plugin_hrrn.c variable info
+ *
+ *  type        name        pointer     info
+ *  Process     ready       y           processes in the ready queue (in enqueue order)
+ *  int         count       n           number of process in the ready queue
+ *  Process     cur         y           running process (NULL at dispatch)
+ *  Time        time        n           present time of the engine
+ *  int         best        n           index of the highest response ratio so far
+ *
+ */
+
+/**
+ * @brief   select the process with the highest response ratio (waiting + burst) / burst
+ *          non-preemptive: the running process is never replaced
+ *
+ * @return  int (index of `ready` to run, -1 keeps `cur` running)
+ */
+static int HRRN_pick(void *data, const Process *const *ready, int count, const Process *cur, Time time) {
+
+    (void) data;
+    if(cur != NULL)
+        return -1;
+
+    // compare (w1 + b1) / b1 > (w2 + b2) / b2 without division, earlier process wins ties
+    int best = 0;
+    for(int i = 1; i < count; i++) {
+        long long w1 = time - ready[i]->timeout, b1 = ready[i]->burst;
+        long long w2 = time - ready[best]->timeout, b2 = ready[best]->burst;
+        if((w1 + b1) * b2 > (w2 + b2) * b1)
+            best = i;
+    }
+
+    return best;
+}
+
+// HRRN scheduling policy
+static const Policy policyHRRN = {
+    .name      = "HRRN",
+    .pick_next = HRRN_pick,
+};
+
+CPUSCHED_EXPORT const Policy* cpusched_plugin(int abi) {
+
+    return abi == CPUSCHED_PLUGIN_ABI ? &policyHRRN : NULL;
+}
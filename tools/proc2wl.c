@@ -0,0 +1,94 @@
+/**
+ * @file    proc2wl.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   live /proc capture to workload file (no raylib, Linux)
+ *          - usage: proc2wl [--interval US] [--duration S] [--pid PID] [--unit NS] [--per-task] [--text] <output>
+ *          - samples until `--duration` seconds or Ctrl+C, processes are written while sampling
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// standard library
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// user define library
+#include "cpusched.h"
+
+/**
+ * @brief proc2wl.c variable info
+ *
+ *  type            name        pointer     info
+ *  sig_atomic_t    stop        n           set by SIGINT and SIGTERM
+ *  SamplerOptions  opt         n           sampler options
+ *  SamplerStats    stats       n           sampler statistics
+ *  WorkloadWriter  w           n           workload file written while sampling
+ *  bool            binary      n           write binary workload file
+ *
+ */
+
+static volatile sig_atomic_t stop = 0;
+
+// signal handler: finish sampling
+static void on_signal(int sig) {
+
+    (void) sig;
+    stop = 1;
+}
+
+// sink: write each process to the workload file
+static void write_sink(void *data, const Process *p) {
+
+    write_process(data, p);
+}
+
+int main(int argc, char *argv[]) {
+
+    SamplerOptions opt = { 0 };
+    bool binary = true;
+    int i = 1;
+
+    for(; i < argc && strncmp(argv[i], "--", 2) == 0; i++) {
+        if(strcmp(argv[i], "--interval") == 0 && i + 1 < argc)
+            opt.interval = atoll(argv[++i]);
+        else if(strcmp(argv[i], "--duration") == 0 && i + 1 < argc)
+            opt.duration = (long long) (atof(argv[++i]) * 1000000);
+        else if(strcmp(argv[i], "--pid") == 0 && i + 1 < argc)
+            opt.pid = atoi(argv[++i]);
+        else if(strcmp(argv[i], "--unit") == 0 && i + 1 < argc)
+            opt.unit = atoll(argv[++i]);
+        else if(strcmp(argv[i], "--per-task") == 0)
+            opt.perTask = true;
+        else if(strcmp(argv[i], "--text") == 0)
+            binary = false;
+        else
+            break;
+    }
+
+    if(argc - i != 1) {
+        fprintf(stderr, "usage: %s [--interval US] [--duration S] [--pid PID] [--unit NS] [--per-task] [--text] <output>\n", argv[0]);
+        return 1;
+    }
+
+    WorkloadWriter w;
+    if(!begin_workload(&w, argv[i], binary))
+        return 1;
+
+    signal(SIGINT, on_signal);
+    signal(SIGTERM, on_signal);
+
+    SamplerStats stats;
+    bool ok = sample_proc(&opt, write_sink, &w, &stats, &stop);
+    ok = end_workload(&w) && ok;
+
+    if(ok)
+        printf("%s: %lld process from %lld task, %lld sample (%lld overrun, %lld file read)\n",
+               argv[i], stats.processes, stats.tasks, stats.samples, stats.overruns, stats.reads);
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,183 @@
+/**
+ * @file    res2raw.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   resource converter: decode images at build time and write raw pixel data header
+ *          - usage: res2raw <output.h> <name>=<image file> ...
+ *          - pixel format is the smallest lossless raylib format of each image
+ *            (GRAYSCALE, GRAY_ALPHA, R8G8B8 or R8G8B8A8)
+ *          - the program uploads the data with `LoadTextureFromImage()`, no decoding at runtime
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// standard library
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// external library
+#define STB_IMAGE_IMPLEMENTATION
+#define STBI_ONLY_PNG
+#include "external/stb_image.h"
+
+/**
+ * @brief res2raw.c variable info
+ *
+ *  type            name        pointer     info
+ *  #define         NAME_MAX_W  n           maximum length of resource name
+ *  char            format      y           raylib pixel format name for each channel count
+ *  unsigned char   rgba        y           decoded image (R8G8B8A8)
+ *  unsigned char   data        y           converted pixel data
+ *  int             channels    n           channel count of converted pixel data
+ *  FILE            out         y           output header file
+ *
+ */
+
+#define NAME_MAX_W  64
+
+// raylib pixel format name for each channel count
+const char *format[] = {
+    NULL,
+    "PIXELFORMAT_UNCOMPRESSED_GRAYSCALE",
+    "PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA",
+    "PIXELFORMAT_UNCOMPRESSED_R8G8B8",
+    "PIXELFORMAT_UNCOMPRESSED_R8G8B8A8"
+};
+
+/**
+ * @brief   find the smallest channel count that keeps every pixel
+ *
+ * @param rgba  decoded image (R8G8B8A8)
+ * @param count pixel count
+ * @return  int
+ */
+int find_channels(const unsigned char *rgba, int count) {
+
+    int gray = 1, opaque = 1;
+
+    for(int i = 0; i < count; i++) {
+        const unsigned char *p = rgba + i * 4;
+        if(p[0] != p[1] || p[1] != p[2]) gray = 0;
+        if(p[3] != 255) opaque = 0;
+    }
+
+    if(gray) return opaque ? 1 : 2;
+    return opaque ? 3 : 4;
+}
+
+/**
+ * @brief   write one image as raw pixel data array and `Image` initializer
+ *
+ * @param out   output header file
+ * @param name  resource name (array name)
+ * @param file  image file path
+ * @return  int (0 on success)
+ */
+int write_image(FILE *out, const char *name, const char *file) {
+
+    int w, h, n;
+    unsigned char *rgba = stbi_load(file, &w, &h, &n, 4);
+    if(rgba == NULL) {
+        fprintf(stderr, "res2raw: [%s] %s\n", file, stbi_failure_reason());
+        return 1;
+    }
+
+    // convert to the smallest format
+    int channels = find_channels(rgba, w * h);
+    int size     = w * h * channels;
+    unsigned char *data = malloc(size);
+    for(int i = 0; i < w * h; i++) {
+        const unsigned char *p = rgba + i * 4;
+        unsigned char *q = data + i * channels;
+        switch(channels) {
+        case 1: q[0] = p[0];                                        break;
+        case 2: q[0] = p[0]; q[1] = p[3];                           break;
+        case 3: q[0] = p[0]; q[1] = p[1]; q[2] = p[2];              break;
+        default: memcpy(q, p, 4);                                   break;
+        }
+    }
+
+    char upper[NAME_MAX_W] = { 0 };
+    for(int i = 0; name[i] != '\0' && i < NAME_MAX_W - 1; i++)
+        upper[i] = (char) toupper((unsigned char) name[i]);
+
+    fprintf(out, "// %s (%s)\n", name, file);
+    fprintf(out, "#define %s_W %d\n", upper, w);
+    fprintf(out, "#define %s_H %d\n", upper, h);
+    fprintf(out, "#define %s_IMAGE (Image) { .data = %s, .width = %d, .height = %d, .mipmaps = 1, .format = %s }\n\n",
+            upper, name, w, h, format[channels]);
+    fprintf(out, "unsigned char %s[%d] = {", name, size);
+    for(int i = 0; i < size; i++)
+        fprintf(out, "%s0x%02x%s", i % 12 == 0 ? "\n  " : "", data[i], i + 1 < size ? ", " : "\n");
+    fprintf(out, "};\n\n");
+
+    free(data);
+    stbi_image_free(rgba);
+
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+
+    if(argc < 3) {
+        fprintf(stderr, "usage: %s <output.h> <name>=<image file> ...\n", argv[0]);
+        return 1;
+    }
+
+    FILE *out = fopen(argv[1], "w");
+    if(out == NULL) {
+        fprintf(stderr, "res2raw: [%s] failed to open file\n", argv[1]);
+        return 1;
+    }
+
+    fprintf(out,
+        "/**\n"
+        " * @file    image.h\n"
+        " * @author  Mindou (minsu5875@naver.com)\n"
+        " * @brief   header containing image data to be used by the program\n"
+        " *          - generated by `make resources` (tools/res2raw.c), do not edit\n"
+        " *          - pixel data is already decoded, `<NAME>_IMAGE` can be passed to `LoadTextureFromImage()`\n"
+        " *          - `<NAME>_IMAGE` points to static data, do not call `UnloadImage()` on it\n"
+        " * @version 0.2\n"
+        " *\n"
+        " * @copyright Copyright (c) 2023 Minsu Bak\n"
+        " *\n"
+        " */\n"
+        "#ifndef IMAGE_H\n"
+        "#define IMAGE_H\n\n"
+        "/**\n"
+        " * @brief image.h variable info\n"
+        " *\n"
+        " *  type          name          pointer   info\n"
+        " *  #define       <NAME>_W      n         image width\n"
+        " *  #define       <NAME>_H      n         image height\n"
+        " *  #define       <NAME>_IMAGE  n         `Image` pointing to the pixel data\n"
+        " *  unsigned char <name>        y         decoded pixel data array\n"
+        " *\n"
+        " */\n\n"
+        "// external library\n"
+        "#include \"raylib.h\"\n\n");
+
+    int failed = 0;
+    for(int i = 2; i < argc; i++) {
+        char name[NAME_MAX_W] = { 0 };
+        const char *eq = strchr(argv[i], '=');
+
+        if(eq == NULL || eq == argv[i] || eq - argv[i] >= NAME_MAX_W) {
+            fprintf(stderr, "res2raw: invalid argument `%s`\n", argv[i]);
+            failed = 1;
+            continue;
+        }
+        memcpy(name, argv[i], eq - argv[i]);
+        failed |= write_image(out, name, eq + 1);
+    }
+
+    fprintf(out, "#endif\n");
+    fclose(out);
+
+    return failed;
+}
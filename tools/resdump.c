@@ -0,0 +1,104 @@
+/**
+ * @file    resdump.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   columnar results file query tool (no raylib)
+ *          - usage: resdump <file.cpsr> [--column NAME [FIRST [COUNT]]] [--time T [COUNT]]
+ *          - no option: summary of the file and range of each column
+ *          - `--column`: rows of one column, `--time`: segments of the gantt chart from time T
+ *          - only the blocks of the requested rows are decoded from the mapped file
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// user define library
+#include "cpusched.h"
+
+/**
+ * @brief resdump.c variable info
+ *
+ *  type            name        pointer     info
+ *  ResultsFile     r           n           results file opened for reading
+ *  long long       value       y           decoded rows of the column
+ *  ResultsSegment  seg         y           decoded segments of the gantt chart
+ *
+ */
+
+// summary of the file and range of each column
+static void print_summary(const ResultsFile *r) {
+
+    printf("algorithm: %s\nprocess: %d\nlength: %lld\nsegment: %lld\nbytes: %zu\n",
+           r->algo, r->n, r->t, r->segments, r->size);
+    if(r->n > 0)
+        printf("avg turnaround: %.2f\navg waiting: %.2f\navg response: %.2f\n",
+               (double) r->total_turnaround / r->n, (double) r->total_waiting / r->n, (double) r->total_response / r->n);
+
+    for(int c = 0; c < RESULTS_COLUMNS; c++) {
+        long long min, max;
+        long long rows = column_range(r, c, &min, &max);
+        printf("column %-10s rows %lld, min %lld, max %lld\n", resultsColumn[c], rows, min, max);
+    }
+}
+
+int main(int argc, char *argv[]) {
+
+    if(argc < 2 || (argc > 2 && strcmp(argv[2], "--column") != 0 && strcmp(argv[2], "--time") != 0)
+                || (argc > 2 && argc < 4)) {
+        fprintf(stderr, "usage: %s <file.cpsr> [--column NAME [FIRST [COUNT]]] [--time T [COUNT]]\n", argv[0]);
+        return 1;
+    }
+
+    ResultsFile r;
+    if(!open_results(argv[1], &r))
+        return 1;
+
+    int code = 0;
+    if(argc == 2)
+        print_summary(&r);
+
+    // rows of one column
+    else if(strcmp(argv[2], "--column") == 0) {
+        int column = -1;
+        for(int c = 0; c < RESULTS_COLUMNS; c++)
+            if(strcmp(argv[3], resultsColumn[c]) == 0)
+                column = c;
+        long long first = argc > 4 ? atoll(argv[4]) : 0;
+        long long count = argc > 5 ? atoll(argv[5]) : 20;
+        long long *value = malloc(sizeof(long long) * (count > 0 ? count : 1));
+        long long got    = column < 0 || count < 0 ? -1 : read_column(&r, column, first, count, value);
+
+        if(got < 0) {
+            fprintf(stderr, "%s: unknown column or invalid row range\n", argv[0]);
+            code = 1;
+        }
+        for(long long i = 0; i < got; i++)
+            printf("%lld\t%lld\n", first + i, value[i]);
+        free(value);
+    }
+
+    // segments of the gantt chart from the time
+    else {
+        long long first = find_segment(&r, atoll(argv[3]));
+        long long count = argc > 4 ? atoll(argv[4]) : 20;
+        ResultsSegment *seg = malloc(sizeof(ResultsSegment) * (count > 0 ? count : 1));
+        long long got       = first < 0 || count < 0 ? -1 : read_segments(&r, first, count, seg);
+
+        if(got < 0) {
+            fprintf(stderr, "%s: time out of the gantt chart\n", argv[0]);
+            code = 1;
+        }
+        for(long long i = 0; i < got; i++)
+            printf("%lld\t%lld\t%lld\t%d\n", first + i, seg[i].start, seg[i].length, seg[i].pid);
+        free(seg);
+    }
+
+    close_results(&r);
+    return code;
+}
@@ -0,0 +1,189 @@
+/**
+ * @file    streamsim.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   open-system streaming simulation for libcpusched (no raylib)
+ *          - usage: streamsim [--algo NAME] [--plugin FILE] [--window T] [--until T] [--quiet]
+ *                             [--rate R] [--burst MEAN] [--cv CV] [--count N] [--seed S] [--priorities K]
+ *                             [--precision P] [--confidence C] [--waiting] [workload | -]
+ *          - arrival stream: Poisson generator (`--rate`), or workload file or pipe (`-` for stdin)
+ *            in arrival order
+ *          - one line for each `window / 10` time units: sliding window throughput, utilization
+ *            and turnaround percentiles, then the metrics of the whole stream
+ *          - `--precision`: stop once the confidence interval of the mean turnaround (`--waiting`:
+ *            waiting) after the MSER-5 warm-up is within `P` of the mean, `--until` is the time limit
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+    #include <fcntl.h>
+    #include <io.h>
+#endif
+
+// user define library
+#include "cpusched.h"
+
+/**
+ * @brief streamsim.c variable info
+ *
+ *  type            name        pointer     info
+ *  SteadyOptions   opt         n           stopping rule and streaming options
+ *  SteadyEstimate  est         n           steady-state estimate (`--precision`)
+ *  StreamStats     st          y           metrics of the whole stream
+ *  ArrivalGen      gen         n           arrival generator (`--rate`)
+ *  WorkloadReader  rd          n           workload file or pipe being read
+ *  Plugin          plugin      n           loaded policy plugin
+ *  Policy          pol         y           policy of the run
+ *  bool            quiet       n           print the whole stream metrics only
+ *
+ */
+
+/**
+ * @brief   print sliding window metrics
+ *
+ * @param data  unused
+ * @param w     pointer for window metrics
+ */
+void print_window(void *data, const StreamWindow *w) {
+
+    (void) data;
+    printf("%12lld %10.4f %6.3f %8d %10lld %10lld %10lld %10lld\n",
+        (long long) w->end, w->throughput, w->utilization, w->live,
+        (long long) w->p50, (long long) w->p90, (long long) w->p99, (long long) w->max);
+}
+
+int main(int argc, char *argv[]) {
+
+    SteadyOptions opt = { .stream = { .on_window = print_window } };
+    SteadyEstimate est;
+    StreamStats *st   = malloc(sizeof(StreamStats));
+    Plugin plugin     = { 0 };
+    const Policy *pol = builtinPolicy[0];
+    const char *input = NULL;
+    double rate = 0, burst = 10, cv = 1;
+    long long count = 0;
+    unsigned long long seed = 1;
+    int priorities = 5, algo;
+
+    if(st == NULL) {
+        fprintf(stderr, "not enough memory\n");
+        return 1;
+    }
+
+    for(int i = 1; i < argc; i++) {
+        if(strcmp(argv[i], "--algo") == 0 && i + 1 < argc) {
+            if((algo = find_algorithm(argv[++i])) < 0) {
+                fprintf(stderr, "unknown algorithm `%s`\n", argv[i]);
+                return 1;
+            }
+            pol = builtinPolicy[algo];
+        }
+        else if(strcmp(argv[i], "--plugin") == 0 && i + 1 < argc) {
+            if(!load_plugin(argv[++i], &plugin))
+                return 1;
+            pol = plugin.policy;
+        }
+        else if(strcmp(argv[i], "--window") == 0 && i + 1 < argc)
+            opt.stream.window = atoll(argv[++i]);
+        else if(strcmp(argv[i], "--until") == 0 && i + 1 < argc)
+            opt.stream.until = atoll(argv[++i]);
+        else if(strcmp(argv[i], "--quiet") == 0)
+            opt.stream.on_window = NULL;
+        else if(strcmp(argv[i], "--rate") == 0 && i + 1 < argc)
+            rate = atof(argv[++i]);
+        else if(strcmp(argv[i], "--burst") == 0 && i + 1 < argc)
+            burst = atof(argv[++i]);
+        else if(strcmp(argv[i], "--cv") == 0 && i + 1 < argc)
+            cv = atof(argv[++i]);
+        else if(strcmp(argv[i], "--count") == 0 && i + 1 < argc)
+            count = atoll(argv[++i]);
+        else if(strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+            seed = strtoull(argv[++i], NULL, 10);
+        else if(strcmp(argv[i], "--priorities") == 0 && i + 1 < argc)
+            priorities = atoi(argv[++i]);
+        else if(strcmp(argv[i], "--precision") == 0 && i + 1 < argc)
+            opt.precision = atof(argv[++i]);
+        else if(strcmp(argv[i], "--confidence") == 0 && i + 1 < argc)
+            opt.confidence = atof(argv[++i]);
+        else if(strcmp(argv[i], "--waiting") == 0)
+            opt.metric = STEADY_WAITING;
+        else
+            input = argv[i];
+    }
+
+    // an unbounded generator needs a stop time or a stopping rule
+    if((input == NULL && rate <= 0) || (input == NULL && count == 0 && opt.stream.until == 0 && opt.precision <= 0) || burst < 1) {
+        fprintf(stderr, "usage: streamsim [--algo NAME] [--plugin FILE] [--window T] [--until T] [--quiet]\n"
+                        "                 [--rate R] [--burst MEAN] [--cv CV] [--count N] [--seed S] [--priorities K]\n"
+                        "                 [--precision P] [--confidence C] [--waiting] [workload | -]\n"
+                        "       the generator (--rate) needs --count, --until or --precision\n");
+        return 1;
+    }
+
+    ArrivalGen gen;
+    WorkloadReader rd;
+    FILE *fp = NULL;
+    if(input != NULL) {
+        if(strcmp(input, "-") == 0) {
+#ifdef _WIN32
+            _setmode(_fileno(stdin), _O_BINARY);
+#endif
+            fp = stdin;
+        }
+        else if((fp = fopen(input, "rb")) == NULL) {
+            fprintf(stderr, "WARNING: WORKLOAD: [%s] failed to open file\n", input);
+            return 1;
+        }
+        if(!begin_read_workload(&rd, fp, input))
+            return 1;
+    }
+    else
+        init_generator(&gen, rate, burst, cv, priorities, count, seed);
+
+    if(opt.stream.on_window)
+        printf("%12s %10s %6s %8s %10s %10s %10s %10s\n", "time", "thruput", "util", "live", "p50", "p90", "p99", "max");
+    ArrivalSource src = input != NULL ? workload_source : generator_source;
+    void *srcData     = input != NULL ? (void*) &rd : (void*) &gen;
+    bool reached      = false;
+    if(opt.precision > 0)
+        reached = run_steady(pol, src, srcData, &opt, st, &est);
+    else
+        run_stream(pol, src, srcData, &opt.stream, st);
+
+    double done = st->completed > 0 ? (double) st->completed : 1;
+    printf("%-5s arrived %lld completed %lld live %d (peak %d) time %lld util %.3f\n",
+        pol->name, st->arrived, st->completed, st->live, st->peak, (long long) st->time,
+        st->time > 0 ? (double) st->busy / st->time : 0);
+    printf("avg turn %.2f avg wait %.2f avg resp %.2f p50 %lld p90 %lld p99 %lld p99.9 %lld max %lld\n",
+        st->total_turnaround / done, st->total_waiting / done, st->total_response / done,
+        (long long) hist_percentile(&st->turnaround, 0.50), (long long) hist_percentile(&st->turnaround, 0.90),
+        (long long) hist_percentile(&st->turnaround, 0.99), (long long) hist_percentile(&st->turnaround, 0.999),
+        (long long) st->turnaround.max);
+    if(opt.precision > 0) {
+        if(est.valid)
+            printf("steady %s %.3f +- %.3f (%.0f%%, %s) warm-up %lld of %lld, batch %lld\n",
+                opt.metric == STEADY_WAITING ? "wait" : "turn", est.mean, est.halfWidth, est.confidence * 100,
+                reached ? "reached" : "not reached", est.truncated, est.observations, est.batchSize);
+        else
+            printf("steady: too few observations (%lld)\n", est.observations);
+    }
+
+    bool failed = st->failed;
+
+    // memory allocate disable
+    if(fp != NULL && fp != stdin)
+        fclose(fp);
+    free(st);
+    if(plugin.handle)
+        unload_plugin(&plugin);
+
+    return failed;
+}
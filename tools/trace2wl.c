@@ -0,0 +1,79 @@
+/**
+ * @file    trace2wl.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   scheduler trace to workload file converter (no raylib)
+ *          - usage: trace2wl [--unit NS] [--threads N] [--window MB] [--per-task] [--text] <trace> <output>
+ *          - trace is `perf sched script` output or ftrace text with sched_switch/sched_wakeup
+ *          - processes are written while the trace is parsed (binary workload unless `--text`)
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// user define library
+#include "cpusched.h"
+
+/**
+ * @brief trace2wl.c variable info
+ *
+ *  type            name        pointer     info
+ *  TraceOptions    opt         n           trace conversion options
+ *  TraceStats      stats       n           trace conversion statistics
+ *  WorkloadWriter  w           n           workload file written while parsing
+ *  bool            binary      n           write binary workload file
+ *
+ */
+
+// sink: write each process to the workload file
+static void write_sink(void *data, const Process *p) {
+
+    write_process(data, p);
+}
+
+int main(int argc, char *argv[]) {
+
+    TraceOptions opt = { 0 };
+    bool binary = true;
+    int i = 1;
+
+    for(; i < argc && strncmp(argv[i], "--", 2) == 0; i++) {
+        if(strcmp(argv[i], "--unit") == 0 && i + 1 < argc)
+            opt.unit = atoll(argv[++i]);
+        else if(strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+            opt.threads = atoi(argv[++i]);
+        else if(strcmp(argv[i], "--window") == 0 && i + 1 < argc)
+            opt.window = (size_t) atoll(argv[++i]) << 20;
+        else if(strcmp(argv[i], "--per-task") == 0)
+            opt.perTask = true;
+        else if(strcmp(argv[i], "--text") == 0)
+            binary = false;
+        else
+            break;
+    }
+
+    if(argc - i != 2) {
+        fprintf(stderr, "usage: %s [--unit NS] [--threads N] [--window MB] [--per-task] [--text] <trace> <output>\n", argv[0]);
+        return 1;
+    }
+
+    WorkloadWriter w;
+    if(!begin_workload(&w, argv[i + 1], binary))
+        return 1;
+
+    TraceStats stats;
+    bool ok = parse_trace(argv[i], &opt, write_sink, &w, &stats);
+    ok = end_workload(&w) && ok;
+
+    if(ok)
+        printf("%s: %lld process from %lld task, %lld event in %lld line (%lld skipped, %lld byte)\n",
+               argv[i + 1], stats.processes, stats.tasks, stats.events, stats.lines, stats.skipped, stats.bytes);
+
+    return ok ? 0 : 1;
+}
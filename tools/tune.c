@@ -0,0 +1,141 @@
+/**
+ * @file    tune.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   parameter tuning of RR, MLFQ and aging for libcpusched (no raylib)
+ *          - usage: tune [--family RR|MLFQ|AGING] [--metric waiting|turnaround|response] [--candidates N]
+ *                        [--eta E] [--seed S] [--jobs J] [workload]
+ *          - best parameters of the family on the workload (built-in `pInfo` if no file is given)
+ *            and their metric next to the default parameters
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// user define library
+#include "cpusched.h"
+
+/**
+ * @brief tune.c variable info
+ *
+ *  type            name        pointer     info
+ *  TuneOptions     opt         n           family, metric and search options
+ *  TuneResult      res         n           best parameters and their metric
+ *  Process         p           y           workload
+ *
+ */
+
+/**
+ * @brief   present time of monotonic clock
+ *
+ * @return  double (second)
+ */
+double now(void) {
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// parameters of the family in one line
+void print_params(const char *label, TuneFamily family, const TuneParams *prm, double value) {
+
+    printf("%-8s", label);
+    switch(family) {
+    case TUNE_MLFQ:
+        printf(" levels %d, quantum %d", prm->levels, prm->quantum);
+        if(prm->boost > 0)
+            printf(", boost %lld", (long long) prm->boost);
+        else
+            printf(", no boost");
+        break;
+    case TUNE_AGING:
+        printf(" aging %g", prm->aging);
+        break;
+    default:
+        printf(" quantum %d", prm->quantum);
+        break;
+    }
+    printf(": %.3f\n", value);
+}
+
+// index of the name in the list, -1 if not found
+int find_name(const char *const *names, int count, const char *name) {
+
+    for(int i = 0; i < count; i++)
+        if(strcmp(names[i], name) == 0)
+            return i;
+    return -1;
+}
+
+int main(int argc, char *argv[]) {
+
+    TuneOptions opt = { .family = TUNE_RR, .metric = TUNE_WAITING, .seed = 1 };
+    TuneResult res;
+    const char *input = NULL;
+    int n = 0, k;
+    Time t = 0;
+
+    for(int i = 1; i < argc; i++) {
+        if(strcmp(argv[i], "--family") == 0 && i + 1 < argc) {
+            if((k = find_name(tuneFamilyName, TUNE_FAMILIES, argv[++i])) < 0) {
+                fprintf(stderr, "unknown family `%s`\n", argv[i]);
+                return 1;
+            }
+            opt.family = k;
+        }
+        else if(strcmp(argv[i], "--metric") == 0 && i + 1 < argc) {
+            if((k = find_name(tuneMetricName, TUNE_METRICS, argv[++i])) < 0) {
+                fprintf(stderr, "unknown metric `%s`\n", argv[i]);
+                return 1;
+            }
+            opt.metric = k;
+        }
+        else if(strcmp(argv[i], "--candidates") == 0 && i + 1 < argc)
+            opt.candidates = atoi(argv[++i]);
+        else if(strcmp(argv[i], "--eta") == 0 && i + 1 < argc)
+            opt.eta = atoi(argv[++i]);
+        else if(strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+            opt.seed = strtoull(argv[++i], NULL, 10);
+        else if(strcmp(argv[i], "--jobs") == 0 && i + 1 < argc)
+            opt.jobs = atoi(argv[++i]);
+        else if(argv[i][0] == '-') {
+            fprintf(stderr, "usage: tune [--family RR|MLFQ|AGING] [--metric waiting|turnaround|response] "
+                "[--candidates N] [--eta E] [--seed S] [--jobs J] [workload]\n");
+            return 1;
+        }
+        else
+            input = argv[i];
+    }
+
+    Process *p = input != NULL ? load_workload(input, &n, &t) : default_workload(&n, &t);
+    if(p == NULL)
+        return 1;
+
+    double start = now();
+    if(!tune_policy(p, n, &opt, &res)) {
+        fprintf(stderr, "tune: empty workload or invalid options (eta at least 2)\n");
+        free(p);
+        return 1;
+    }
+    double elapsed = now() - start;
+
+    printf("%s, average %s of %d processes\n", tuneFamilyName[opt.family], tuneMetricName[opt.metric], n);
+    print_params("best", opt.family, &res.best, res.value);
+    print_params("default", opt.family, &res.base, res.baseValue);
+    if(res.baseValue > 0)
+        printf("improvement %.2f%%\n", (res.baseValue - res.value) / res.baseValue * 100);
+    printf("%d rounds, %d runs, %lld processes simulated, %.3f sec\n", res.rounds, res.evaluations, res.simulated, elapsed);
+
+    // memory allocate disable
+    free(p);
+
+    return 0;
+}
@@ -0,0 +1,58 @@
+/**
+ * @file    wlconv.c
+ * @author  Mindou (minsu5875@naver.com)
+ * @brief   workload file converter (no raylib)
+ *          - usage: wlconv [--text] <input> <output>
+ *          - input is text or binary workload, output is binary workload (`--text` for text)
+ *          - output is sorted by arrival like every loaded workload
+ * @version 0.1
+ * @date    (first date: 2026-10-17, last date: 2026-10-17)
+ *
+ * @copyright Copyright (c) 2023 Minsu Bak
+ *
+ */
+
+// standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// user define library
+#include "cpusched.h"
+
+/**
+ * @brief wlconv.c variable info
+ *
+ *  type        name        pointer     info
+ *  bool        binary      n           write binary workload file
+ *  Process     p           y           loaded process data
+ *  int         n           n           total process count
+ *  Time        t           n           total burst time
+ *
+ */
+
+int main(int argc, char *argv[]) {
+
+    bool binary = !(argc > 1 && strcmp(argv[1], "--text") == 0);
+    int  first  = binary ? 1 : 2;
+
+    if(argc - first != 2) {
+        fprintf(stderr, "usage: %s [--text] <input> <output>\n", argv[0]);
+        return 1;
+    }
+
+    int n;
+    Time t;
+    Process *p = load_workload(argv[first], &n, &t);
+    if(p == NULL)
+        return 1;
+
+    bool ok = save_workload(argv[first + 1], p, n, binary);
+    if(ok)
+        printf("%s: %d process, total burst time %lld\n", argv[first + 1], n, t);
+
+    // memory allocate disable
+    free(p);
+
+    return ok ? 0 : 1;
+}